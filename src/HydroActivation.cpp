@@ -5,15 +5,17 @@
 
 #include "Hydruino.h"
 
+HydroActivationTimers activationTimers;
+
 HydroActivationHandle::HydroActivationHandle(SharedPtr<HydroActuator> actuatorIn, Hydro_DirectionMode direction, float intensity, millis_t duration, bool force)
     : activation(direction, constrain(intensity, 0.0f, 1.0f), duration, (force ? Hydro_ActivationFlags_Forced : Hydro_ActivationFlags_None)), 
-      actuator(nullptr), checkTime(0), elapsed(0)
+      actuator(nullptr), checkTime(0), elapsed(0), expiryTimer(this)
 {
     operator=(actuatorIn);
 }
 
 HydroActivationHandle::HydroActivationHandle(const HydroActivationHandle &handle)
-    : actuator(nullptr), activation(handle.activation), checkTime(0), elapsed(0)
+    : actuator(nullptr), activation(handle.activation), checkTime(0), elapsed(0), expiryTimer(this)
 {
     operator=(handle.actuator);
 }
@@ -21,12 +23,13 @@ HydroActivationHandle::HydroActivationHandle(const HydroActivationHandle &handle
 HydroActivationHandle::~HydroActivationHandle()
 {
     if (actuator) { unset(); }
+    if (expiryTimer.isFiled()) { activationTimers.cancel(this); }
 }
 
 HydroActivationHandle &HydroActivationHandle::operator=(SharedPtr<HydroActuator> actuatorIn)
 {
     if (actuator != actuatorIn && isValid()) {
-        if (actuator) { unset(); } else { checkTime = 0; }
+        if (actuator) { unset(); } else { setCheckTime(0); }
 
         actuator = actuatorIn;
 
@@ -38,7 +41,7 @@ HydroActivationHandle &HydroActivationHandle::operator=(SharedPtr<HydroActuator>
 void HydroActivationHandle::unset()
 {
     if (isActive()) { elapseTo(); }
-    checkTime = 0;
+    setCheckTime(0);
 
     if (actuator) {
         for (auto handleIter = actuator->_handles.end() - 1; handleIter != actuator->_handles.begin() - 1; --handleIter) {
@@ -56,16 +59,100 @@ void HydroActivationHandle::elapseBy(millis_t delta)
 {
     if (delta && isValid() && isActive()) {
         if (!isUntimed()) {
-            if (delta <= activation.duration) {
+            if (delta < activation.duration) {
                 activation.duration -= delta;
                 checkTime += delta;
             } else {
                 delta = activation.duration;
                 activation.duration = 0;
-                checkTime = 0;
+                setCheckTime(0);
                 actuator->setNeedsUpdate();
             }
         }
         elapsed += delta;
     }
 }
+
+void HydroActivationHandle::setCheckTime(millis_t time)
+{
+    checkTime = time;
+
+    if (isActive() && !isUntimed() && !isDone()) {
+        activationTimers.schedule(this);
+    } else if (expiryTimer.isFiled()) {
+        activationTimers.cancel(this);
+    }
+}
+
+
+HydroActivationTimers::HydroActivationTimers()
+    : _wheel()
+#ifdef HYDRO_USE_MULTITASKING
+      , _taskId(TASKMGR_INVALIDID), _taskTime(0)
+#endif
+{ ; }
+
+HydroActivationTimers::~HydroActivationTimers()
+{
+    #ifdef HYDRO_USE_MULTITASKING
+        if (isValidTask(_taskId)) { taskManager.cancelTask(_taskId); _taskId = TASKMGR_INVALIDID; }
+    #endif
+}
+
+void HydroActivationTimers::schedule(HydroActivationHandle *handle)
+{
+    if (_wheel.isEmpty()) { _wheel.resetTo(millis()); } // idle wheel time may be stale past advancing range
+    _wheel.insert(&handle->expiryTimer, handle->checkTime + handle->activation.duration);
+    scheduleNextEvent();
+}
+
+void HydroActivationTimers::cancel(HydroActivationHandle *handle)
+{
+    _wheel.remove(&handle->expiryTimer);
+}
+
+void HydroActivationTimers::update()
+{
+    HydroTimerWheelNode *node;
+
+    while ((node = _wheel.popExpired(millis()))) {
+        auto handle = (HydroActivationHandle *)node->owner;
+        SharedPtr<HydroActuator> actuator = handle->actuator;
+
+        if (actuator && handle->isActive()) {
+            handle->elapseTo(node->expiry ?: 1);
+            actuator->setNeedsUpdate();
+            actuator->update();
+        }
+    }
+
+    scheduleNextEvent();
+}
+
+void HydroActivationTimers::scheduleNextEvent()
+{
+    #ifdef HYDRO_USE_MULTITASKING
+        uint32_t eventTime;
+        if (_wheel.nextEventTime(eventTime)) {
+            if (!isValidTask(_taskId) || _taskTime != eventTime) {
+                if (isValidTask(_taskId)) { taskManager.cancelTask(_taskId); }
+                millis_t time = millis();
+                _taskTime = eventTime;
+                _taskId = taskManager.scheduleOnce((int32_t)(eventTime - time) > 0 ? eventTime - time : 0, &HydroActivationTimers::handleNextEvent, TIME_MILLIS);
+            }
+        } else if (isValidTask(_taskId)) {
+            taskManager.cancelTask(_taskId);
+            _taskId = TASKMGR_INVALIDID;
+        }
+    #endif
+}
+
+#ifdef HYDRO_USE_MULTITASKING
+
+void HydroActivationTimers::handleNextEvent()
+{
+    activationTimers._taskId = TASKMGR_INVALIDID;
+    activationTimers.update();
+}
+
+#endif
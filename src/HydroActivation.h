@@ -8,8 +8,10 @@
 
 struct HydroActivation;
 struct HydroActivationHandle;
+class HydroActivationTimers;
 
 #include "Hydruino.h"
+#include "HydroCoreLogic.h"
 
 // Activation Flags
 enum Hydro_ActivationFlags : unsigned char {
@@ -49,6 +51,7 @@ struct HydroActivationHandle {
     HydroActivation activation;                             // Activation data
     millis_t checkTime;                                     // Last check timestamp, in milliseconds, else 0 for not started
     millis_t elapsed;                                       // Elapsed time accumulator, in milliseconds, else 0
+    HydroTimerWheelNode expiryTimer;                        // Expiry timer node, filed with activation timers while active & timed
 
     // Handle constructor that specifies a normalized enablement, ranged: [0.0,1.0] for specified direction
     HydroActivationHandle(SharedPtr<HydroActuator> actuator, Hydro_DirectionMode direction, float intensity = 1.0f, millis_t duration = -1, bool force = false);
@@ -68,17 +71,55 @@ struct HydroActivationHandle {
     void elapseBy(millis_t delta);
     inline void elapseTo(millis_t time = nzMillis()) { elapseBy(time - checkTime); }
 
+    // Sets check timestamp (starting activation, or stopping it if 0), (re)filing expiry with activation timers
+    void setCheckTime(millis_t time);
+
     inline bool isActive() const { return actuator && isValidTime(checkTime); }
     inline bool isValid() const { return activation.isValid(); }
     inline bool isDone() const { return activation.isDone(); }
     inline bool isUntimed() const { return activation.isUntimed(); }
     inline bool isForced() const { return activation.isForced(); }
 
-    inline millis_t getTimeLeft() const { return activation.duration; }
+    inline millis_t getTimeLeft(millis_t time = nzMillis()) const { return isActive() && !isUntimed() ? (time - checkTime < activation.duration ? activation.duration - (time - checkTime) : millis_none) : activation.duration; }
     inline millis_t getTimeActive(millis_t time = nzMillis()) const { return isActive() ? (time - checkTime) + elapsed : elapsed; }
 
     // De-normalized driving intensity value [-1.0,1.0]
     inline float getDriveIntensity() const { return activation.getDriveIntensity(); }
 };
 
+
+// Activation Timers
+// Keeps the expiry of every running timed activation handle filed in a hierarchical timer
+// wheel, with a single one-shot task kept scheduled for the wheel's next event. Expired
+// handles are elapsed to their exact finish time and their actuator updated right then,
+// rather than waiting for the next control loop pass to notice.
+class HydroActivationTimers {
+public:
+    HydroActivationTimers();
+    ~HydroActivationTimers();
+
+    // Files (or re-files) handle's expiry from its check time and duration remaining
+    void schedule(HydroActivationHandle *handle);
+    // Removes handle's expiry from timing
+    void cancel(HydroActivationHandle *handle);
+
+    // Advances timing up to current time, finishing off any expired handles
+    void update();
+
+protected:
+    HydroTimerWheel<HYDRO_ACT_TIMERWHEEL_LEVELS> _wheel;    // Expiry timer wheel, in milliseconds
+#ifdef HYDRO_USE_MULTITASKING
+    taskid_t _taskId;                                       // Next event one-shot task id, else TASKMGR_INVALIDID
+    millis_t _taskTime;                                     // Time next event one-shot task is set to run at
+#endif
+
+    void scheduleNextEvent();
+#ifdef HYDRO_USE_MULTITASKING
+    static void handleNextEvent();
+#endif
+};
+
+// Activation timers instance
+extern HydroActivationTimers activationTimers;
+
 #endif // /ifndef HydroActivation_H
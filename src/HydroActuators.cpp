@@ -31,14 +31,14 @@ HydroActuator *newActuatorObjectFromData(const HydroActuatorData *dataIn)
 HydroActuator::HydroActuator(Hydro_ActuatorType actuatorType, hposi_t actuatorIndex, int classTypeIn)
     : HydroObject(HydroIdentity(actuatorType, actuatorIndex)), classType((typeof(classType))classTypeIn),
       _enabled(false), _needsUpdate(false), _enableMode(Hydro_EnableMode_Undefined),
-      _parentRail(this), _parentReservoir(this), _calibrationData(nullptr)
+      _parentRail(this), _parentReservoir(this), _calibrationData(nullptr), _journalMillis(0)
 { ; }
 
 HydroActuator::HydroActuator(const HydroActuatorData *dataIn)
     : HydroObject(dataIn), classType((typeof(classType))dataIn->id.object.classType),
       _enabled(false), _needsUpdate(false), _enableMode(dataIn->enableMode),
       _contPowerUsage(&(dataIn->contPowerUsage)),
-      _parentRail(this), _parentReservoir(this), _calibrationData(nullptr)
+      _parentRail(this), _parentReservoir(this), _calibrationData(nullptr), _journalMillis(0)
 {
     _parentRail.initObject(dataIn->railName);
     _parentReservoir.initObject(dataIn->reservoirName);
@@ -53,12 +53,14 @@ void HydroActuator::update()
 
     millis_t time = nzMillis();
 
-    // Update running handles and elapse them as needed, determine forced status, and remove invalid/finished handles
+    // Update changed running handles and elapse them as needed, determine forced status, and remove invalid/finished handles
+    // (timed expiries are driven by activation timers, so running handles only need elapsed once something changes)
     bool forced = false;
     if (_handles.size()) {
         for (auto handleIter = _handles.begin(); handleIter != _handles.end(); ++handleIter) {
-            if (_enabled && (*handleIter)->isActive()) {
+            if (_needsUpdate && _enabled && (*handleIter)->isActive()) {
                 (*handleIter)->elapseTo(time);
+                (*handleIter)->setCheckTime((*handleIter)->checkTime); // re-files expiry against any changed duration
             }
             if ((*handleIter)->actuator.get() != this || !(*handleIter)->isValid() || (*handleIter)->isDone()) {
                 if ((*handleIter)->actuator.get() == this) { (*handleIter)->actuator = nullptr; }
@@ -151,9 +153,9 @@ void HydroActuator::update()
                 bool selected = false;
                 for (auto handleIter = _handles.begin(); handleIter != _handles.end(); ++handleIter) {
                     if (!selected && (*handleIter)->isValid() && !(*handleIter)->isDone() && isFPEqual((*handleIter)->activation.intensity, getDriveIntensity())) {
-                        selected = true; (*handleIter)->checkTime = time;
+                        selected = true; (*handleIter)->setCheckTime(time);
                     } else if ((*handleIter)->checkTime != 0) {
-                        (*handleIter)->checkTime = 0;
+                        (*handleIter)->setCheckTime(0);
                     }
                 }
             } break;
@@ -163,9 +165,9 @@ void HydroActuator::update()
                 bool selected = false;
                 for (auto handleIter = _handles.end() - 1; handleIter != _handles.begin() - 1; --handleIter) {
                     if (!selected && (*handleIter)->isValid() && !(*handleIter)->isDone() && isFPEqual((*handleIter)->activation.intensity, getDriveIntensity())) {
-                        selected = true; (*handleIter)->checkTime = time;
+                        selected = true; (*handleIter)->setCheckTime(time);
                     } else if ((*handleIter)->checkTime != 0) {
-                        (*handleIter)->checkTime = 0;
+                        (*handleIter)->setCheckTime(0);
                     }
                 }
             } break;
@@ -173,7 +175,7 @@ void HydroActuator::update()
             default: {
                 for (auto handleIter = _handles.begin(); handleIter != _handles.end(); ++handleIter) {
                     if ((*handleIter)->isValid() && !(*handleIter)->isDone() && (*handleIter)->checkTime == 0) {
-                        (*handleIter)->checkTime = time;
+                        (*handleIter)->setCheckTime(time);
                     }
                 }
             } break;
@@ -182,6 +184,10 @@ void HydroActuator::update()
         _enableActuator(drivingIntensity);
     }
     _needsUpdate = false;
+
+    if (_enabled && _journalMillis && time - _journalMillis >= HYDRO_ACT_JOURNAL_UPDATEMS) {
+        accrueJournal(time);
+    }
 }
 
 bool HydroActuator::getCanEnable()
@@ -256,12 +262,18 @@ void HydroActuator::saveToData(HydroData *dataOut)
 
 void HydroActuator::handleActivation()
 {
+    millis_t time = nzMillis();
+
     if (_enabled) {
+        _journal.countActivation(localNow().unixtime());
+        _journalMillis = time;
+
         getLogger()->logActivation(this);
     } else {
         for (auto handleIter = _handles.begin(); handleIter != _handles.end(); ++handleIter) {
-            if ((*handleIter)->checkTime) { (*handleIter)->checkTime = 0; }
+            if ((*handleIter)->checkTime) { (*handleIter)->setCheckTime(0); }
         }
+        if (_journalMillis) { accrueJournal(time); }
 
         getLogger()->logDeactivation(this);
     }
@@ -274,6 +286,19 @@ void HydroActuator::handleActivation()
 }
 
 
+void HydroActuator::accrueJournal(millis_t time)
+{
+    float watts = 0.0f;
+    if (_contPowerUsage.isSet()) {
+        auto powerUsage = _contPowerUsage.asUnits(Hydro_UnitsType_Power_Wattage, getParentRail() ? getParentRail()->getRailVoltage() : FLT_UNDEF);
+        if (powerUsage.units == Hydro_UnitsType_Power_Wattage) { watts = powerUsage.value * fabsf(getDriveIntensity()); }
+    }
+
+    _journal.accrue(localNow().unixtime(), time - _journalMillis, watts);
+    _journalMillis = _enabled ? time : 0;
+}
+
+
 HydroRelayActuator::HydroRelayActuator(Hydro_ActuatorType actuatorType, hposi_t actuatorIndex, HydroDigitalPin outputPin, int classType)
     : HydroActuator(actuatorType, actuatorIndex, classType),
       _outputPin(outputPin)
@@ -412,11 +437,11 @@ void HydroRelayPumpActuator::handleActivation()
         float duration = time - _pumpTimeStart;
         uint8_t addDecPlaces = getActuatorType() == Hydro_ActuatorType_PeristalticPump ? 2 : 1;
 
-        getLogger()->logStatus(this, SFP(HStr_Log_MeasuredPumping));
-        if (getSourceReservoir()) { getLogger()->logMessage(SFP(HStr_Log_Field_Source_Reservoir), getSourceReservoir()->getId().getDisplayString()); }
-        if (getDestinationReservoir()) { getLogger()->logMessage(SFP(HStr_Log_Field_Destination_Reservoir), getDestinationReservoir()->getId().getDisplayString()); }
-        getLogger()->logMessage(SFP(HStr_Log_Field_Vol_Measured), measurementToString(_pumpVolumeAccum, baseUnits(getFlowRateUnits()), addDecPlaces));
-        getLogger()->logMessage(SFP(HStr_Log_Field_Time_Measured), roundToString(duration / 1000.0f, 1), String('s'));
+        getLogger()->logStatus(this, HStr_Log_MeasuredPumping);
+        if (getSourceReservoir()) { getLogger()->logMessage(logArg(HStr_Log_Field_Source_Reservoir), logArg(getSourceReservoir()->getId())); }
+        if (getDestinationReservoir()) { getLogger()->logMessage(logArg(HStr_Log_Field_Destination_Reservoir), logArg(getDestinationReservoir()->getId())); }
+        getLogger()->logMeasurement(HStr_Log_Field_Vol_Measured, _pumpVolumeAccum, baseUnits(getFlowRateUnits()), addDecPlaces);
+        getLogger()->logMessage(logArg(HStr_Log_Field_Time_Measured), logArg(duration / 1000.0f, defaultDecimalPlaces() + 1), logArg("s"));
     }
 }
 
@@ -450,24 +475,24 @@ HydroActivationHandle HydroRelayPumpActuator::pump(millis_t time)
 {
     if (getSourceReservoir()) {
         #ifdef HYDRO_USE_MULTITASKING
-            getLogger()->logStatus(this, SFP(HStr_Log_CalculatedPumping));
-            if (getSourceReservoir()) { getLogger()->logMessage(SFP(HStr_Log_Field_Source_Reservoir), getSourceReservoir()->getId().getDisplayString()); }
-            if (getDestinationReservoir()) { getLogger()->logMessage(SFP(HStr_Log_Field_Destination_Reservoir), getDestinationReservoir()->getId().getDisplayString()); }
+            getLogger()->logStatus(this, HStr_Log_CalculatedPumping);
+            if (getSourceReservoir()) { getLogger()->logMessage(logArg(HStr_Log_Field_Source_Reservoir), logArg(getSourceReservoir()->getId())); }
+            if (getDestinationReservoir()) { getLogger()->logMessage(logArg(HStr_Log_Field_Destination_Reservoir), logArg(getDestinationReservoir()->getId())); }
             if (_contFlowRate.value > FLT_EPSILON) {
                 uint8_t addDecPlaces = getActuatorType() == Hydro_ActuatorType_PeristalticPump ? 2 : 1;
-                getLogger()->logMessage(SFP(HStr_Log_Field_Vol_Calculated), measurementToString(_contFlowRate.value * (time / (float)secondsToMillis(SECS_PER_MIN)), baseUnits(getFlowRateUnits()), addDecPlaces));
+                getLogger()->logMeasurement(HStr_Log_Field_Vol_Calculated, _contFlowRate.value * (time / (float)secondsToMillis(SECS_PER_MIN)), baseUnits(getFlowRateUnits()), addDecPlaces);
             }
-            getLogger()->logMessage(SFP(HStr_Log_Field_Time_Calculated), roundToString(time / 1000.0f, 1), String('s'));
+            getLogger()->logMessage(logArg(HStr_Log_Field_Time_Calculated), logArg(time / 1000.0f, defaultDecimalPlaces() + 1), logArg("s"));
             return enableActuator(time);
         #else
-            getLogger()->logStatus(this, SFP(HStr_Log_CalculatedPumping));
-            if (getSourceReservoir()) { getLogger()->logMessage(SFP(HStr_Log_Field_Source_Reservoir), getSourceReservoir()->getId().getDisplayString()); }
-            if (getDestinationReservoir()) { getLogger()->logMessage(SFP(HStr_Log_Field_Destination_Reservoir), getDestinationReservoir()->getId().getDisplayString()); }
+            getLogger()->logStatus(this, HStr_Log_CalculatedPumping);
+            if (getSourceReservoir()) { getLogger()->logMessage(logArg(HStr_Log_Field_Source_Reservoir), logArg(getSourceReservoir()->getId())); }
+            if (getDestinationReservoir()) { getLogger()->logMessage(logArg(HStr_Log_Field_Destination_Reservoir), logArg(getDestinationReservoir()->getId())); }
             if (_contFlowRate.value > FLT_EPSILON) {
                 uint8_t addDecPlaces = getActuatorType() == Hydro_ActuatorType_PeristalticPump ? 2 : 1;
-                getLogger()->logMessage(SFP(HStr_Log_Field_Vol_Calculated), measurementToString(_contFlowRate.value * (time / (float)secondsToMillis(SECS_PER_MIN)), baseUnits(getFlowRateUnits()), addDecPlaces));
+                getLogger()->logMeasurement(HStr_Log_Field_Vol_Calculated, _contFlowRate.value * (time / (float)secondsToMillis(SECS_PER_MIN)), baseUnits(getFlowRateUnits()), addDecPlaces);
             }
-            getLogger()->logMessage(SFP(HStr_Log_Field_Time_Calculated), roundToString(time / 1000.0f, 1), String('s'));
+            getLogger()->logMessage(logArg(HStr_Log_Field_Time_Calculated), logArg(time / 1000.0f, defaultDecimalPlaces() + 1), logArg("s"));
             return enableActuator(time);
         #endif
     }
@@ -96,6 +96,13 @@ public:
 
     Signal<HydroActuator *, HYDRO_ACTUATOR_SIGNAL_SLOTS> &getActivationSignal();
 
+    // Activation journal tracks on-time, activation counts, and energy usage (from continuous power
+    // draw) into lifetime totals and hourly/daily/weekly rollups. Journals are saved alongside system
+    // data, and are restored onto their actuators at load.
+    inline const HydroActivationJournal &getActivationJournal() const { return _journal; }
+    inline void setActivationJournal(const HydroActivationJournal &journal) { _journal = journal; }
+    inline void resetActivationJournal() { _journal.reset(); }
+
 protected:
     bool _enabled;                                          // Enabled state flag
     bool _needsUpdate;                                      // Stale flag for handle updates
@@ -106,12 +113,17 @@ protected:
     HydroAttachment _parentReservoir;                       // Parent reservoir attachment
     const HydroCalibrationData *_calibrationData;           // Calibration data
     Signal<HydroActuator *, HYDRO_ACTUATOR_SIGNAL_SLOTS> _activateSignal; // Activation update signal
+    HydroActivationJournal _journal;                        // Activation journal
+    millis_t _journalMillis;                                // Last journal accrual time millis while enabled, else 0
 
     virtual HydroData *allocateData() const override;
     virtual void saveToData(HydroData *dataOut) override;
 
     virtual void handleActivation();
 
+    // Accrues running on-time and energy usage since last accrual into activation journal
+    void accrueJournal(millis_t time);
+
     friend struct HydroActivationHandle;
 };
 
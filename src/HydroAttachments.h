@@ -204,7 +204,7 @@ public:
 
     // Activation status based on handle activation
     inline bool isActivated() const { return _actHandle.isActive(); }
-    inline millis_t getTimeLeft() const { return _actHandle.getTimeLeft(); }
+    inline millis_t getTimeLeft(millis_t time = nzMillis()) const { return _actHandle.getTimeLeft(time); }
     inline millis_t getTimeActive(millis_t time = nzMillis()) const { return _actHandle.getTimeActive(time); }
 
     // Currently active driving intensity [-1.0,1.0] / calibrated value [calibMin,calibMax], from actuator
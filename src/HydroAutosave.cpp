@@ -0,0 +1,354 @@
+/*  Hydruino: Simple automation controller for hydroponic grow systems.
+    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>
+    Hydruino Autosave Queue
+*/
+
+#include "Hydruino.h"
+
+// Returns system data EEPROM generations of active controller, fallen back to at most slotCount slots
+static inline HydroEEPROMGenerations<I2C_eeprom> systemDataGenerations(uint8_t slotCount = HYDRO_SYS_EEPROM_GENERATIONS)
+{
+    HydroEEPROMGenerations<I2C_eeprom> retVal(getController()->getEEPROM(), getController()->getSystemDataAddress(),
+                                              getController()->getEEPROMSize() - getController()->getSystemDataAddress(), HYDRO_SYS_EEPROM_GENERATIONS);
+    while (retVal.getSlotCount() > slotCount && retVal.fallBack()) { ; }
+    return retVal;
+}
+
+// Serializes data to JSON output stream, using a document chunk of size N, returning bytes written
+template<size_t N>
+static size_t serializeDataToJSONStream(const HydroData *data, Stream *streamOut, bool compact)
+{
+    StaticJsonDocument<N> doc;
+
+    JsonObject dataObj = doc.to<JsonObject>();
+    data->toJSONObject(dataObj);
+
+    return compact ? serializeJson(doc, *streamOut) : serializeJsonPretty(doc, *streamOut);
+}
+
+// Copies next chunk of SD card file onto end of another (SD library has no rename), returning bytes copied (0 once at end of file), else -1 on failure
+static int copySDFileChunk(const char *fromFilename, const char *toFilename, uint32_t offset)
+{
+    auto hydroController = Hydruino::_activeInstance;
+    uint8_t buffer[HYDRO_SYS_SDCOPY_CHUNKSIZE];
+    int retVal = -1;
+    auto fromFile = hydroController->getSDFile(fromFilename);
+
+    if (fromFile) {
+        if (fromFile->seek(offset)) {
+            retVal = fromFile->read(buffer, sizeof(buffer));
+        }
+        hydroController->endSDFile(fromFile);
+    }
+
+    if (retVal > 0) {
+        auto toFile = hydroController->getSDFile(toFilename, true);
+
+        if (toFile) {
+            if (toFile->write(buffer, retVal) != (size_t)retVal || toFile->getWriteError()) { retVal = -1; }
+            hydroController->endSDFile(toFile);
+        } else {
+            retVal = -1;
+        }
+    }
+
+    return retVal;
+}
+
+// Removes SD card file, closing any pooled handles to it first, returning success
+static bool removeSDFile(const char *filename)
+{
+    auto hydroController = Hydruino::_activeInstance;
+    bool retVal = false;
+
+    if (hydroController->closeSDFile(filename)) {
+        auto sd = hydroController->getSDCard();
+
+        if (sd) {
+            retVal = !sd->exists(filename) || sd->remove(filename);
+            hydroController->endSDCard(sd);
+        }
+    }
+
+    return retVal;
+}
+
+// Returns SD card file's size, else -1 if it doesn't exist
+static int32_t sizeOfSDFile(const char *filename)
+{
+    auto hydroController = Hydruino::_activeInstance;
+    int32_t retVal = -1;
+    hydroController->closeSDFile(filename); // flushes any write handle
+
+    auto sd = hydroController->getSDCard();
+    if (sd) {
+        if (sd->exists(filename)) {
+            auto file = sd->open(filename, FILE_READ);
+            if (file) { retVal = file.size(); file.close(); }
+        }
+        hydroController->endSDCard(sd);
+    }
+
+    return retVal;
+}
+
+
+HydroAutosaveQueue::HydroAutosaveQueue()
+    : _records(nullptr), _sequence(), _stream(nullptr), _sdFile(nullptr), _eepromStream(nullptr), _eepromSlot(-1), _eepromSequence(0), _eepromSlotCount(HYDRO_SYS_EEPROM_GENERATIONS), _sdReplaceStep(SDReplace_None), _sdCopyOffset(0)
+#ifdef HYDRO_USE_WIFI_STORAGE
+      , _wifiFile(nullptr), _wifiStream(nullptr)
+#endif
+{ ; }
+
+HydroAutosaveQueue::~HydroAutosaveQueue()
+{
+    end();
+}
+
+bool HydroAutosaveQueue::begin(Hydro_Autosave autosave, Hydro_Autosave fallback)
+{
+    end();
+
+    uint16_t recordCount = 0;
+    _records = Hydruino::_activeInstance->newSaveSnapshot(recordCount);
+    if (!_records) { return false; }
+
+    _eepromSlotCount = HYDRO_SYS_EEPROM_GENERATIONS;
+    _sequence.begin(autosave, fallback, recordCount);
+    if (_sequence.isFinished()) { end(); }
+
+    return isPending();
+}
+
+bool HydroAutosaveQueue::writeNext()
+{
+    if (!_records) { return false; }
+
+    if (_sdReplaceStep != SDReplace_None) {
+        if (!replaceNextSDChunk()) {
+            HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_ExportFailure));
+            _sdReplaceStep = SDReplace_None;
+            finishTarget(false);
+        } else if (_sdReplaceStep == SDReplace_None) {
+            finishTarget(true);
+        }
+        return isPending();
+    }
+
+    if (!_stream && !openTarget()) {
+        HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_OperationFailure));
+        finishTarget(false);
+        return isPending();
+    }
+
+    if (!_sequence.isTargetWritten()) {
+        if (!writeRecord(_records[_sequence.getRecordIndex()]) || _stream->getWriteError()) {
+            if (_eepromStream && _eepromStream->isWriteFull()) { // overflowed slot, rewritten in fewer/larger slots
+                auto generations = systemDataGenerations(_eepromSlotCount);
+                if (Hydruino::_activeInstance->fallBackEEPROMGenerations(generations)) {
+                    _eepromSlotCount = generations.getSlotCount();
+                    closeTarget(false);
+                    _sequence.restartTarget();
+                    return isPending();
+                }
+            }
+            HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_ExportFailure));
+            closeTarget(false);
+            finishTarget(false);
+            return isPending();
+        }
+        _sequence.recordWritten();
+    }
+
+    if (_sequence.isTargetWritten()) {
+        bool success = closeTarget(true);
+        if (_sdReplaceStep == SDReplace_None) { finishTarget(success); } // else finished once config file replaced
+    }
+
+    return isPending();
+}
+
+void HydroAutosaveQueue::end()
+{
+    closeTarget(false);
+
+    // Config file already being overwritten is finished off rather than left partially written
+    while (_sdReplaceStep == SDReplace_Swap && replaceNextSDChunk()) { ; }
+    _sdReplaceStep = SDReplace_None;
+
+    if (_records) {
+        for (uint16_t recordIndex = 0; recordIndex < _sequence.getRecordCount(); ++recordIndex) {
+            if (_records[recordIndex]) { delete _records[recordIndex]; }
+        }
+        delete [] _records; _records = nullptr;
+    }
+    _sequence = HydroSaveSequence<Hydro_Autosave, Hydro_Autosave_Disabled>();
+}
+
+bool HydroAutosaveQueue::openTarget()
+{
+    auto hydroController = Hydruino::_activeInstance;
+    String stagedFilename = getSiblingFilename(hydroController->getSystemConfigFile(), SFP(HStr_tmp));
+
+    switch (getTarget()) {
+        case Hydro_Autosave_EnabledToSDCardJson:
+        case Hydro_Autosave_EnabledToSDCardRaw:
+            if (removeSDFile(stagedFilename.c_str())) {
+                _stream = _sdFile = hydroController->getSDFile(stagedFilename.c_str(), true);
+            }
+            break;
+
+        case Hydro_Autosave_EnabledToEEPROMJson:
+        case Hydro_Autosave_EnabledToEEPROMRaw:
+            // Payload goes into the slot after newest, with its header only committed once fully written
+            if (hydroController->getEEPROM() && hydroController->_eepromBegan && hydroController->getSystemDataAddress() != (uint16_t)-1) {
+                auto generations = systemDataGenerations(_eepromSlotCount);
+                _eepromSlot = generations.nextSlot(&_eepromSequence);
+                _eepromSlotCount = generations.getSlotCount();
+                _stream = _eepromStream = new HydroEEPROMStream(generations.getPayloadAddress(_eepromSlot), generations.getPayloadCapacity());
+                HYDRO_SOFT_ASSERT(_eepromStream, SFP(HStr_Err_AllocationFailure));
+            }
+            break;
+
+        case Hydro_Autosave_EnabledToWiFiStorageJson:
+        case Hydro_Autosave_EnabledToWiFiStorageRaw:
+            #ifdef HYDRO_USE_WIFI_STORAGE
+                if (WiFiStorage.exists(stagedFilename.c_str())) {
+                    WiFiStorage.remove(stagedFilename.c_str());
+                }
+                _wifiFile = new WiFiStorageFile(WiFiStorage.open(stagedFilename.c_str()));
+                HYDRO_SOFT_ASSERT(_wifiFile, SFP(HStr_Err_AllocationFailure));
+
+                if (_wifiFile && *_wifiFile) {
+                    _stream = _wifiStream = new HydroWiFiStorageFileStream(*_wifiFile);
+                    HYDRO_SOFT_ASSERT(_wifiStream, SFP(HStr_Err_AllocationFailure));
+                }
+            #endif
+            break;
+
+        default:
+            break;
+    }
+
+    if (!_stream) { closeTarget(false); }
+    return _stream;
+}
+
+bool HydroAutosaveQueue::closeTarget(bool success)
+{
+    auto hydroController = Hydruino::_activeInstance;
+
+    if (_sdFile) {
+        _sdFile->flush();
+        success = success && !_sdFile->getWriteError();
+        hydroController->endSDFile(_sdFile); _sdFile = nullptr;
+
+        // Staged file only replaces config file once fully written (copied over across following
+        // writes, backing up config file first if any), else is discarded
+        String configFilename = hydroController->getSystemConfigFile();
+        String stagedFilename = getSiblingFilename(configFilename, SFP(HStr_tmp));
+
+        if (success) {
+            success = beginSDReplaceStep(sizeOfSDFile(configFilename.c_str()) > 0 ? SDReplace_Backup : SDReplace_Swap);
+        }
+        if (!success) {
+            removeSDFile(stagedFilename.c_str());
+        }
+    }
+
+    if (_eepromStream) {
+        auto generations = systemDataGenerations(_eepromSlotCount);
+        uint16_t payloadAddress = generations.getPayloadAddress(_eepromSlot);
+        _eepromStream->flush();
+        success = success && !_eepromStream->getWriteError();
+        uint16_t length = _eepromStream->getWriteAddress() - payloadAddress;
+        delete _eepromStream; _eepromStream = nullptr;
+
+        success = success && generations.commit(_eepromSlot, _eepromSequence, length);
+    }
+
+    #ifdef HYDRO_USE_WIFI_STORAGE
+        if (_wifiStream) {
+            _wifiStream->flush();
+            delete _wifiStream; _wifiStream = nullptr;
+        }
+        if (_wifiFile) {
+            _wifiFile->close();
+            delete _wifiFile; _wifiFile = nullptr;
+
+            // Staged file only replaces config file once fully written, else is discarded
+            String configFilename = hydroController->getSystemConfigFile();
+            String stagedFilename = getSiblingFilename(configFilename, SFP(HStr_tmp));
+
+            if (success) {
+                if (WiFiStorage.exists(configFilename.c_str())) {
+                    WiFiStorage.remove(configFilename.c_str());
+                }
+                success = WiFiStorage.rename(stagedFilename.c_str(), configFilename.c_str());
+            } else {
+                WiFiStorage.remove(stagedFilename.c_str());
+            }
+        }
+    #endif
+
+    _stream = nullptr;
+    return success;
+}
+
+bool HydroAutosaveQueue::writeRecord(const HydroData *data)
+{
+    if (isJSONTarget()) {
+        bool compact = getTarget() == Hydro_Autosave_EnabledToEEPROMJson;
+        return data->isSystemData() ? serializeDataToJSONStream<HYDRO_JSON_DOC_SYSSIZE>(data, _stream, compact)
+                                    : serializeDataToJSONStream<HYDRO_JSON_DOC_DEFSIZE>(data, _stream, compact);
+    }
+    return serializeDataToBinaryStream(data, _stream);
+}
+
+void HydroAutosaveQueue::finishTarget(bool success)
+{
+    _sequence.targetFinished(success);
+
+    if (_sequence.isFinished()) {
+        if (_sequence.isSaved()) { Hydruino::_activeInstance->commonPostSave(); }
+        end();
+    }
+}
+
+bool HydroAutosaveQueue::beginSDReplaceStep(SDReplaceStep step)
+{
+    String configFilename = Hydruino::_activeInstance->getSystemConfigFile();
+    String toFilename = step == SDReplace_Backup ? getSiblingFilename(configFilename, SFP(HStr_bak)) : configFilename;
+
+    _sdReplaceStep = SDReplace_None;
+    _sdCopyOffset = 0;
+    if (!removeSDFile(toFilename.c_str())) { return false; }
+    _sdReplaceStep = step;
+    return true;
+}
+
+bool HydroAutosaveQueue::replaceNextSDChunk()
+{
+    String configFilename = Hydruino::_activeInstance->getSystemConfigFile();
+    String stagedFilename = getSiblingFilename(configFilename, SFP(HStr_tmp));
+    String fromFilename = _sdReplaceStep == SDReplace_Backup ? configFilename : stagedFilename;
+    String toFilename = _sdReplaceStep == SDReplace_Backup ? getSiblingFilename(configFilename, SFP(HStr_bak)) : configFilename;
+
+    int bytesCopied = copySDFileChunk(fromFilename.c_str(), toFilename.c_str(), _sdCopyOffset);
+    if (bytesCopied < 0) { return false; }
+    if (bytesCopied) { _sdCopyOffset += bytesCopied; return true; }
+
+    // Copy is verified against its source before moving on, so that the config file is only
+    // overwritten once backed up, and the staged file only removed once fully copied over
+    if (sizeOfSDFile(toFilename.c_str()) != (int32_t)_sdCopyOffset || sizeOfSDFile(fromFilename.c_str()) != (int32_t)_sdCopyOffset) {
+        return false;
+    }
+
+    if (_sdReplaceStep == SDReplace_Backup) {
+        return beginSDReplaceStep(SDReplace_Swap);
+    }
+
+    _sdReplaceStep = SDReplace_None;
+    removeSDFile(stagedFilename.c_str());
+    return true;
+}
@@ -0,0 +1,69 @@
+/*  Hydruino: Simple automation controller for hydroponic grow systems.
+    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>
+    Hydruino Autosave Queue
+*/
+
+#ifndef HydroAutosave_H
+#define HydroAutosave_H
+
+class HydroAutosaveQueue;
+
+#include "Hydruino.h"
+
+// Autosave Queue
+// Snapshot-then-write pipeline for autosaves, so that saving only holds up control for a record
+// at a time (the largest being the system data record, which as JSON to I2C EEPROM can still
+// take a while). System data is first captured into standalone data records (object save data,
+// copies of system, calibration, crops, additive, and UI data, and activation journals), which
+// are then written out to the autosave target, and then to its fallback, a record at a time
+// across multiple misc loop runs (see HydroSaveSequence). EEPROM saves are only committed once
+// fully written, and file saves are staged to a separate file that only replaces the config
+// file once fully written, so an abandoned or failed save leaves the previous config in place.
+// On SD card, which can't rename, the config file is first copied to a backup file, then the
+// staged file copied over it, a chunk per write, with each copy verified before moving on (see
+// Hydruino::initFromSDCard for falling back to the staged/backup files if interrupted).
+class HydroAutosaveQueue {
+public:
+    HydroAutosaveQueue();
+    ~HydroAutosaveQueue();
+
+    // Snapshots system data and queues it for writing to autosave target and fallback, returning success.
+    bool begin(Hydro_Autosave autosave, Hydro_Autosave fallback = Hydro_Autosave_Disabled);
+    // Writes next queued record, returning true if more remain to be written.
+    bool writeNext();
+    // Abandons any unfinished write (e.g. when superseded by a manual save), freeing snapshot.
+    void end();
+
+    inline bool isPending() const { return _records; }
+    inline uint16_t getRecordCount() const { return _sequence.getRecordCount(); }
+    inline uint16_t getRecordIndex() const { return _sequence.getRecordIndex(); }
+
+protected:
+    enum SDReplaceStep : uint8_t { SDReplace_None, SDReplace_Backup, SDReplace_Swap };
+
+    HydroData **_records;                                   // Snapshot records (owned), else nullptr if nothing pending
+    HydroSaveSequence<Hydro_Autosave, Hydro_Autosave_Disabled> _sequence; // Autosave target/fallback sequence
+    Stream *_stream;                                        // Open target stream, else nullptr
+    File *_sdFile;                                          // SD card staged config file (pooled)
+    HydroEEPROMStream *_eepromStream;                       // EEPROM generation payload stream (owned)
+    int _eepromSlot;                                        // EEPROM generation slot being written
+    uint32_t _eepromSequence;                               // EEPROM generation sequence # being written
+    uint8_t _eepromSlotCount;                               // EEPROM generation slot count being written with
+    uint8_t _sdReplaceStep;                                 // SD card config file replacement step (see SDReplaceStep)
+    uint32_t _sdCopyOffset;                                 // SD card config file replacement step's copy offset, in bytes
+#ifdef HYDRO_USE_WIFI_STORAGE
+    WiFiStorageFile *_wifiFile;                             // WiFiStorage staged config file (owned)
+    HydroWiFiStorageFileStream *_wifiStream;                // WiFiStorage staged config file stream (owned)
+#endif
+
+    inline Hydro_Autosave getTarget() const { return _sequence.getTarget(); }
+    inline bool isJSONTarget() const { return getTarget() == Hydro_Autosave_EnabledToSDCardJson || getTarget() == Hydro_Autosave_EnabledToEEPROMJson || getTarget() == Hydro_Autosave_EnabledToWiFiStorageJson; }
+    bool openTarget();
+    bool closeTarget(bool success);
+    bool writeRecord(const HydroData *data);
+    void finishTarget(bool success);
+    bool beginSDReplaceStep(SDReplaceStep step);
+    bool replaceNextSDChunk();
+};
+
+#endif // /ifndef HydroAutosave_H
@@ -70,6 +70,9 @@ public:
         }
     }
 
+    // Returns if no slots are attached, such that firing may be skipped.
+    inline bool isEmpty() const { return !_connections.size(); }
+
     // Visits each of its listeners and executes them via operator().
     void fire(ParameterType param) const {
         for (auto iter = _connections.begin(); iter != _connections.end(); ++iter) {
@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 #include <float.h>
 #include <math.h>
 
@@ -131,6 +132,50 @@ inline float hydroEstimateDosingMillis(float targetSetpoint, float dosingValue,
     return dosing;
 }
 
+// Returns the first time strictly after now (plus a second, so daytime checks land past the
+// crossing) that a sunrise or sunset occurs, given the start time of now's day and fractional
+// twilight hours (which may lie outside of [0,24) when stored in UTC).
+inline uint32_t hydroNextTwilightTime(uint32_t now, uint32_t dayStart, double sunriseHour, double sunsetHour)
+{
+    const int32_t offsets[2] = { (int32_t)ceil(sunriseHour * 3600.0) + 1, (int32_t)ceil(sunsetHour * 3600.0) + 1 };
+    uint32_t next = dayStart + (2UL * 86400UL);
+    for (int32_t day = -1; day <= 1; ++day) {
+        for (int index = 0; index < 2; ++index) {
+            const uint32_t time = dayStart + (uint32_t)((day * 86400L) + offsets[index]);
+            if ((int32_t)(time - now) > 0 && (int32_t)(time - next) < 0) { next = time; }
+        }
+    }
+    return next;
+}
+
+// Returns the start time of a day's spread-out feeding slot, where slots are evenly spaced
+// through the day (with room left for one more) so that feedings don't bunch together.
+inline uint32_t hydroFeedingSlotTime(uint32_t dayStart, uint8_t feedingsPerDay, uint8_t slotIndex)
+{
+    return dayStart + (uint32_t)(((float)86400UL / (feedingsPerDay + 1)) * slotIndex);
+}
+
+// Lighting sequence times for a day, in the same time base as dayStart.
+struct HydroLightingTimes
+{
+    uint32_t sprayStart;                                    // Time when spraying should start
+    uint32_t lightStart;                                    // Time when lighting should start / spraying should end
+    uint32_t lightEnd;                                      // Time when lighting should finish
+};
+
+// Centers daily lighting hours around midday, with pre-dawn spraying leading into it
+// (spraying start is clamped to the day start, pushing lighting later as needed).
+inline HydroLightingTimes hydroLightingTimes(uint32_t dayStart, uint32_t dayLightSecs, uint32_t daySprayerSecs)
+{
+    if (dayLightSecs > 86400UL) { dayLightSecs = 86400UL; }
+    HydroLightingTimes times;
+    times.lightStart = dayStart + ((86400UL - dayLightSecs) >> 1);
+    times.sprayStart = times.lightStart - dayStart > daySprayerSecs ? times.lightStart - daySprayerSecs : dayStart;
+    times.lightStart = times.sprayStart + daySprayerSecs;
+    times.lightEnd = times.lightStart + dayLightSecs;
+    return times;
+}
+
 // Binary record copy/skip plan used for append-only serialized data migrations.
 struct HydroBinaryDataReadPlan
 {
@@ -149,4 +194,1789 @@ inline HydroBinaryDataReadPlan hydroBinaryDataReadPlan(size_t serializedSize, si
     return {copyBytes, serializedRemaining - copyBytes};
 }
 
+// Activation tally for one accounting bucket.
+struct HydroActivationTally
+{
+    uint32_t onTimeMillis;                                  // Accumulated on-time, in milliseconds
+    uint16_t activations;                                   // Number of activations started
+    float energyWh;                                         // Accumulated energy usage, in watt-hours
+};
+
+// Rolling current/previous tally pair for one fixed-length accounting period.
+struct HydroActivationRollup
+{
+    uint32_t bucket;                                        // Current bucket # (local time secs / period)
+    HydroActivationTally current;                           // Tally of current (partial) period
+    HydroActivationTally previous;                          // Tally of last completed period (zeroed if period skipped)
+
+    // Rolls current over into previous once time moves into a different bucket.
+    inline void rollTo(uint32_t bucketIn) {
+        if (bucketIn != bucket) {
+            if (bucketIn == bucket + 1) { previous = current; } else { previous = {0, 0, 0.0f}; }
+            current = {0, 0, 0.0f};
+            bucket = bucketIn;
+        }
+    }
+};
+
+// Actuator activation journal: lifetime totals plus hourly, daily, and weekly rollups of
+// on-time, activation counts, and energy usage. Times passed in are local time secs, so
+// that day/week buckets line up with the local calendar. On-time is attributed to the
+// bucket current at accrual time, so callers should accrue at least once per update.
+struct HydroActivationJournal
+{
+    enum : uint32_t {
+        HourSecs = 3600u,                                   // Hourly rollup period, in seconds
+        DaySecs = 86400u,                                   // Daily rollup period, in seconds
+        WeekSecs = 604800u,                                 // Weekly rollup period, in seconds
+        WeekOffsetSecs = 259200u                            // Shifts 1970-01-01 (a Thursday) so that weeks start on Mondays
+    };
+
+    uint32_t lastTime;                                      // Last accrual time (local time secs), 0 if never
+    uint32_t totalActivations;                              // Lifetime activation count
+    uint32_t totalOnTimeSecs;                               // Lifetime on-time, in whole seconds
+    uint16_t totalOnTimeMillis;                             // Lifetime on-time remainder, in milliseconds [0,1000)
+    float totalEnergyWh;                                    // Lifetime energy usage, in watt-hours
+    HydroActivationRollup hourly;                           // Hourly rollup
+    HydroActivationRollup daily;                            // Daily rollup
+    HydroActivationRollup weekly;                           // Weekly rollup
+
+    inline HydroActivationJournal() { reset(); }
+
+    // Clears all totals and rollups.
+    inline void reset() {
+        lastTime = totalActivations = totalOnTimeSecs = 0; totalOnTimeMillis = 0; totalEnergyWh = 0.0f;
+        hourly.bucket = daily.bucket = weekly.bucket = 0;
+        hourly.current = hourly.previous = daily.current = daily.previous = weekly.current = weekly.previous = {0, 0, 0.0f};
+    }
+
+    // Rolls all rollups forward to time, so that stale current tallies read as empty.
+    inline void rollTo(uint32_t time) {
+        hourly.rollTo(time / HourSecs);
+        daily.rollTo(time / DaySecs);
+        weekly.rollTo((time + WeekOffsetSecs) / WeekSecs);
+        lastTime = time;
+    }
+
+    // Counts a new activation starting at time.
+    inline void countActivation(uint32_t time) {
+        rollTo(time);
+        ++totalActivations;
+        ++hourly.current.activations; ++daily.current.activations; ++weekly.current.activations;
+    }
+
+    // Accrues on-time (and energy, from power draw in watts) ending at time.
+    inline void accrue(uint32_t time, uint32_t onTimeMillis, float watts) {
+        rollTo(time);
+        const float energyWh = watts > 0.0f ? watts * (onTimeMillis / 3600000.0f) : 0.0f;
+        const uint32_t millisSum = (uint32_t)totalOnTimeMillis + (onTimeMillis % 1000u);
+        totalOnTimeSecs += (onTimeMillis / 1000u) + (millisSum / 1000u);
+        totalOnTimeMillis = (uint16_t)(millisSum % 1000u);
+        totalEnergyWh += energyWh;
+        hourly.current.onTimeMillis += onTimeMillis; hourly.current.energyWh += energyWh;
+        daily.current.onTimeMillis += onTimeMillis; daily.current.energyWh += energyWh;
+        weekly.current.onTimeMillis += onTimeMillis; weekly.current.energyWh += energyWh;
+    }
+
+    // Returns duty cycle [0,1] of the last completed hour.
+    inline float getLastHourDutyCycle() const { return hourly.previous.onTimeMillis / (HourSecs * 1000.0f); }
+    // Returns duty cycle [0,1] of the last completed day.
+    inline float getLastDayDutyCycle() const { return daily.previous.onTimeMillis / (DaySecs * 1000.0f); }
+    // Returns duty cycle [0,1] of the last completed week.
+    inline float getLastWeekDutyCycle() const { return weekly.previous.onTimeMillis / (WeekSecs * 1000.0f); }
+};
+
+// Fixed-size shared resource booking table, used to arbitrate resources (such as pumps and
+// reservoirs) between owners (such as feeding processes). A resource may only be booked by one
+// owner at a time, and owners book their entire resource set all-or-nothing.
+template<typename Key, size_t N>
+class HydroResourceBookings {
+public:
+    inline HydroResourceBookings() : _count(0) { ; }
+
+    // Returns true if none of the resources are booked by an owner other than owner.
+    bool isFree(Key owner, const Key *resources, size_t count) const {
+        for (size_t resIndex = 0; resIndex < count; ++resIndex) {
+            const Key bookedBy = getOwner(resources[resIndex], owner);
+            if (bookedBy != owner) { return false; }
+        }
+        return true;
+    }
+
+    // Books all resources to owner, returning false (and booking nothing) on conflict or lack of space.
+    bool book(Key owner, const Key *resources, size_t count) {
+        if (!isFree(owner, resources, count)) { return false; }
+        size_t needed = 0;
+        for (size_t resIndex = 0; resIndex < count; ++resIndex) {
+            if (!isBookedBy(resources[resIndex], owner) && !isRepeated(resources, resIndex)) { ++needed; }
+        }
+        if (_count + needed > N) { return false; }
+        for (size_t resIndex = 0; resIndex < count; ++resIndex) {
+            if (!isBookedBy(resources[resIndex], owner)) {
+                _bookings[_count].resource = resources[resIndex];
+                _bookings[_count].owner = owner;
+                ++_count;
+            }
+        }
+        return true;
+    }
+
+    // Releases all resources booked by owner.
+    void release(Key owner) {
+        for (size_t index = 0; index < _count;) {
+            if (_bookings[index].owner == owner) { _bookings[index] = _bookings[--_count]; }
+            else { ++index; }
+        }
+    }
+
+    // Returns owner of resource, else noOwner if unbooked.
+    Key getOwner(Key resource, Key noOwner) const {
+        for (size_t index = 0; index < _count; ++index) {
+            if (_bookings[index].resource == resource) { return _bookings[index].owner; }
+        }
+        return noOwner;
+    }
+
+    // Returns true if resource is booked by owner.
+    bool isBookedBy(Key resource, Key owner) const {
+        for (size_t index = 0; index < _count; ++index) {
+            if (_bookings[index].resource == resource) { return _bookings[index].owner == owner; }
+        }
+        return false;
+    }
+
+    // Returns true if owner has any resources booked.
+    bool hasBookings(Key owner) const {
+        for (size_t index = 0; index < _count; ++index) {
+            if (_bookings[index].owner == owner) { return true; }
+        }
+        return false;
+    }
+
+    inline size_t size() const { return _count; }
+
+protected:
+    struct Booking {
+        Key resource;                                       // Booked resource
+        Key owner;                                          // Owner resource is booked by
+    } _bookings[N];                                         // Bookings list
+    size_t _count;                                          // Number of bookings in list
+
+    static inline bool isRepeated(const Key *resources, size_t resIndex) {
+        for (size_t prevIndex = 0; prevIndex < resIndex; ++prevIndex) { if (resources[prevIndex] == resources[resIndex]) { return true; } }
+        return false;
+    }
+};
+
+// Fixed-capacity, allocation-free string formatter, for building log lines, topics, and
+// other short-lived strings on the stack instead of through heap allocated String temporaries.
+// Appends past capacity are truncated (flagged), and the string is always null terminated.
+template<size_t N>
+class HydroFixedString {
+public:
+    inline HydroFixedString() { clear(); }
+
+    HydroFixedString &append(const char *str) {
+        while (str && *str) { append(*str++); }
+        return *this;
+    }
+
+    HydroFixedString &append(char ch) {
+        if (_length + 1 < N) { _chars[_length++] = ch; _chars[_length] = '\0'; }
+        else { _truncated = true; }
+        return *this;
+    }
+
+    // Appends unsigned value, zero padded to at least minDigits.
+    HydroFixedString &appendUInt(uint32_t value, uint8_t minDigits = 1) {
+        char digits[10];
+        uint8_t count = 0;
+        do { digits[count++] = (char)('0' + (value % 10)); value /= 10; } while (value && count < 10);
+        while (count < minDigits && count < 10) { digits[count++] = '0'; }
+        while (count) { append(digits[--count]); }
+        return *this;
+    }
+
+    HydroFixedString &appendInt(int32_t value) {
+        if (value < 0) { append('-'); return appendUInt((uint32_t)0 - (uint32_t)value); }
+        return appendUInt((uint32_t)value);
+    }
+
+    // Appends float value rounded to decimals places (same "nan"/"inf"/"ovf" handling as Arduino's Print).
+    HydroFixedString &appendFloat(float value, uint8_t decimals = 2) {
+        if (isnan(value)) { return append("nan"); }
+        if (isinf(value)) { return append("inf"); }
+        if (value > 4294967040.0f || value < -4294967040.0f) { return append("ovf"); }
+        if (value < 0.0f) { append('-'); value = -value; }
+
+        float rounding = 0.5f;
+        for (uint8_t place = 0; place < decimals; ++place) { rounding /= 10.0f; }
+        value += rounding;
+
+        uint32_t whole = (uint32_t)value;
+        float remainder = value - (float)whole;
+        appendUInt(whole);
+        if (decimals) { append('.'); }
+        while (decimals--) {
+            remainder *= 10.0f;
+            uint8_t digit = (uint8_t)remainder;
+            append((char)('0' + digit));
+            remainder -= digit;
+        }
+        return *this;
+    }
+
+    // Appends YYYY-MM-DDThh:mm:ss timestamp (same format as DateTime's TIMESTAMP_FULL).
+    HydroFixedString &appendTimestamp(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second) {
+        appendUInt(year, 4).append('-').appendUInt(month, 2).append('-').appendUInt(day, 2);
+        return append('T').appendTime(hour, minute, second);
+    }
+
+    // Appends hh:mm:ss time of day (same format as DateTime's TIMESTAMP_TIME).
+    HydroFixedString &appendTime(uint8_t hour, uint8_t minute, uint8_t second) {
+        return appendUInt(hour, 2).append(':').appendUInt(minute, 2).append(':').appendUInt(second, 2);
+    }
+
+    // Appends time span as e.g. "1d 2h 5s", leaving out zero parts (same format as timeSpanToString).
+    HydroFixedString &appendTimeSpan(uint32_t seconds) {
+        const uint32_t parts[4] = { seconds / 86400U, (seconds / 3600U) % 24, (seconds / 60U) % 60, seconds % 60 };
+        const char units[4] = { 'd', 'h', 'm', 's' };
+        bool first = true;
+        for (uint8_t partIndex = 0; partIndex < 4; ++partIndex) {
+            if (parts[partIndex]) {
+                if (!first) { append(' '); }
+                appendUInt(parts[partIndex]).append(units[partIndex]);
+                first = false;
+            }
+        }
+        return *this;
+    }
+
+    // Replaces end of a truncated string with mark, so that its truncation shows when displayed.
+    HydroFixedString &markTruncation(const char *mark = "...") {
+        if (_truncated) {
+            size_t markLength = strlen(mark);
+            truncate(_length > markLength ? _length - markLength : 0);
+            while (*mark && _length + 1 < N) { _chars[_length++] = *mark++; }
+            _chars[_length] = '\0';
+        }
+        return *this;
+    }
+
+    // Shortens string to length, if longer.
+    inline void truncate(size_t length) { if (length < _length) { _length = length; _chars[_length] = '\0'; } }
+    inline void clear() { _length = 0; _chars[0] = '\0'; _truncated = false; }
+    inline const char *c_str() const { return _chars; }
+    inline size_t length() const { return _length; }
+    inline bool isTruncated() const { return _truncated; }
+
+protected:
+    char _chars[N];                                         // Null terminated character data
+    size_t _length;                                         // Current string length
+    bool _truncated;                                        // If any appends were truncated
+};
+
+// Page-buffered EEPROM access, over any device with I2C_eeprom's readBlock() and
+// updateBlockVerify() calls. Byte reads are served from an aligned read-ahead page filled in
+// one block read, and sequential byte writes are combined within a device page and flushed
+// as one verified block update (which also skips rewriting unchanged bytes).
+template<class Device, size_t N>
+class HydroEEPROMPageBuffer {
+public:
+    static_assert(N >= 2 && N <= 256 && !(N & (N - 1)), "EEPROM page buffer size must be a power of 2 within [2,256]");
+
+    inline HydroEEPROMPageBuffer(Device *device, uint32_t deviceSize, uint16_t pageSize)
+        : _device(device), _deviceSize(deviceSize), _pageSize(pageSize && pageSize < N ? pageSize : N),
+          _readBase(NoPage), _readLength(0), _writeBase(NoPage), _writeStart(0), _writeEnd(0) { ; }
+
+    // Reads byte at address through read-ahead page, else -1 on failure.
+    int read(uint32_t address) {
+        return fillReadPage(address) ? (int)_readPage[address - _readBase] : -1;
+    }
+
+    // Reads block through read-ahead pages, returning number of bytes read.
+    size_t readBlock(uint32_t address, uint8_t *buffer, size_t length) {
+        size_t retVal = 0;
+        while (retVal < length && fillReadPage(address)) {
+            size_t howMany = _readLength - (address - _readBase);
+            if (howMany > length - retVal) { howMany = length - retVal; }
+            for (size_t index = 0; index < howMany; ++index) { buffer[retVal++] = _readPage[address++ - _readBase]; }
+        }
+        return retVal;
+    }
+
+    // Writes byte at address into write-combining page, flushing the previous page's pending
+    // writes first if address isn't sequential within it. Returns false on flush failure.
+    bool write(uint32_t address, uint8_t data) {
+        if (address >= _deviceSize) { return false; }
+        uint32_t pageBase = address - (address % _pageSize);
+        if (_writeBase != pageBase || address < _writeBase + _writeStart || address > _writeBase + _writeEnd) {
+            if (!flush()) { return false; }
+            _writeBase = pageBase;
+            _writeStart = _writeEnd = (uint16_t)(address - pageBase);
+        }
+        uint16_t offset = (uint16_t)(address - pageBase);
+        _writePage[offset] = data;
+        if (offset == _writeEnd) { ++_writeEnd; }
+        if (_readBase != NoPage && address >= _readBase && address < _readBase + _readLength) { _readPage[address - _readBase] = data; }
+        return _writeBase + _writeEnd < _deviceSize && _writeEnd < _pageSize ? true : flush();
+    }
+
+    // Writes block through write-combining pages, returning number of bytes written.
+    size_t writeBlock(uint32_t address, const uint8_t *buffer, size_t length) {
+        size_t retVal = 0;
+        while (retVal < length && write(address++, buffer[retVal])) { ++retVal; }
+        return retVal;
+    }
+
+    // Flushes pending writes as one verified block update. Returns false on failure.
+    bool flush() {
+        bool retVal = true;
+        if (_writeEnd > _writeStart) {
+            retVal = _device->updateBlockVerify(_writeBase + _writeStart, &_writePage[_writeStart], _writeEnd - _writeStart);
+        }
+        _writeStart = _writeEnd = 0;
+        _writeBase = NoPage;
+        return retVal;
+    }
+
+    // Drops read-ahead page, e.g. after device was written to directly.
+    inline void invalidate() { _readBase = NoPage; _readLength = 0; }
+
+    inline bool hasPendingWrites() const { return _writeEnd > _writeStart; }
+    inline uint16_t getPageSize() const { return _pageSize; }
+
+protected:
+    enum : uint32_t { NoPage = 0xFFFFFFFFUL };
+
+    Device *_device;                                        // EEPROM device (strong)
+    uint32_t _deviceSize;                                   // Device size, in bytes
+    uint16_t _pageSize;                                     // Write page size, in bytes (device page size, up to N)
+    uint8_t _readPage[N];                                   // Read-ahead page data
+    uint32_t _readBase;                                     // Read-ahead page address, else NoPage
+    uint16_t _readLength;                                   // Read-ahead page valid length
+    uint8_t _writePage[N];                                  // Write-combining page data
+    uint32_t _writeBase;                                    // Write-combining page address, else NoPage
+    uint16_t _writeStart, _writeEnd;                        // Pending write range within page
+
+    bool fillReadPage(uint32_t address) {
+        if (_readBase != NoPage && address >= _readBase && address < _readBase + _readLength) { return true; }
+        if (address >= _deviceSize) { return false; }
+        uint32_t pageBase = address & ~(uint32_t)(N - 1);
+        uint16_t length = (uint16_t)(_deviceSize - pageBase < N ? _deviceSize - pageBase : N);
+        if (hasPendingWrites() && _writeBase + _writeEnd > pageBase && _writeBase + _writeStart < pageBase + length && !flush()) { return false; }
+        if (_device->readBlock(pageBase, _readPage, length) != length) { invalidate(); return false; }
+        _readBase = pageBase;
+        _readLength = length;
+        return true;
+    }
+};
+
+// Updates CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) with a data byte.
+inline uint16_t hydroCRC16(uint16_t crc, uint8_t data)
+{
+    crc ^= (uint16_t)data << 8;
+    for (uint8_t bit = 0; bit < 8; ++bit) { crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1); }
+    return crc;
+}
+
+// Stored data generation header, preceding each generation's payload.
+struct HydroGenerationHeader
+{
+    uint32_t sequence;                                      // Generation sequence number (wraps)
+    uint16_t length;                                        // Payload length, in bytes
+    uint16_t crc;                                           // CRC-16 of sequence, length, and payload
+
+    enum : uint16_t { Magic = 0x4748, PackedSize = 10 };    // "HG" magic, little-endian packed size
+
+    void pack(uint8_t *bytesOut) const {
+        bytesOut[0] = (uint8_t)Magic; bytesOut[1] = (uint8_t)(Magic >> 8);
+        for (uint8_t index = 0; index < 4; ++index) { bytesOut[2 + index] = (uint8_t)(sequence >> (8 * index)); }
+        bytesOut[6] = (uint8_t)length; bytesOut[7] = (uint8_t)(length >> 8);
+        bytesOut[8] = (uint8_t)crc; bytesOut[9] = (uint8_t)(crc >> 8);
+    }
+    // Unpacks header, returning false if magic doesn't match.
+    bool unpack(const uint8_t *bytesIn) {
+        if ((uint16_t)(bytesIn[0] | (bytesIn[1] << 8)) != Magic) { return false; }
+        sequence = 0;
+        for (uint8_t index = 0; index < 4; ++index) { sequence |= (uint32_t)bytesIn[2 + index] << (8 * index); }
+        length = (uint16_t)(bytesIn[6] | (bytesIn[7] << 8));
+        crc = (uint16_t)(bytesIn[8] | (bytesIn[9] << 8));
+        return true;
+    }
+    // CRC seed covering sequence and length, to be continued over payload.
+    uint16_t crcSeed() const {
+        uint8_t bytes[PackedSize];
+        pack(bytes);
+        uint16_t retVal = 0xFFFF;
+        for (uint8_t index = 2; index < 8; ++index) { retVal = hydroCRC16(retVal, bytes[index]); }
+        return retVal;
+    }
+};
+
+// Returns if sequence a is newer than b, safe across sequence wrap.
+inline bool hydroIsNewerSequence(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) > 0;
+}
+
+// Wear-leveled, generational data storage over an EEPROM region, with any device having
+// I2C_eeprom's readBlock() and updateBlockVerify() calls. The region is split into equal
+// slots that successive saves rotate through, each a header plus payload. Payloads are
+// written before their header, so a torn write fails its CRC and the newest valid
+// generation (in another slot) remains the one that is loaded. Payloads too large for a
+// slot fall back to fewer, larger slots (see fallBack()), down to a single slot (which has
+// no rotation), with generations found at any slot layout's slot boundaries.
+template<class Device>
+class HydroEEPROMGenerations {
+public:
+    inline HydroEEPROMGenerations(Device *device, uint32_t regionAddress, uint32_t regionSize, uint8_t maxSlotCount)
+        : _device(device), _regionAddress(regionAddress), _maxSlotCount(maxSlotCount ? maxSlotCount : 1),
+          _slotCount(maxSlotCount ? maxSlotCount : 1), _unitSize(regionSize / (maxSlotCount ? maxSlotCount : 1)) { ; }
+
+    // Finds newest generation with a valid CRC, under any slot layout, returning its slot index
+    // as of the most slots layout (and header), else -1.
+    int findNewest(HydroGenerationHeader *headerOut = nullptr) {
+        int retVal = -1;
+        HydroGenerationHeader newest = {0, 0, 0};
+        for (uint8_t unit = 0; unit < _maxSlotCount; ++unit) {
+            HydroGenerationHeader header;
+            if (readHeader(unit, header) && (retVal == -1 || hydroIsNewerSequence(header.sequence, newest.sequence)) &&
+                payloadCRC(getUnitAddress(unit) + HydroGenerationHeader::PackedSize, header) == header.crc) {
+                retVal = unit;
+                newest = header;
+            }
+        }
+        if (headerOut && retVal != -1) { *headerOut = newest; }
+        return retVal;
+    }
+
+    // Returns slot to write next generation into (the slot after newest's), along with its sequence,
+    // first falling back to fewer slots should newest not fit inside a slot of the current layout.
+    // The first generation goes into the last slot, away from any legacy unversioned data that
+    // starts at the region address, which then stays loadable should that first save not finish.
+    int nextSlot(uint32_t *sequenceOut) {
+        HydroGenerationHeader newest;
+        int newestUnit = findNewest(&newest);
+        if (sequenceOut) { *sequenceOut = newestUnit != -1 ? newest.sequence + 1 : 1; }
+        if (newestUnit == -1) { return _slotCount - 1; }
+        while (getUnitAddress(newestUnit) + HydroGenerationHeader::PackedSize + newest.length >
+               getSlotAddress(newestUnit / getUnitsPerSlot() + 1) && fallBack()) { ; }
+        return (newestUnit / getUnitsPerSlot() + 1) % _slotCount;
+    }
+
+    // Falls back to the next fewer slots layout (slot count still dividing max slot count), for
+    // payloads overflowing current slot capacity. Returns false if already down to a single slot.
+    bool fallBack() {
+        if (_slotCount <= 1) { return false; }
+        do { --_slotCount; } while (_maxSlotCount % _slotCount);
+        return true;
+    }
+
+    // Commits a generation whose payload has already been written to slot, computing its CRC
+    // from the payload as read back and then writing its header. Returns success.
+    bool commit(uint8_t slot, uint32_t sequence, uint16_t length) {
+        if (slot >= _slotCount || length > getPayloadCapacity()) { return false; }
+        HydroGenerationHeader header = {sequence, length, 0};
+        header.crc = payloadCRC(getPayloadAddress(slot), header);
+        uint8_t bytes[HydroGenerationHeader::PackedSize];
+        header.pack(bytes);
+        return _device->updateBlockVerify(getSlotAddress(slot), bytes, HydroGenerationHeader::PackedSize);
+    }
+
+    inline uint32_t getSlotAddress(uint8_t slot) const { return getUnitAddress(slot * getUnitsPerSlot()); }
+    inline uint32_t getPayloadAddress(uint8_t slot) const { return getSlotAddress(slot) + HydroGenerationHeader::PackedSize; }
+    inline uint32_t getPayloadCapacity() const { return getSlotSize() > HydroGenerationHeader::PackedSize ? getSlotSize() - HydroGenerationHeader::PackedSize : 0; }
+    // Payload address of generation found by findNewest(), by its returned slot index.
+    inline uint32_t getNewestPayloadAddress(uint8_t newestSlot) const { return getUnitAddress(newestSlot) + HydroGenerationHeader::PackedSize; }
+    inline uint8_t getSlotCount() const { return _slotCount; }
+    inline uint8_t getMaxSlotCount() const { return _maxSlotCount; }
+
+protected:
+    Device *_device;                                        // EEPROM device (strong)
+    uint32_t _regionAddress;                                // Region start address
+    uint8_t _maxSlotCount;                                  // Max number of generation slots
+    uint8_t _slotCount;                                     // Number of generation slots in current layout
+    uint32_t _unitSize;                                     // Slot size at max slot count (header and payload), in bytes
+
+    inline uint8_t getUnitsPerSlot() const { return _maxSlotCount / _slotCount; }
+    inline uint32_t getSlotSize() const { return _unitSize * getUnitsPerSlot(); }
+    inline uint32_t getUnitAddress(uint8_t unit) const { return _regionAddress + (uint32_t)unit * _unitSize; }
+
+    bool readHeader(uint8_t unit, HydroGenerationHeader &headerOut) {
+        uint8_t bytes[HydroGenerationHeader::PackedSize];
+        return _device->readBlock(getUnitAddress(unit), bytes, HydroGenerationHeader::PackedSize) == HydroGenerationHeader::PackedSize &&
+               headerOut.unpack(bytes) && (uint32_t)headerOut.length + HydroGenerationHeader::PackedSize <= (uint32_t)(_maxSlotCount - unit) * _unitSize;
+    }
+
+    uint16_t payloadCRC(uint32_t payloadAddress, const HydroGenerationHeader &header) {
+        uint16_t crc = header.crcSeed();
+        uint8_t chunk[32];
+        for (uint32_t offset = 0; offset < header.length;) {
+            uint16_t howMany = (uint16_t)(header.length - offset < sizeof(chunk) ? header.length - offset : sizeof(chunk));
+            if (_device->readBlock(payloadAddress + offset, chunk, howMany) != howMany) { return (uint16_t)~header.crc; }
+            for (uint16_t index = 0; index < howMany; ++index) { crc = hydroCRC16(crc, chunk[index]); }
+            offset += howMany;
+        }
+        return crc;
+    }
+};
+
+// Save target sequence of a snapshot written out a record at a time: its target, then its
+// fallback, skipping disabled ones. A target that fails to open or write is moved past, and the
+// snapshot counts as saved once any one target has been fully written and closed successfully.
+template<typename Target, Target Disabled>
+class HydroSaveSequence {
+public:
+    inline HydroSaveSequence() : _targets{Disabled, Disabled}, _target(2), _recordCount(0), _recordIndex(0), _saved(false) { ; }
+
+    // Starts sequence over target then fallback, each to be written recordCount records.
+    void begin(Target target, Target fallback, uint16_t recordCount) {
+        _targets[0] = target; _targets[1] = fallback;
+        _target = 0; _recordCount = recordCount; _recordIndex = 0; _saved = false;
+        if (target == Disabled) { nextTarget(); }
+    }
+
+    // Rewinds current target to its first record (e.g. to rewrite it with a different layout).
+    inline void restartTarget() { _recordIndex = 0; }
+    // Advances past record just written to current target.
+    inline void recordWritten() { if (_recordIndex < _recordCount) { ++_recordIndex; } }
+    // Finishes current target (successfully if fully written and closed), moving on to next.
+    inline void targetFinished(bool success) { _saved = _saved || success; nextTarget(); }
+
+    inline Target getTarget() const { return _target < 2 ? _targets[_target] : Disabled; }
+    inline uint16_t getRecordCount() const { return _recordCount; }
+    inline uint16_t getRecordIndex() const { return _recordIndex; }
+    inline bool isTargetWritten() const { return _recordIndex >= _recordCount; }
+    inline bool isFinished() const { return _target >= 2; }
+    inline bool isSaved() const { return _saved; }
+
+protected:
+    Target _targets[2];                                     // Target and fallback
+    uint8_t _target;                                        // Index of current target, 2 once finished
+    uint16_t _recordCount;                                  // Number of records to write per target
+    uint16_t _recordIndex;                                  // Index of next record to write to current target
+    bool _saved;                                            // If any target has been fully written
+
+    void nextTarget() {
+        _recordIndex = 0;
+        do { ++_target; } while (_target < 2 && _targets[_target] == Disabled);
+    }
+};
+
+// Reference counted pool of open file handles, keyed by file name and access mode. Released
+// handles stay open for reuse until idle past a timeout, or until evicted (least recently used
+// first) to make room for another file. Opening and closing is left to the caller.
+template<class Handle, size_t N, size_t NameSize = 32>
+class HydroHandlePool {
+public:
+    inline HydroHandlePool() { for (size_t slot = 0; slot < N; ++slot) { _entries[slot].open = false; _entries[slot].refs = 0; } }
+
+    // Looks up an already open handle for name and mode, adding a reference, else -1.
+    int acquire(const char *name, bool write, uint32_t now) {
+        int slot = find(name, write);
+        if (slot != -1 && _entries[slot].refs < 0xFF) {
+            _entries[slot].refs++;
+            _entries[slot].lastUse = now;
+            return slot;
+        }
+        return -1;
+    }
+
+    // Claims a slot for opening name and mode into, with one reference: an unused slot, else the least
+    // recently used idle one (evictOut set, its handle still open and to be closed first), else -1.
+    int claim(const char *name, bool write, uint32_t now, bool *evictOut = nullptr) {
+        int retVal = -1;
+        if (evictOut) { *evictOut = false; }
+        if (!name || strlen(name) >= NameSize) { return retVal; }
+        for (size_t slot = 0; slot < N; ++slot) {
+            const Entry &entry = _entries[slot];
+            if (!entry.open) { retVal = (int)slot; break; }
+            if (!entry.refs && (retVal == -1 || (int32_t)(entry.lastUse - _entries[retVal].lastUse) < 0)) { retVal = (int)slot; }
+        }
+        if (evictOut) { *evictOut = retVal != -1 && _entries[retVal].open; }
+        if (retVal != -1) {
+            Entry &entry = _entries[retVal];
+            entry.name.clear(); entry.name.append(name);
+            entry.write = write;
+            entry.refs = 1;
+            entry.lastUse = now;
+            entry.open = true;
+        }
+        return retVal;
+    }
+
+    // Drops a reference, leaving handle open for reuse.
+    inline void release(int slot, uint32_t now) {
+        if (slot >= 0 && slot < (int)N && _entries[slot].refs) { _entries[slot].refs--; _entries[slot].lastUse = now; }
+    }
+
+    // Returns an open slot that has been idle (unreferenced) for at least timeout, else -1.
+    int nextExpired(uint32_t now, uint32_t timeout) const {
+        for (size_t slot = 0; slot < N; ++slot) {
+            const Entry &entry = _entries[slot];
+            if (entry.open && !entry.refs && hydroHasElapsed(now, entry.lastUse, timeout)) { return (int)slot; }
+        }
+        return -1;
+    }
+
+    // Marks slot as closed, once caller has closed its handle.
+    inline void drop(int slot) { if (slot >= 0 && slot < (int)N) { _entries[slot].open = false; _entries[slot].refs = 0; } }
+
+    // Returns open slot for name (in either mode), else -1.
+    int find(const char *name) const { int retVal = find(name, false); return retVal != -1 ? retVal : find(name, true); }
+    int find(const char *name, bool write) const {
+        for (size_t slot = 0; slot < N; ++slot) {
+            const Entry &entry = _entries[slot];
+            if (entry.open && entry.write == write && strcmp(entry.name.c_str(), name) == 0) { return (int)slot; }
+        }
+        return -1;
+    }
+    // Returns slot holding handle, else -1.
+    int indexOf(const Handle *handle) const {
+        for (size_t slot = 0; slot < N; ++slot) { if (_entries[slot].open && &_entries[slot].handle == handle) { return (int)slot; } }
+        return -1;
+    }
+
+    inline Handle &operator[](int slot) { return _entries[slot].handle; }
+    inline bool isOpen(int slot) const { return slot >= 0 && slot < (int)N && _entries[slot].open; }
+    inline bool isWrite(int slot) const { return isOpen(slot) && _entries[slot].write; }
+    inline uint8_t getRefCount(int slot) const { return isOpen(slot) ? _entries[slot].refs : 0; }
+    size_t getOpenCount() const { size_t retVal = 0; for (size_t slot = 0; slot < N; ++slot) { retVal += _entries[slot].open; } return retVal; }
+
+protected:
+    struct Entry {
+        Handle handle;                                      // Open handle
+        HydroFixedString<NameSize> name;                    // File name
+        uint32_t lastUse;                                   // Last acquire/release time
+        uint8_t refs;                                       // Outstanding references
+        bool write;                                         // If opened for writing
+        bool open;                                          // If slot holds an open handle
+    } _entries[N];                                          // Pool entries
+};
+
+// Log-structured data store segment layout. Segments are fixed-size, append-only files of a
+// header, fixed-size records (a timestamp then column values) in timestamp order, and, once
+// the segment is full, a sparse index footer holding every indexStride'th record's timestamp.
+struct HydroSegmentLayout {
+    uint32_t segmentSize;                                   // Maximum segment file size, in bytes
+    uint16_t columnCount;                                   // Values per record
+    uint16_t indexEntries;                                  // Sparse index footer entries
+
+    enum : uint16_t { Magic = 0x5348, HeaderSize = 8 };     // "HS" magic, packed header size
+
+    inline uint16_t getRecordSize() const { return (uint16_t)(sizeof(uint32_t) * (1 + columnCount)); }
+    inline uint32_t getRecordCapacity() const {
+        uint32_t overhead = HeaderSize + sizeof(uint32_t) * indexEntries;
+        return segmentSize > overhead ? (segmentSize - overhead) / getRecordSize() : 0;
+    }
+    inline uint32_t getIndexStride() const {
+        uint32_t capacity = getRecordCapacity();
+        return indexEntries && capacity > indexEntries ? (capacity + indexEntries - 1) / indexEntries : 1;
+    }
+    inline uint32_t getRecordOffset(uint32_t record) const { return HeaderSize + record * getRecordSize(); }
+    inline uint32_t getIndexOffset() const { return getRecordOffset(getRecordCapacity()); }
+    // Returns number of whole records held by a segment file of fileSize bytes.
+    inline uint32_t getRecordCount(uint32_t fileSize) const {
+        uint32_t retVal = fileSize > HeaderSize ? (fileSize - HeaderSize) / getRecordSize() : 0;
+        return retVal < getRecordCapacity() ? retVal : getRecordCapacity();
+    }
+
+    void packHeader(uint8_t *bytesOut) const {
+        bytesOut[0] = (uint8_t)Magic; bytesOut[1] = (uint8_t)(Magic >> 8);
+        bytesOut[2] = (uint8_t)columnCount; bytesOut[3] = (uint8_t)(columnCount >> 8);
+        bytesOut[4] = (uint8_t)indexEntries; bytesOut[5] = (uint8_t)(indexEntries >> 8);
+        bytesOut[6] = bytesOut[7] = 0;
+    }
+    // Unpacks column count and index entries from header, returning false if magic doesn't match.
+    bool unpackHeader(const uint8_t *bytesIn) {
+        if ((uint16_t)(bytesIn[0] | (bytesIn[1] << 8)) != Magic) { return false; }
+        columnCount = (uint16_t)(bytesIn[2] | (bytesIn[3] << 8));
+        indexEntries = (uint16_t)(bytesIn[4] | (bytesIn[5] << 8));
+        return true;
+    }
+};
+
+// Returns record to begin a timestamp scan from, given a segment's sparse index entries (in
+// timestamp order, with unwritten entries left 0), so that a range query only reads a stride.
+inline uint32_t hydroSparseIndexSeek(const uint32_t *entries, uint16_t count, uint32_t stride, uint32_t timestamp)
+{
+    uint16_t low = 0, high = count; // first entry that is unwritten or past timestamp
+    while (low < high) {
+        uint16_t mid = (uint16_t)((low + high) / 2);
+        if (entries[mid] && entries[mid] <= timestamp) { low = (uint16_t)(mid + 1); }
+        else { high = mid; }
+    }
+    return low ? (uint32_t)(low - 1) * stride : 0;
+}
+
+// Ring of consecutively numbered segments, oldest to newest, bounded in count by a byte budget.
+// Stored as a sequence numbered, CRC checked record alternated between two files, so that the
+// ring stays loadable from the other file should a ring write not finish.
+struct HydroSegmentRing {
+    uint32_t first;                                         // Oldest segment number
+    uint32_t count;                                         // Number of live segments
+
+    enum : uint16_t { PackedSize = 14 };                    // Little-endian packed record size
+
+    inline uint32_t getNewest() const { return first + count - 1; }
+
+    // Packs ring record with its save sequence number.
+    void pack(uint32_t sequence, uint8_t *bytesOut) const {
+        for (uint8_t index = 0; index < 4; ++index) {
+            bytesOut[index] = (uint8_t)(first >> (8 * index));
+            bytesOut[4 + index] = (uint8_t)(count >> (8 * index));
+            bytesOut[8 + index] = (uint8_t)(sequence >> (8 * index));
+        }
+        uint16_t crc = 0xFFFF;
+        for (uint8_t index = 0; index < 12; ++index) { crc = hydroCRC16(crc, bytesOut[index]); }
+        bytesOut[12] = (uint8_t)crc; bytesOut[13] = (uint8_t)(crc >> 8);
+    }
+    // Unpacks ring record and its save sequence number, returning false if CRC doesn't match.
+    bool unpack(const uint8_t *bytesIn, uint32_t *sequenceOut) {
+        uint16_t crc = 0xFFFF;
+        for (uint8_t index = 0; index < 12; ++index) { crc = hydroCRC16(crc, bytesIn[index]); }
+        if ((uint16_t)(bytesIn[12] | (bytesIn[13] << 8)) != crc) { return false; }
+        first = count = *sequenceOut = 0;
+        for (uint8_t index = 0; index < 4; ++index) {
+            first |= (uint32_t)bytesIn[index] << (8 * index);
+            count |= (uint32_t)bytesIn[4 + index] << (8 * index);
+            *sequenceOut |= (uint32_t)bytesIn[8 + index] << (8 * index);
+        }
+        return first != 0;
+    }
+    // Adds a newest segment, expiring oldest ones past maxCount. Returns number expired, which
+    // the caller removes starting from the previous first segment number.
+    inline uint32_t push(uint32_t maxCount) {
+        uint32_t expired = ++count > maxCount ? count - maxCount : 0;
+        first += expired; count -= expired;
+        return expired;
+    }
+};
+
+// Returns ASCII character uppercased.
+inline char hydroUpperChar(char c) { return c >= 'a' && c <= 'z' ? (char)(c - ('a' - 'A')) : c; }
+
+// Returns YYMMDD date of a daily file named as prefix, YYMMDD, '.', then ext (see getYYMMDDFilename),
+// else -1. Compared case-insensitively, as FAT 8.3 names may be listed uppercased.
+inline int32_t hydroDayFilenameDate(const char *name, const char *prefix, const char *ext)
+{
+    for (; *prefix; ++prefix, ++name) { if (hydroUpperChar(*name) != hydroUpperChar(*prefix)) { return -1; } }
+    int32_t retVal = 0;
+    for (int digit = 0; digit < 6; ++digit, ++name) {
+        if (*name < '0' || *name > '9') { return -1; }
+        retVal = retVal * 10 + (*name - '0');
+    }
+    if (*name++ != '.') { return -1; }
+    for (; *ext; ++ext, ++name) { if (hydroUpperChar(*name) != hydroUpperChar(*ext)) { return -1; } }
+    return *name ? -1 : retVal;
+}
+
+// Bit pattern of the NaN marking a value as skipped in stored data rows (e.g. already sent), kept
+// distinct from the default NaN of values that are missing.
+#define HYDRO_SKIPPED_VALUE_BITS        0x7FC5C1D0UL
+
+// Returns value marked as skipped.
+inline float hydroSkippedValue() { uint32_t bits = HYDRO_SKIPPED_VALUE_BITS; float retVal; memcpy(&retVal, &bits, sizeof(retVal)); return retVal; }
+// Returns if value is marked as skipped (compared bitwise, as NaNs never compare equal).
+inline bool hydroIsSkippedValue(float value) { uint32_t bits; memcpy(&bits, &value, sizeof(bits)); return bits == HYDRO_SKIPPED_VALUE_BITS; }
+
+// Streaming rollup statistics of a data column over a time bucket: min, max, mean, and last.
+struct HydroRollupStats {
+    float minValue;                                         // Minimum value
+    float maxValue;                                         // Maximum value
+    float sum;                                              // Sum of values, for mean
+    float lastValue;                                        // Last value
+    uint16_t count;                                         // Number of values
+
+    inline void clear() { minValue = maxValue = sum = lastValue = 0.0f; count = 0; }
+    // Adds value (NaNs skipped).
+    inline void add(float value) {
+        if (isnan(value)) { return; }
+        if (!count || value < minValue) { minValue = value; }
+        if (!count || value > maxValue) { maxValue = value; }
+        sum += value; lastValue = value;
+        if (count < 0xFFFF) { ++count; }
+    }
+    inline float getMean() const { return count ? sum / count : 0.0f; }
+};
+
+// Returns start time of the period seconds long bucket that timestamp falls in.
+inline uint32_t hydroRollupBucket(uint32_t timestamp, uint32_t period)
+{
+    return period ? timestamp - timestamp % period : timestamp;
+}
+
+// Returns stored row column of a data column's rollup value, rollup rows holding valueCount
+// values (min, max, mean, and last) per data column.
+inline uint16_t hydroRollupColumn(uint16_t column, uint8_t value, uint8_t valueCount = 4)
+{
+    return (uint16_t)(column * valueCount + value);
+}
+
+// Compact JSON object payload of a timestamped data frame ({"t":timestamp,"column":value,...}, keyed
+// by column index), for publishing a frame as a single message. Columns not added (e.g. unchanged
+// under change-only publishing) are left out, so that NaN values, as null, stay distinguishable.
+template<size_t N>
+class HydroFramePayload {
+public:
+    inline void begin(uint32_t timestamp) { _chars.clear(); _chars.append("{\"t\":"); _chars.appendUInt(timestamp); }
+    inline void add(uint16_t column, float value, uint8_t decimals = 6) {
+        _chars.append(",\""); _chars.appendUInt(column); _chars.append("\":");
+        if (isnan(value)) { _chars.append("null"); }
+        else { _chars.appendFloat(value, decimals); }
+    }
+    // Ends payload, returning false if it did not fit.
+    inline bool end() { _chars.append('}'); return !_chars.isTruncated(); }
+
+    inline const char *c_str() const { return _chars.c_str(); }
+    inline size_t length() const { return _chars.length(); }
+
+protected:
+    HydroFixedString<N> _chars;                             // Payload characters
+};
+
+// Returns if a data column's value should be published under change-only publishing: when
+// it hasn't been yet (lastTime of 0), moves beyond deadband (any change at 0), changes to or
+// from NaN, or heartbeat seconds (0 for none) pass. Negative deadbands publish every frame.
+inline bool hydroShouldPublishValue(float value, float lastValue, uint32_t timestamp, uint32_t lastTime, float deadband, uint32_t heartbeat)
+{
+    if (deadband < 0.0f || !lastTime) { return true; }
+    if (heartbeat && timestamp - lastTime >= heartbeat) { return true; }
+    if (isnan(value) || isnan(lastValue)) { return isnan(value) != isnan(lastValue); }
+    return fabsf(value - lastValue) > deadband;
+}
+
+// Line protocol (InfluxDB style) batcher of data values, as "measurement,tag=value,... field=value
+// timestamp" lines (seconds timestamps, i.e. precision=s) packed into a fixed-size packet buffer.
+// Packets are sent through Transport's send(data, length) call once the next line won't fit, or
+// on flush(). While sends fail, the pending packet is kept for retry and new lines are dropped
+// (and counted) rather than blocking publishing.
+template<class Transport, size_t N>
+class HydroLineProtocolBatcher {
+public:
+    enum : size_t { LineSize = N < 128 ? N : 128 };        // Maximum line size, as built on stack
+
+    inline HydroLineProtocolBatcher(Transport &transport) : _transport(transport), _sentLength(0), _dropCount(0) { ; }
+
+    // Adds value line with tags (tagCount key/value pairs, empty values skipped), returning false if dropped.
+    bool addLine(const char *measurement, const char *const *tags, uint8_t tagCount, const char *field, float value, uint32_t timestamp) {
+        if (isnan(value) || isinf(value)) { return false; }
+        HydroFixedString<LineSize> line;
+        appendEscaped(line, measurement, false);
+        for (uint8_t tagIndex = 0; tagIndex + 1 < tagCount * 2; tagIndex += 2) {
+            if (tags[tagIndex + 1] && tags[tagIndex + 1][0]) {
+                line.append(',');
+                appendEscaped(line, tags[tagIndex], true);
+                line.append('=');
+                appendEscaped(line, tags[tagIndex + 1], true);
+            }
+        }
+        line.append(' ');
+        appendEscaped(line, field, true);
+        line.append('=').appendFloat(value, 6).append(' ').appendUInt(timestamp).append('\n');
+
+        if (line.isTruncated() || (_packet.length() + line.length() + 1 > N && !flush())) { ++_dropCount; return false; }
+        _packet.append(line.c_str());
+        return true;
+    }
+
+    // Sends pending packet, if any, returning false if it could not be sent in full (kept for retry, resuming
+    // past what was already sent). Transport's send returns the number of bytes it accepted.
+    bool flush() {
+        if (!_packet.length()) { return true; }
+        size_t sentLength = _transport.send(_packet.c_str() + _sentLength, _packet.length() - _sentLength);
+        _sentLength += sentLength < _packet.length() - _sentLength ? sentLength : _packet.length() - _sentLength;
+        if (_sentLength < _packet.length()) { return false; }
+        _packet.clear();
+        _sentLength = 0;
+        return true;
+    }
+
+    // Resends pending packet from its start on next flush (e.g. once a stream transport reconnects).
+    inline void restartPacket() { _sentLength = 0; }
+
+    inline size_t getPendingLength() const { return _packet.length(); }
+    inline size_t getSentLength() const { return _sentLength; }
+    inline uint32_t getDropCount() const { return _dropCount; }
+
+protected:
+    Transport &_transport;                                  // Packet transport
+    HydroFixedString<N> _packet;                            // Pending packet lines
+    size_t _sentLength;                                     // Length of pending packet already sent (partial send)
+    uint32_t _dropCount;                                    // Number of lines dropped
+
+    // Escapes commas and spaces (and equal signs, for keys/tag values) with backslashes.
+    template<size_t M>
+    static void appendEscaped(HydroFixedString<M> &line, const char *str, bool isKey) {
+        while (str && *str) {
+            if (*str == ',' || *str == ' ' || (isKey && *str == '=')) { line.append('\\'); }
+            line.append(*str++);
+        }
+    }
+};
+
+// Log argument, stored as given (string table id, object id, or number) for text expansion to be
+// deferred until read back. Text arguments are for anything not otherwise expressible.
+struct HydroLogArg
+{
+    enum : uint8_t { None, StringId, ObjectId, Number, Text } type; // Argument type
+    union {
+        uint16_t stringId;                                  // As string table id
+        struct { int8_t type, objType, posIndex; } object;  // As object id (type, object type, position index)
+        struct { float value; uint8_t decimals; } number;   // As number with decimal places
+        struct { const char *chars; uint8_t length; } text; // As text (not null terminated when read back)
+    } as;
+
+    inline HydroLogArg() : type(None) { as.stringId = 0; }
+    static inline HydroLogArg string(uint16_t stringId) { HydroLogArg arg; arg.type = StringId; arg.as.stringId = stringId; return arg; }
+    static inline HydroLogArg object(int8_t type, int8_t objType, int8_t posIndex) { HydroLogArg arg; arg.type = ObjectId; arg.as.object = {type, objType, posIndex}; return arg; }
+    static inline HydroLogArg number(float value, uint8_t decimals = 2) { HydroLogArg arg; arg.type = Number; arg.as.number = {value, decimals}; return arg; }
+    static inline HydroLogArg chars(const char *text) { HydroLogArg arg; arg.type = Text; size_t length = text ? strlen(text) : 0; arg.as.text = {text, (uint8_t)(length < 255 ? length : 255)}; return arg; }
+};
+
+// Binary log record: 1 byte record size (including itself), 1 byte log level, 4 byte local
+// timestamp (LE), then arguments, each a type byte followed by a 2 byte string id (LE), 3 byte
+// object id, 4 byte float (LE) and 1 byte decimals, or 1 byte length and text. Records are
+// read back with HydroLogRecordReader, and expanded (prefix by level, then argument texts
+// concatenated) on device or by tests/log_decode.py.
+template<size_t N>
+class HydroLogRecordWriter {
+public:
+    inline HydroLogRecordWriter() : _size(0), _truncated(false) { ; }
+
+    inline void begin(int8_t level, uint32_t timestamp) {
+        _size = 0; _truncated = false;
+        putByte(0); putByte((uint8_t)level);
+        putBytes((const uint8_t *)&timestamp, 4);
+    }
+    void add(const HydroLogArg &arg) {
+        switch (arg.type) {
+            case HydroLogArg::StringId:
+                if (!fits(3)) { return; }
+                putByte(arg.type); putBytes((const uint8_t *)&arg.as.stringId, 2);
+                break;
+            case HydroLogArg::ObjectId:
+                if (!fits(4)) { return; }
+                putByte(arg.type); putByte((uint8_t)arg.as.object.type); putByte((uint8_t)arg.as.object.objType); putByte((uint8_t)arg.as.object.posIndex);
+                break;
+            case HydroLogArg::Number:
+                if (!fits(6)) { return; }
+                putByte(arg.type); putBytes((const uint8_t *)&arg.as.number.value, 4); putByte(arg.as.number.decimals);
+                break;
+            case HydroLogArg::Text: {
+                if (!fits(2)) { return; }
+                uint8_t length = arg.as.text.length;
+                if (length > N - _size - 2) { length = (uint8_t)(N - _size - 2); _truncated = true; }
+                putByte(arg.type); putByte(length); putBytes((const uint8_t *)arg.as.text.chars, length);
+            } break;
+            default:
+                break;
+        }
+    }
+    // Ends record, returning false if any arguments were truncated or left out.
+    inline bool end() { _buffer[0] = (uint8_t)_size; return !_truncated; }
+
+    inline const uint8_t *data() const { return _buffer; }
+    inline size_t size() const { return _size; }
+
+protected:
+    static_assert(N >= 8 && N <= 255, "Record size must fit header and size byte");
+    uint8_t _buffer[N];                                     // Record bytes
+    size_t _size;                                           // Record size
+    bool _truncated;                                        // If any arguments were truncated or left out
+
+    inline bool fits(size_t size) { if (_size + size > N) { _truncated = true; return false; } return true; }
+    inline void putByte(uint8_t byte) { _buffer[_size++] = byte; }
+    inline void putBytes(const uint8_t *bytes, size_t size) { memcpy(&_buffer[_size], bytes, size); _size += size; } // LE platforms
+};
+
+// Binary log record reader, over one record's bytes (see HydroLogRecordWriter).
+class HydroLogRecordReader {
+public:
+    inline HydroLogRecordReader(const uint8_t *data, size_t size) : _data(data), _size(size), _offset(6) {
+        if (!_data || _size < 6 || _data[0] != _size) { _size = 0; }
+    }
+
+    inline bool isValid() const { return _size; }
+    inline int8_t getLevel() const { return (int8_t)_data[1]; }
+    inline uint32_t getTimestamp() const { uint32_t timestamp; memcpy(&timestamp, &_data[2], 4); return timestamp; }
+
+    // Reads next argument, returning false once done (or malformed).
+    bool next(HydroLogArg &argOut) {
+        if (_offset >= _size) { return false; }
+        argOut.type = (decltype(argOut.type))_data[_offset];
+        switch (argOut.type) {
+            case HydroLogArg::StringId:
+                if (_offset + 3 > _size) { break; }
+                memcpy(&argOut.as.stringId, &_data[_offset + 1], 2);
+                _offset += 3; return true;
+            case HydroLogArg::ObjectId:
+                if (_offset + 4 > _size) { break; }
+                argOut.as.object = {(int8_t)_data[_offset + 1], (int8_t)_data[_offset + 2], (int8_t)_data[_offset + 3]};
+                _offset += 4; return true;
+            case HydroLogArg::Number:
+                if (_offset + 6 > _size) { break; }
+                memcpy(&argOut.as.number.value, &_data[_offset + 1], 4);
+                argOut.as.number.decimals = _data[_offset + 5];
+                _offset += 6; return true;
+            case HydroLogArg::Text:
+                if (_offset + 2 > _size || _offset + 2 + _data[_offset + 1] > _size) { break; }
+                argOut.as.text = {(const char *)&_data[_offset + 2], _data[_offset + 1]};
+                _offset += 2 + argOut.as.text.length; return true;
+            default:
+                break;
+        }
+        _offset = _size;
+        return false;
+    }
+
+protected:
+    const uint8_t *_data;                                   // Record bytes
+    size_t _size;                                           // Record size, else 0 if invalid
+    size_t _offset;                                         // Next argument offset
+};
+
+// Binary log file header, preceding a log file's records. Identifies the string table that
+// record string ids index into, by string count and CRC-16 of all string texts (in id order,
+// each null terminated), so that decoding with a mismatched string table can be refused.
+struct HydroLogFileHeader
+{
+    uint16_t stringCount;                                   // Number of string table entries
+    uint16_t stringsCRC;                                    // CRC-16 of string table texts
+
+    enum : uint16_t { Magic = 0x4C48, PackedSize = 6 };     // "HL" magic, little-endian packed size
+
+    void pack(uint8_t *bytesOut) const {
+        bytesOut[0] = (uint8_t)Magic; bytesOut[1] = (uint8_t)(Magic >> 8);
+        bytesOut[2] = (uint8_t)stringCount; bytesOut[3] = (uint8_t)(stringCount >> 8);
+        bytesOut[4] = (uint8_t)stringsCRC; bytesOut[5] = (uint8_t)(stringsCRC >> 8);
+    }
+    // Unpacks header, returning false if magic doesn't match.
+    bool unpack(const uint8_t *bytesIn) {
+        if ((uint16_t)(bytesIn[0] | (bytesIn[1] << 8)) != Magic) { return false; }
+        stringCount = (uint16_t)(bytesIn[2] | (bytesIn[3] << 8));
+        stringsCRC = (uint16_t)(bytesIn[4] | (bytesIn[5] << 8));
+        return true;
+    }
+    // Updates string table CRC with one string's text (including its null terminator).
+    static inline uint16_t crcString(uint16_t crc, const char *text) {
+        do { crc = hydroCRC16(crc, (uint8_t)*text); } while (*text++);
+        return crc;
+    }
+};
+
+// Appends log argument text (as logged in text logs) to fixed string. String table ids and
+// object ids are expanded through resolver's appendString(out, stringId) and appendObject(out,
+// type, objType, posIndex) calls, so that log lines are assembled without String temporaries.
+template<size_t N, class Resolver>
+void hydroAppendLogArg(HydroFixedString<N> &out, const HydroLogArg &arg, const Resolver &resolver)
+{
+    switch (arg.type) {
+        case HydroLogArg::StringId:
+            resolver.appendString(out, arg.as.stringId);
+            break;
+        case HydroLogArg::ObjectId:
+            resolver.appendObject(out, arg.as.object.type, arg.as.object.objType, arg.as.object.posIndex);
+            break;
+        case HydroLogArg::Number:
+            out.appendFloat(arg.as.number.value, arg.as.number.decimals);
+            break;
+        case HydroLogArg::Text:
+            for (uint8_t charIndex = 0; charIndex < arg.as.text.length; ++charIndex) { out.append(arg.as.text.chars[charIndex]); }
+            break;
+        default:
+            break;
+    }
+}
+
+// Resolves log argument string ids and object ids into text (see hydroAppendLogArg), through
+// Strings' appendString(out, stringId) string table lookup and objectTypeStringId(type, objType)
+// lookup of an object type's name string id (negative if none). Objects read as HydroIdentity's
+// display string does, e.g. "Actuator GrowLights #1", with positions offset by posBegin.
+template<class Strings>
+class HydroLogArgResolver {
+public:
+    inline HydroLogArgResolver(const Strings &strings, int8_t posBegin, int8_t posCount)
+        : _strings(strings), _posBegin(posBegin), _posCount(posCount) { ; }
+
+    template<size_t N>
+    inline void appendString(HydroFixedString<N> &out, uint16_t stringId) const { _strings.appendString(out, stringId); }
+
+    template<size_t N>
+    void appendObject(HydroFixedString<N> &out, int8_t type, int8_t objType, int8_t posIndex) const {
+        switch (type) {
+            case 0: out.append("Actuator "); break;
+            case 1: out.append("Sensor "); break;
+            case 2: out.append("Crop "); break;
+            case 3: out.append("Reservoir "); break;
+            case 4: out.append("Rail "); break;
+            default: out.append("Unknown"); return;
+        }
+        int typeStringId = _strings.objectTypeStringId(type, objType);
+        if (typeStringId >= 0) { _strings.appendString(out, (uint16_t)typeStringId); }
+        out.append(" #");
+        if (posIndex >= 0 && posIndex < _posCount) { out.appendInt(posIndex + _posBegin); }
+    }
+
+protected:
+    Strings _strings;                                       // String table lookups
+    int8_t _posBegin;                                       // Displayed position offset (e.g. 1 for #1 being index 0)
+    int8_t _posCount;                                       // Position index count (indices past are left blank)
+};
+
+// Fixed-size set of changed item ids pending a rate-limited remote sync. Repeat changes to an
+// already pending id coalesce, so each item is sent once per batch with its latest value, and
+// batches are rate limited to at most one per send interval.
+template<size_t N>
+class HydroDeltaBatch {
+public:
+    inline HydroDeltaBatch() : _count(0), _lastSent(0), _hasSent(false), _coalesced(0) { ; }
+
+    // Adds a changed id, coalescing with any pending change. Returns false if full.
+    bool add(uint16_t id) {
+        for (size_t index = 0; index < _count; ++index) {
+            if (_ids[index] == id) { ++_coalesced; return true; }
+        }
+        if (_count >= N) { return false; }
+        _ids[_count++] = id;
+        return true;
+    }
+
+    // Returns if a batch is due: changes are pending and the interval since last send has elapsed.
+    inline bool isDue(uint32_t now, uint32_t interval) const { return _count && (!_hasSent || hydroHasElapsed(now, _lastSent, interval)); }
+
+    // Drops the first count (sent) ids, keeping the remainder in order for the next batch.
+    void consume(size_t count, uint32_t now) {
+        if (count > _count) { count = _count; }
+        for (size_t index = count; index < _count; ++index) { _ids[index - count] = _ids[index]; }
+        _count -= count;
+        _lastSent = now; _hasSent = true;
+    }
+    inline void clear() { _count = 0; }
+
+    inline size_t size() const { return _count; }
+    inline bool isEmpty() const { return !_count; }
+    inline uint16_t operator[](size_t index) const { return _ids[index]; }
+    // Number of changes absorbed into an already pending change.
+    inline uint32_t getCoalescedCount() const { return _coalesced; }
+
+protected:
+    uint16_t _ids[N];                                       // Pending changed ids, in change order
+    size_t _count;                                          // Number of pending ids
+    uint32_t _lastSent;                                     // Last batch send time, in millis
+    bool _hasSent;                                          // If a batch has been sent yet
+    uint32_t _coalesced;                                    // Absorbed changes counter
+};
+
+// Input event, as captured from an input interrupt.
+struct HydroInputEvent
+{
+    uint8_t source;                                         // Event source (key index, or encoder index)
+    int8_t value;                                           // Pressed (1) / released (0), or encoder detent step (-1/+1)
+    uint32_t time;                                          // Capture time, in millis
+};
+
+// Compiler barrier, keeping ring slot writes ordered before the index publishing them.
+#define HYDRO_COMPILER_BARRIER()        __asm__ __volatile__("" ::: "memory")
+
+// Single-producer (ISR), single-consumer (UI task) ring of input events. Lock free: only the
+// ISR advances head and only the UI task advances tail, with single byte indicies that are
+// atomic on all platforms. Events pushed while full are dropped and counted.
+template<size_t N>
+class HydroInputEventRing {
+public:
+    static_assert(N >= 2 && N <= 256 && !(N & (N - 1)), "Input event ring size must be a power of 2 within [2,256]");
+
+    inline HydroInputEventRing() : _head(0), _tail(0), _dropped(0) { ; }
+
+    // Pushes an event, from the ISR. Returns false if full.
+    bool push(const HydroInputEvent &event) {
+        uint8_t head = _head;
+        uint8_t next = (uint8_t)((head + 1) & (N - 1));
+        if (next == _tail) { _dropped = _dropped + 1; return false; }
+        _events[head] = event;
+        HYDRO_COMPILER_BARRIER();
+        _head = next;
+        return true;
+    }
+
+    // Pops the oldest event, from the UI task. Returns false if empty.
+    bool pop(HydroInputEvent &eventOut) {
+        uint8_t tail = _tail;
+        if (tail == _head) { return false; }
+        HYDRO_COMPILER_BARRIER();
+        eventOut = _events[tail];
+        HYDRO_COMPILER_BARRIER();
+        _tail = (uint8_t)((tail + 1) & (N - 1));
+        return true;
+    }
+
+    inline bool isEmpty() const { return _head == _tail; }
+    inline uint16_t getDroppedCount() const { return _dropped; }
+
+protected:
+    HydroInputEvent _events[N];                             // Event slots (N-1 usable)
+    volatile uint8_t _head;                                 // Next slot to write (ISR owned)
+    volatile uint8_t _tail;                                 // Next slot to read (UI task owned)
+    volatile uint16_t _dropped;                             // Dropped events counter
+};
+
+// Per-source edge debouncer, run from the ISR. A state change is accepted only once the
+// source's debounce time has elapsed since its last accepted change, collapsing contact
+// bounce into a single edge. Trailing edges swallowed as bounce are recovered by calling
+// again with the settled state (e.g. when the UI task drains).
+template<size_t Sources>
+class HydroEdgeDebouncer {
+public:
+    static_assert(Sources >= 1 && Sources <= 32, "Debouncer sources must be within [1,32]");
+
+    inline HydroEdgeDebouncer() : _states(0) { for (size_t source = 0; source < Sources; ++source) { _lastEdges[source] = 0; } }
+
+    // Returns true if state is an accepted change of source's debounced state.
+    bool accept(uint8_t source, bool state, uint32_t now, uint16_t debounceMillis) {
+        uint32_t bit = (uint32_t)1 << source;
+        if (((_states & bit) != 0) == state || !hydroHasElapsed(now, _lastEdges[source], debounceMillis)) { return false; }
+        _states ^= bit;
+        _lastEdges[source] = now;
+        return true;
+    }
+
+    inline bool getState(uint8_t source) const { return _states & ((uint32_t)1 << source); }
+
+protected:
+    uint32_t _states;                                       // Debounced states bitmask
+    uint32_t _lastEdges[Sources];                           // Last accepted change times, in millis
+};
+
+// Returns quadrature step (-1, 0, +1) for a transition between 2-bit AB encoder states, with
+// invalid (skipped) transitions taken as no step.
+inline int8_t hydroQuadratureStep(uint8_t prevAB, uint8_t currAB)
+{
+    static const int8_t steps[16] = { 0, 1, -1, 0, -1, 0, 0, 1, 1, 0, 0, -1, 0, -1, 1, 0 };
+    return steps[((prevAB & 3) << 2) | (currAB & 3)];
+}
+
+// Quadrature decoder, run from the ISR, accumulating steps into encoder detents.
+class HydroQuadratureDecoder {
+public:
+    inline HydroQuadratureDecoder(uint8_t stepsPerDetent = 4) : _prevAB(0), _steps(0), _stepsPerDetent(stepsPerDetent ? stepsPerDetent : 1) { ; }
+
+    // Sets the current AB state without stepping, e.g. upon attach.
+    inline void reset(uint8_t currAB) { _prevAB = currAB & 3; _steps = 0; }
+
+    // Updates from the current AB state, returning detent step (-1, 0, +1).
+    int8_t update(uint8_t currAB) {
+        _steps += hydroQuadratureStep(_prevAB, currAB);
+        _prevAB = currAB & 3;
+        if (_steps >= (int8_t)_stepsPerDetent) { _steps = 0; return 1; }
+        if (_steps <= -(int8_t)_stepsPerDetent) { _steps = 0; return -1; }
+        return 0;
+    }
+
+protected:
+    uint8_t _prevAB;                                        // Previous AB state
+    int8_t _steps;                                          // Accumulated steps since last detent
+    uint8_t _stepsPerDetent;                                // Steps per detent (4 full, 2 half, 1 quarter cycle)
+};
+
+// Fixed-size bump allocation arena, recycled all at once. Tracks the high water mark of use,
+// for sizing. Allocations are aligned relative to the arena's (8-byte aligned) start.
+template<size_t N>
+class HydroArena {
+public:
+    inline HydroArena() : _used(0), _highWater(0) { ; }
+
+    // Allocates size bytes at given power-of-2 alignment (up to 8), else nullptr if full.
+    void *allocate(size_t size, size_t align = sizeof(void *)) {
+        size_t offset = (_used + (align - 1)) & ~(align - 1);
+        if (offset > N || size > N - offset) { return nullptr; }
+        _used = offset + size;
+        if (_used > _highWater) { _highWater = _used; }
+        return &_buffer[offset];
+    }
+    inline void reset() { _used = 0; }
+
+    inline size_t getUsed() const { return _used; }
+    inline size_t getAvailable() const { return N - _used; }
+    inline size_t getHighWater() const { return _highWater; }
+    inline bool owns(const void *ptr) const { return (const uint8_t *)ptr >= _buffer && (const uint8_t *)ptr < _buffer + N; }
+
+protected:
+    alignas(8) uint8_t _buffer[N];                          // Arena storage
+    size_t _used;                                           // Bytes in use
+    size_t _highWater;                                      // Most bytes ever in use
+};
+
+// Coalescing set of invalidated UI fields (up to 32), taken once per UI tick. Repeat
+// invalidations of an already invalidated field are absorbed until the next take.
+class HydroFieldInvalidations {
+public:
+    inline HydroFieldInvalidations() : _mask(0), _coalesced(0) { ; }
+
+    inline void invalidate(uint8_t field) {
+        uint32_t bit = (uint32_t)1 << (field & 31);
+        if (_mask & bit) { ++_coalesced; }
+        _mask |= bit;
+    }
+    inline void invalidateMask(uint32_t mask) { _mask |= mask; }
+
+    inline bool isInvalidated(uint8_t field) const { return _mask & ((uint32_t)1 << (field & 31)); }
+    inline bool hasInvalidations() const { return _mask; }
+    // Returns invalidated fields mask, clearing it.
+    inline uint32_t take() { uint32_t mask = _mask; _mask = 0; return mask; }
+
+    // Number of invalidations absorbed into an already pending invalidation.
+    inline uint32_t getCoalescedCount() const { return _coalesced; }
+
+protected:
+    uint32_t _mask;                                         // Invalidated fields bitmask
+    uint32_t _coalesced;                                    // Absorbed invalidations counter
+};
+
+// Screen rectangle, for display dirty region tracking.
+struct HydroDirtyRect
+{
+    int16_t x, y;                                           // Top-left position, in pixels
+    int16_t w, h;                                           // Width and height, in pixels
+
+    inline int16_t right() const { return x + w; }
+    inline int16_t bottom() const { return y + h; }
+    inline int32_t area() const { return (int32_t)w * h; }
+    // Returns if rects overlap or share an edge (and so can be merged without covering extra area).
+    inline bool touches(const HydroDirtyRect &other) const { return x <= other.right() && other.x <= right() && y <= other.bottom() && other.y <= bottom(); }
+    // Returns if rects overlap.
+    inline bool overlaps(const HydroDirtyRect &other) const { return x < other.right() && other.x < right() && y < other.bottom() && other.y < bottom(); }
+    inline HydroDirtyRect unionWith(const HydroDirtyRect &other) const {
+        HydroDirtyRect retVal;
+        retVal.x = x < other.x ? x : other.x;
+        retVal.y = y < other.y ? y : other.y;
+        retVal.w = (right() > other.right() ? right() : other.right()) - retVal.x;
+        retVal.h = (bottom() > other.bottom() ? bottom() : other.bottom()) - retVal.y;
+        return retVal;
+    }
+};
+
+// Fixed-size set of dirty screen rects pending redraw. Touching rects are merged as they are
+// added, and once full, new rects merge into whichever existing rect grows the least.
+template<size_t N>
+class HydroDirtyRegion {
+public:
+    inline HydroDirtyRegion() : _count(0) { ; }
+
+    void add(HydroDirtyRect rect) {
+        if (rect.w <= 0 || rect.h <= 0) { return; }
+        for (size_t index = 0; index < _count;) {
+            if (_rects[index].touches(rect)) {
+                rect = rect.unionWith(_rects[index]);
+                _rects[index] = _rects[--_count];
+                index = 0; // merged rect may now touch others
+            } else { ++index; }
+        }
+        if (_count < N) { _rects[_count++] = rect; return; }
+
+        size_t bestIndex = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for (size_t index = 0; index < _count; ++index) {
+            int32_t growth = _rects[index].unionWith(rect).area() - _rects[index].area();
+            if (growth < bestGrowth) { bestGrowth = growth; bestIndex = index; }
+        }
+        _rects[bestIndex] = _rects[bestIndex].unionWith(rect);
+    }
+
+    // Returns if rect overlaps any dirty rect.
+    bool overlaps(const HydroDirtyRect &rect) const {
+        for (size_t index = 0; index < _count; ++index) {
+            if (_rects[index].overlaps(rect)) { return true; }
+        }
+        return false;
+    }
+
+    inline void clear() { _count = 0; }
+    inline size_t size() const { return _count; }
+    inline bool isEmpty() const { return !_count; }
+    inline const HydroDirtyRect &operator[](size_t index) const { return _rects[index]; }
+
+protected:
+    HydroDirtyRect _rects[N];                               // Dirty rects
+    size_t _count;                                          // Number of dirty rects
+};
+
+// Returns overview sky gradient's blue level for screen row y, where the sky lightens towards
+// the bottom of the screen by a band whose height tracks how high the sun is (skyBlue, 0-255).
+inline int hydroSkyBlueForRow(int y, int screenHeight, int skyBlue)
+{
+    int minBlue = skyBlue >> 2 > 10 ? skyBlue >> 2 : 10;
+    int maxBlue = skyBlue > 10 ? skyBlue : 10;
+    int rowBlue = y - (screenHeight - skyBlue - 10);
+    return rowBlue < minBlue ? minBlue : rowBlue > maxBlue ? maxBlue : rowBlue;
+}
+
+// Packed font glyph, as generated by tests/font_pack.py. Glyph data is either raw 1-bpp rows
+// (GFXfont bit order, rows not padded) or, if flagged, nibble run lengths: each row alternates
+// off/on runs starting with off, ending once the row's width is reached, where a 15 nibble
+// adds 15 to the current run and continues it. Nibbles are read high first, rows unpadded.
+struct HydroPackedGlyph
+{
+    char glyph;                                             // Glyph character
+    uint8_t width, height;                                  // Bitmap size, in pixels
+    uint8_t xAdvance;                                       // Cursor advance, in pixels
+    int8_t xOffset, yOffset;                                // Bitmap offset from baseline cursor, in pixels
+    uint8_t flags;                                          // Glyph flags (see HydroPackedGlyph_*)
+    uint16_t dataOffset;                                    // Offset into glyph data
+};
+#define HydroPackedGlyph_RLE            0x01                // Glyph data is nibble run length encoded
+
+// Sequential packed glyph row decoder. ReadByte is called with a data offset, such that data
+// can be read from PROGMEM, SRAM, or other storage.
+template<class ReadByte>
+class HydroGlyphRowDecoder {
+public:
+    inline HydroGlyphRowDecoder(const HydroPackedGlyph &glyph, ReadByte readByte) : _glyph(glyph), _read(readByte), _position(0) { ; }
+
+    // Decodes next row into on-pixel spans (start, length), returning number of spans (up to maxSpans).
+    uint8_t decodeRow(uint8_t *spanStarts, uint8_t *spanLengths, uint8_t maxSpans) {
+        uint8_t spanCount = 0;
+        uint8_t x = 0;
+        bool on = false;
+        while (x < _glyph.width) {
+            uint8_t run = 0;
+            if (_glyph.flags & HydroPackedGlyph_RLE) {
+                uint8_t nibble;
+                do { nibble = nextNibble(); run += nibble; } while (nibble == 15 && x + run < _glyph.width);
+            } else {
+                on = nextBit();
+                run = 1;
+                while (x + run < _glyph.width && peekBit() == on) { nextBit(); ++run; }
+            }
+            if (run > _glyph.width - x) { run = _glyph.width - x; }
+            if (!run && (on || x)) { break; } // malformed data, only leading off run may be empty
+            if (on && run && spanCount < maxSpans) {
+                spanStarts[spanCount] = x;
+                spanLengths[spanCount] = run;
+                ++spanCount;
+            }
+            x += run;
+            if (_glyph.flags & HydroPackedGlyph_RLE) { on = !on; }
+        }
+        return spanCount;
+    }
+
+protected:
+    const HydroPackedGlyph &_glyph;                         // Glyph being decoded
+    ReadByte _read;                                         // Data byte reader
+    uint32_t _position;                                     // Bit/nibble position in glyph data
+
+    inline bool peekBit() { return (_read(_glyph.dataOffset + (_position >> 3)) >> (7 - (_position & 7))) & 1; }
+    inline bool nextBit() { bool bit = peekBit(); ++_position; return bit; }
+    inline uint8_t nextNibble() { uint8_t value = _read(_glyph.dataOffset + (_position >> 1)); value = (_position & 1) ? value & 0x0F : value >> 4; ++_position; return value; }
+};
+
+#define HYDRO_GLYPH_MAXSPANS            16                  // Maximum on-pixel spans per packed glyph row
+
+// Blits a packed glyph with its baseline cursor at (x,y), scaled by mag, through fillRect(x, y,
+// w, h). Each on-pixel span becomes a single rect, and identical consecutive rows are merged
+// into taller rects, so large magnifications cost a handful of fills instead of one per pixel.
+template<class ReadByte, class FillRect>
+void hydroBlitPackedGlyph(const HydroPackedGlyph &glyph, ReadByte readByte, int x, int y, int mag, FillRect fillRect)
+{
+    uint8_t prevStarts[HYDRO_GLYPH_MAXSPANS], prevLengths[HYDRO_GLYPH_MAXSPANS], prevCount = 0;
+    uint8_t currStarts[HYDRO_GLYPH_MAXSPANS], currLengths[HYDRO_GLYPH_MAXSPANS], currCount;
+    int runStart = 0;
+    HydroGlyphRowDecoder<ReadByte> decoder(glyph, readByte);
+    x += glyph.xOffset * mag;
+    y += glyph.yOffset * mag;
+
+    for (int row = 0; row <= glyph.height; ++row) {
+        currCount = row < glyph.height ? decoder.decodeRow(currStarts, currLengths, HYDRO_GLYPH_MAXSPANS) : 0;
+        bool sameRow = row < glyph.height && row > 0 && currCount == prevCount;
+        for (uint8_t span = 0; sameRow && span < currCount; ++span) {
+            sameRow = currStarts[span] == prevStarts[span] && currLengths[span] == prevLengths[span];
+        }
+        if (!sameRow) {
+            for (uint8_t span = 0; span < prevCount; ++span) {
+                fillRect(x + prevStarts[span] * mag, y + runStart * mag, prevLengths[span] * mag, (row - runStart) * mag);
+            }
+            for (uint8_t span = 0; span < currCount; ++span) {
+                prevStarts[span] = currStarts[span];
+                prevLengths[span] = currLengths[span];
+            }
+            prevCount = currCount;
+            runStart = row;
+        }
+    }
+}
+
+// Fixed-arena LRU cache of short strings by key, for repeated string table lookups that
+// would otherwise hit slower backing storage (such as I2C EEPROM or SD card) each time.
+// Strings that don't fit inside of an entry (including null terminator) are not cached.
+template<size_t N, size_t EntrySize>
+class HydroStringCache {
+public:
+    inline HydroStringCache() { clear(); resetCounters(); }
+
+    // Returns cached string for key and marks it as most recently used, else nullptr on miss.
+    const char *lookup(int key) {
+        for (size_t index = 0; index < N; ++index) {
+            if (_keys[index] == key) {
+                _lastUsed[index] = ++_clock;
+                ++_hits;
+                return _entries[index];
+            }
+        }
+        ++_misses;
+        return nullptr;
+    }
+
+    // Stores string under key, evicting the least recently used entry. Returns false if too long to cache.
+    bool store(int key, const char *str, size_t length) {
+        if (key < 0 || length >= EntrySize) { return false; }
+        size_t storeIndex = 0; // empty entries have the oldest use stamps, so are taken first
+        for (size_t index = 0; index < N; ++index) {
+            if (_keys[index] == key) { storeIndex = index; break; }
+            if (_lastUsed[index] < _lastUsed[storeIndex]) { storeIndex = index; }
+        }
+        for (size_t charIndex = 0; charIndex < length; ++charIndex) { _entries[storeIndex][charIndex] = str[charIndex]; }
+        _entries[storeIndex][length] = '\0';
+        _keys[storeIndex] = key;
+        _lastUsed[storeIndex] = ++_clock;
+        return true;
+    }
+
+    inline void clear() { for (size_t index = 0; index < N; ++index) { _keys[index] = -1; _lastUsed[index] = 0; } _clock = 0; }
+    inline void resetCounters() { _hits = _misses = 0; }
+    inline uint32_t getHits() const { return _hits; }
+    inline uint32_t getMisses() const { return _misses; }
+
+protected:
+    char _entries[N][EntrySize];                            // Cached string arena, null terminated per entry
+    int16_t _keys[N];                                       // Cached string keys, else -1 for empty
+    uint32_t _lastUsed[N];                                  // Use clock stamps, for LRU eviction
+    uint32_t _clock;                                        // Use clock
+    uint32_t _hits;                                         // Lookup hit counter
+    uint32_t _misses;                                       // Lookup miss counter
+};
+
+// Planned process kind, for schedule timelines.
+enum HydroPlanProcessType : int8_t {
+    HydroPlanProcess_Feeding,                               // Feeding process
+    HydroPlanProcess_Lighting                               // Lighting process
+};
+
+// Planned process stage transition, for look-ahead schedule timelines.
+struct HydroPlanEntry
+{
+    uint32_t time;                                          // Planned transition time (unix/UTC)
+    uint32_t ownerKey;                                      // Owning process's feed reservoir key
+    int8_t processType;                                     // Process kind (HydroPlanProcessType)
+    int8_t stage;                                           // Process stage planned to be entered at time
+};
+
+// Fixed-size, time-ordered timeline of planned process stage transitions. Entries are kept
+// sorted on insert (stable for equal times), so stepping through only needs the next index.
+// A full timeline keeps its earliest entries, so that once stepped past its last entry, a
+// timeline that has dropped entries only needs replanned from there to cover the remainder.
+template<size_t N>
+class HydroPlanTimeline {
+public:
+    inline HydroPlanTimeline() : _count(0), _dropped(false) { ; }
+
+    // Inserts entry in time order, returning false if full (a full timeline keeps its earliest entries).
+    bool insert(const HydroPlanEntry &entry) {
+        size_t index = _count;
+        while (index > 0 && (int32_t)(_entries[index - 1].time - entry.time) > 0) { --index; }
+        if (index >= N) { _dropped = true; return false; }
+        size_t moveIndex = _count < N ? _count : N - 1;
+        for (; moveIndex > index; --moveIndex) { _entries[moveIndex] = _entries[moveIndex - 1]; }
+        _entries[index] = entry;
+        if (_count < N) { ++_count; return true; }
+        _dropped = true;
+        return false; // latest entry was dropped to make room
+    }
+
+    // Returns index of first entry at or after time, else -1 if none.
+    int nextIndex(uint32_t time) const {
+        size_t low = 0, high = _count;
+        while (low < high) {
+            size_t mid = (low + high) >> 1;
+            if ((int32_t)(_entries[mid].time - time) < 0) { low = mid + 1; } else { high = mid; }
+        }
+        return low < _count ? (int)low : -1;
+    }
+
+    inline void clear() { _count = 0; _dropped = false; }
+    inline size_t size() const { return _count; }
+    // Returns if any entries were dropped for lack of space since last clear (entries past last are incomplete).
+    inline bool hasDropped() const { return _dropped; }
+    inline const HydroPlanEntry &operator[](size_t index) const { return _entries[index]; }
+
+protected:
+    HydroPlanEntry _entries[N];                             // Time-ordered planned entries
+    size_t _count;                                          // Number of planned entries
+    bool _dropped;                                          // If entries were dropped for lack of space
+};
+
+// Intrusive timer wheel node, embedded inside of whatever object is being timed.
+struct HydroTimerWheelNode
+{
+    HydroTimerWheelNode *next;                              // Next node in filed list, else nullptr
+    HydroTimerWheelNode **prevNext;                         // Link pointing at this node, else nullptr when not filed
+    uint32_t expiry;                                        // Absolute expiry time, in wheel ticks
+    int8_t level;                                           // Wheel level node is filed under, else -1 for due list
+    void *owner;                                            // Owning object (weak)
+
+    inline HydroTimerWheelNode(void *ownerIn = nullptr) : next(nullptr), prevNext(nullptr), expiry(0), level(-1), owner(ownerIn) { ; }
+    inline bool isFiled() const { return prevNext != nullptr; }
+};
+
+// Hierarchical timer wheel made of 16-slot levels, each level spanning 16x the level below it.
+// Nodes are filed by how far away their expiry is, and cascade down a level each time the
+// wheel's time crosses their slot, until they land in the due list on their exact tick.
+// Expiries beyond the top level's span are parked in its farthest slot and re-filed on cascade.
+// Advancing jumps directly between wheel events, so idle spans cost nothing to skip over.
+template<uint8_t Levels = 4>
+class HydroTimerWheel {
+public:
+    static_assert(Levels >= 1 && Levels <= 7, "Timer wheel levels must be within [1,7]");
+    static const uint8_t SlotBits = 4;
+    static const uint8_t SlotCount = 1 << SlotBits;
+    static const uint8_t SlotMask = SlotCount - 1;
+
+    inline HydroTimerWheel(uint32_t time = 0) : _time(time), _due(nullptr), _slots{}, _counts{} { ; }
+    HydroTimerWheel(const HydroTimerWheel &) = delete;
+    HydroTimerWheel &operator=(const HydroTimerWheel &) = delete;
+
+    // Files node to expire at the passed absolute time, re-filing it if already filed
+    inline void insert(HydroTimerWheelNode *node, uint32_t expiry) { remove(node); node->expiry = expiry; file(node); }
+
+    // Removes node from the wheel, if filed
+    inline void remove(HydroTimerWheelNode *node)
+    {
+        if (node->isFiled()) {
+            if (node->next) { node->next->prevNext = node->prevNext; }
+            *node->prevNext = node->next;
+            if (node->level >= 0) { --_counts[node->level]; }
+            node->next = nullptr; node->prevNext = nullptr; node->level = -1;
+        }
+    }
+
+    // Advances wheel up to the passed time, moving any expired nodes into the due list
+    void advanceTo(uint32_t time)
+    {
+        uint32_t eventTime;
+        while ((int32_t)(time - _time) > 0) {
+            if (!nextSlotEventTime(eventTime) || (int32_t)(eventTime - time) > 0) {
+                _time = time;
+            } else {
+                _time = eventTime;
+                tick();
+            }
+        }
+    }
+
+    // Resets an empty wheel's time to the passed time, however far away (advancing cannot reach
+    // times more than 2^31 ticks ahead, which an idle wheel's time can fall behind by)
+    inline void resetTo(uint32_t time) { if (isEmpty()) { _time = time; } }
+
+    // Advances wheel up to the passed time and pops the next expired node, else nullptr
+    inline HydroTimerWheelNode *popExpired(uint32_t time)
+    {
+        advanceTo(time);
+        HydroTimerWheelNode *node = _due;
+        if (node) { remove(node); }
+        return node;
+    }
+
+    // Determines the next time the wheel needs advanced at, returning false if nothing is filed
+    inline bool nextEventTime(uint32_t &eventTime) const
+    {
+        if (_due) { eventTime = _time; return true; }
+        return nextSlotEventTime(eventTime);
+    }
+
+    inline bool isEmpty() const
+    {
+        if (_due) { return false; }
+        for (uint8_t level = 0; level < Levels; ++level) { if (_counts[level]) { return false; } }
+        return true;
+    }
+    inline uint32_t getTime() const { return _time; }
+
+protected:
+    uint32_t _time;                                         // Current wheel time, in ticks
+    HydroTimerWheelNode *_due;                              // Expired nodes list
+    HydroTimerWheelNode *_slots[Levels][SlotCount];         // Filed nodes lists, per level per slot
+    uint8_t _counts[Levels];                                // Filed node counts, per level
+
+    static inline void link(HydroTimerWheelNode **head, HydroTimerWheelNode *node)
+    {
+        node->next = *head;
+        if (*head) { (*head)->prevNext = &node->next; }
+        node->prevNext = head;
+        *head = node;
+    }
+
+    void file(HydroTimerWheelNode *node)
+    {
+        const uint32_t delta = node->expiry - _time;
+        if ((int32_t)delta <= 0) { node->level = -1; link(&_due, node); return; }
+
+        uint8_t level = 0;
+        while (level < Levels - 1 && delta >= (1UL << (SlotBits * (level + 1)))) { ++level; }
+        const uint8_t slot = delta >= (1UL << (SlotBits * (level + 1))) ? (uint8_t)(((_time >> (SlotBits * level)) - 1) & SlotMask) // parked in farthest slot
+                                                                         : (uint8_t)((node->expiry >> (SlotBits * level)) & SlotMask);
+        node->level = level;
+        link(&_slots[level][slot], node);
+        ++_counts[level];
+    }
+
+    // Earliest time a filed slot needs processed at, after current time
+    bool nextSlotEventTime(uint32_t &eventTime) const
+    {
+        bool found = false;
+        for (uint8_t level = 0; level < Levels; ++level) {
+            if (!_counts[level]) { continue; }
+            const uint8_t shift = SlotBits * level;
+            const uint8_t index = (uint8_t)((_time >> shift) & SlotMask);
+            for (uint8_t offset = 1; offset <= SlotCount; ++offset) {
+                if (_slots[level][(index + offset) & SlotMask]) {
+                    const uint32_t slotTime = ((_time >> shift) + offset) << shift;
+                    if (!found || (int32_t)(slotTime - eventTime) < 0) { eventTime = slotTime; found = true; }
+                    break;
+                }
+            }
+        }
+        return found;
+    }
+
+    // Processes current time, cascading upper levels down before expiring the lowest level's slot
+    void tick()
+    {
+        for (uint8_t level = Levels - 1; level >= 1; --level) {
+            const uint8_t shift = SlotBits * level;
+            if (!(_time & ((1UL << shift) - 1))) {
+                HydroTimerWheelNode *node = _slots[level][(_time >> shift) & SlotMask];
+                _slots[level][(_time >> shift) & SlotMask] = nullptr;
+                while (node) {
+                    HydroTimerWheelNode *next = node->next;
+                    --_counts[level];
+                    node->next = nullptr; node->prevNext = nullptr;
+                    file(node);
+                    node = next;
+                }
+            }
+        }
+
+        HydroTimerWheelNode *node = _slots[0][_time & SlotMask];
+        _slots[0][_time & SlotMask] = nullptr;
+        while (node) {
+            HydroTimerWheelNode *next = node->next;
+            --_counts[0];
+            node->level = -1;
+            link(&_due, node);
+            node = next;
+        }
+    }
+};
+
 #endif // /ifndef HydroCoreLogic_H
@@ -0,0 +1,115 @@
+/*  Hydruino: Simple automation controller for hydroponic grow systems.
+    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>
+    Hydruino Crops Library Table
+*/
+
+#ifndef HydroCropsLibTable_H
+#define HydroCropsLibTable_H
+
+#include <stdint.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+// Packed Crops Library Record
+// Compact fixed-point form of the built-in crop library data, expanded into a full
+// HydroCropsLibData upon checkout. Flags use the Hydro_CropsDataFlag bit values. The JSON
+// source these records are generated from is kept at tests/crops_lib.json, against which
+// the host tests check this table (see also CropLibExportToCPP).
+struct HydroCropsLibPacked {
+    char cropName[20];                                      // Name of crop (longest built-in name + null), else empty for no built-in data
+    uint8_t totalGrowWeeks;                                 // How long it takes to grow until harvestable, in weeks
+    uint8_t phaseDurationWeeks[3];                          // How many weeks each main crop phase lasts (seed,veg,bloom&>)
+    uint8_t dailyLightHours[3];                             // How many light hours per day is needed per main stages (seed,veg,bloom&>)
+    uint8_t flags;                                          // Crop data flags (Hydro_CropsDataFlag)
+    uint16_t phRange[2];                                    // Ideal pH range, in hundredths (min,max)
+    uint16_t tdsRange[2];                                   // Ideal EC range, in hundredths of mS/cm (min,max)
+    uint16_t nightlyFeedRate;                               // Nightly feed multiplier, in hundredths
+    int8_t waterTempRange[2];                               // Ideal water temperature range, in Celsius (min,max)
+    int8_t airTempRange[2];                                 // Ideal air temperature range, in Celsius (min,max)
+    uint16_t co2Levels[2];                                  // Ideal CO2 levels per <=veg/>=bloom stages, in PPM
+};
+
+// Built-in crops library table, indexed directly by Hydro_CropType (up to the custom crops).
+constexpr HydroCropsLibPacked hydroCropsLibTable[] PROGMEM = {
+    { "Aloe Vera",         52, { 4,24,24}, {16,14,14}, 0x19, {700,850}, {180,250}, 100, {20,24}, {20,28}, { 600, 700} }, // AloeVera
+    { "Anise",             12, { 2, 6, 4}, {16,14,14}, 0x00, {580,640}, { 90,140}, 100, {19,23}, {18,26}, { 600, 750} }, // Anise
+    { "Artichoke",         30, {10,12, 8}, {16,16,14}, 0x08, {650,750}, { 80,180}, 100, {18,23}, {16,26}, { 650, 800} }, // Artichoke
+    { "Arugula",            5, { 1, 3, 1}, {16,14,14}, 0x00, {600,750}, { 80,180}, 100, {18,22}, {16,23}, { 600, 700} }, // Arugula
+    { "Asparagus",         52, { 4,24,24}, {16,16,14}, 0x28, {600,680}, {140,180}, 100, {18,23}, {16,26}, { 650, 800} }, // Asparagus
+    { "Basil",              6, { 1, 4, 1}, {16,14,14}, 0x20, {550,600}, {100,160}, 100, {19,23}, {18,26}, { 600, 750} }, // Basil
+    { "Bean (common)",      8, { 1, 4, 3}, {16,16,14}, 0x20, {600,600}, {200,400}, 100, {18,22}, {18,25}, { 600, 800} }, // Bean
+    { "Bean (broad)",      14, { 2, 6, 6}, {16,16,14}, 0x20, {600,650}, {200,400}, 100, {18,22}, {18,25}, { 600, 800} }, // BeanBroad
+    { "Beetroot",           9, { 1, 6, 2}, {16,14,12}, 0x00, {600,650}, {180,250}, 100, {18,22}, {16,24}, { 600, 700} }, // Beetroot
+    { "Black Currant",     52, { 4,24,24}, {16,14,14}, 0x00, {550,650}, {140,180}, 100, {18,22}, {16,24}, { 600, 750} }, // BlackCurrant
+    { "Blueberry",         52, { 4,24,24}, {16,14,14}, 0x08, {400,500}, {180,200}, 100, {18,22}, {16,24}, { 600, 750} }, // Blueberry
+    { "Bok-choi",           6, { 1, 4, 1}, {16,14,14}, 0x00, {700,700}, {150,200}, 100, {18,22}, {16,23}, { 600, 700} }, // BokChoi
+    { "Broccoli",          14, { 5, 6, 3}, {16,14,14}, 0x00, {600,680}, {280,350}, 100, {18,22}, {16,23}, { 600, 700} }, // Broccoli
+    { "Brussels Sprouts",  19, { 5, 7, 7}, {16,14,14}, 0x00, {650,750}, {250,300}, 100, {18,22}, {16,23}, { 600, 700} }, // BrusselsSprout
+    { "Cabbage",           16, { 5, 7, 4}, {16,14,14}, 0x00, {650,700}, {250,300}, 100, {18,22}, {16,23}, { 600, 700} }, // Cabbage
+    { "Cannabis (generic)",16, { 2, 6, 8}, {18,18,12}, 0x04, {550,610}, {100,250}, 100, {20,23}, {20,28}, { 800,1000} }, // Cannabis
+    { "Capsicum",          18, { 8, 5, 5}, {18,16,14}, 0x00, {550,600}, { 80,180}, 100, {20,24}, {20,28}, { 700, 900} }, // Capsicum
+    { "Carrots",           10, { 1, 6, 3}, {16,14,12}, 0x00, {630,630}, {160,200}, 100, {18,22}, {16,24}, { 600, 700} }, // Carrots
+    { "Catnip",            10, { 2, 5, 3}, {16,14,14}, 0x00, {550,650}, {100,160}, 100, {19,23}, {18,26}, { 600, 750} }, // Catnip
+    { "Cauliflower",       16, { 5, 8, 3}, {16,14,14}, 0x00, {600,700}, { 50,200}, 100, {18,22}, {16,23}, { 600, 700} }, // Cauliflower
+    { "Celery",            27, {11,12, 4}, {16,14,14}, 0x00, {650,650}, {180,240}, 100, {18,22}, {16,23}, { 600, 700} }, // Celery
+    { "Chamomile",         10, { 2, 5, 3}, {16,14,14}, 0x10, {550,650}, {100,160}, 100, {19,23}, {18,26}, { 600, 750} }, // Chamomile
+    { "Chicory",           10, { 2, 5, 3}, {16,14,14}, 0x00, {550,600}, {200,240}, 100, {18,22}, {16,23}, { 600, 700} }, // Chicory
+    { "Chives",            10, { 2, 5, 3}, {16,14,14}, 0x18, {600,650}, {180,240}, 100, {18,22}, {16,24}, { 600, 700} }, // Chives
+    { "Cilantro",           9, { 1, 5, 3}, {16,14,14}, 0x00, {650,670}, {130,180}, 100, {18,22}, {16,24}, { 600, 700} }, // Cilantro
+    { "Coriander",         12, { 1, 6, 5}, {16,14,14}, 0x00, {580,640}, {120,180}, 100, {18,22}, {16,24}, { 600, 700} }, // Coriander
+    { "Corn (sweet)",      11, { 1, 6, 4}, {18,16,14}, 0x14, {580,650}, {160,240}, 100, {20,24}, {20,30}, { 700, 900} }, // CornSweet
+    { "Cucumber",          13, { 4, 4, 5}, {18,16,14}, 0x20, {500,550}, {170,200}, 100, {20,24}, {20,28}, { 700, 900} }, // Cucumber
+    { "Dill",               8, { 1, 4, 3}, {16,14,14}, 0x00, {550,640}, {100,160}, 100, {18,22}, {16,24}, { 600, 700} }, // Dill
+    { "Eggplant",          19, { 8, 6, 5}, {18,16,14}, 0x20, {600,600}, {250,350}, 100, {20,24}, {20,28}, { 700, 900} }, // Eggplant
+    { "Endive",            13, { 2, 8, 3}, {16,14,14}, 0x00, {550,550}, {200,240}, 100, {18,22}, {16,23}, { 600, 700} }, // Endive
+    { "Fennel",            12, { 2, 6, 4}, {16,14,14}, 0x08, {640,680}, {100,140}, 100, {19,23}, {18,26}, { 600, 750} }, // Fennel
+    { "Fodder",             4, { 1, 2, 1}, {16,14,12}, 0x00, {580,650}, {180,200}, 100, {18,22}, {16,24}, { 600, 700} }, // Fodder
+    { "Flowers (generic)", 16, { 2, 6, 8}, {18,16,14}, 0x30, {550,650}, {150,250}, 100, {19,23}, {18,26}, { 700, 900} }, // Flowers
+    { "Garlic",            24, { 3,10,11}, {16,14,12}, 0x18, {600,650}, {140,180}, 100, {18,22}, {16,24}, { 600, 700} }, // Garlic
+    { "Ginger",            40, { 4,24,12}, {16,14,12}, 0x00, {580,600}, {150,200}, 100, {20,24}, {20,28}, { 600, 750} }, // Ginger
+    { "Kale",               8, { 1, 5, 2}, {16,14,14}, 0x08, {550,650}, {125,150}, 100, {18,22}, {16,23}, { 600, 700} }, // Kale
+    { "Lavender",          16, { 2, 6, 8}, {16,14,14}, 0x18, {640,680}, {100,140}, 100, {19,23}, {18,26}, { 600, 750} }, // Lavender
+    { "Leek",              23, { 7,12, 4}, {16,14,12}, 0x10, {650,700}, {140,180}, 100, {18,22}, {16,24}, { 600, 700} }, // Leek
+    { "Lemon Balm",        12, { 2, 6, 4}, {16,14,14}, 0x08, {550,650}, {100,160}, 100, {19,23}, {18,26}, { 600, 750} }, // LemonBalm
+    { "Lettuce",            5, { 2, 2, 1}, {16,14,14}, 0x00, {600,700}, {120,180}, 100, {18,22}, {16,23}, { 600, 700} }, // Lettuce
+    { "Marrow",            12, { 2, 6, 4}, {18,16,14}, 0x00, {600,600}, {180,240}, 100, {20,24}, {20,28}, { 700, 900} }, // Marrow
+    { "Melon",             16, { 4, 6, 6}, {18,16,14}, 0x04, {550,600}, {200,250}, 100, {20,24}, {20,28}, { 700, 900} }, // Melon
+    { "Mint",              10, { 2, 5, 3}, {16,14,14}, 0x19, {550,600}, {200,240}, 100, {19,23}, {18,26}, { 600, 750} }, // Mint
+    { "Mustard Cress",      6, { 1, 3, 2}, {16,14,14}, 0x00, {600,650}, {120,240}, 100, {18,22}, {16,23}, { 600, 700} }, // MustardCress
+    { "Okra",               9, { 1, 5, 3}, {18,16,14}, 0x00, {650,650}, {200,240}, 100, {20,24}, {20,28}, { 700, 900} }, // Okra
+    { "Onions",            16, { 2, 6, 8}, {16,14,12}, 0x18, {600,670}, {140,180}, 100, {18,22}, {16,24}, { 600, 700} }, // Onions
+    { "Oregano",           12, { 2, 6, 4}, {16,14,14}, 0x18, {600,700}, {180,230}, 100, {19,23}, {18,26}, { 600, 750} }, // Oregano
+    { "Pak-choi",           6, { 1, 4, 1}, {16,14,14}, 0x00, {700,700}, {150,200}, 100, {18,22}, {16,23}, { 600, 700} }, // PakChoi
+    { "Parsley",           10, { 3, 5, 2}, {16,14,14}, 0x18, {600,650}, {180,220}, 100, {18,22}, {16,24}, { 600, 700} }, // Parsley
+    { "Parsnip",           16, { 2, 6, 8}, {16,14,12}, 0x00, {600,650}, {140,180}, 100, {18,22}, {16,24}, { 600, 700} }, // Parsnip
+    { "Pea (common)",       9, { 1, 5, 3}, {16,16,14}, 0x00, {600,700}, { 80,180}, 100, {18,22}, {18,25}, { 600, 800} }, // Pea
+    { "Pea (sugar)",        9, { 1, 5, 3}, {16,16,14}, 0x10, {600,680}, { 80,190}, 100, {18,22}, {18,25}, { 600, 800} }, // PeaSugar
+    { "Pepino",            16, { 2, 6, 8}, {18,16,14}, 0x00, {600,650}, {200,250}, 100, {20,24}, {20,28}, { 700, 900} }, // Pepino
+    { "Peppers (bell)",    18, { 8, 5, 5}, {18,16,14}, 0x20, {550,600}, { 80,180}, 100, {20,24}, {20,28}, { 700, 900} }, // PeppersBell
+    { "Peppers (hot)",     18, { 8, 5, 5}, {18,16,14}, 0x20, {550,600}, { 80,180}, 100, {20,24}, {20,28}, { 700, 900} }, // PeppersHot
+    { "Potato (common)",   16, { 2, 6, 8}, {16,14,12}, 0x08, {500,600}, {200,250}, 100, {18,22}, {16,24}, { 600, 700} }, // Potato
+    { "Potato (sweet)",    18, { 6, 8, 4}, {16,14,12}, 0x08, {500,600}, {200,250}, 100, {20,24}, {20,28}, { 600, 750} }, // PotatoSweet
+    { "Pumpkin",           19, { 4, 8, 7}, {18,16,14}, 0x24, {550,750}, {180,240}, 100, {20,24}, {20,28}, { 700, 900} }, // Pumpkin
+    { "Radish",             5, { 1, 2, 2}, {16,14,12}, 0x00, {600,700}, {160,220}, 100, {18,22}, {16,24}, { 600, 700} }, // Radish
+    { "Rhubarb",           52, { 4,24,24}, {16,14,14}, 0x18, {550,600}, {160,200}, 100, {18,22}, {16,24}, { 600, 750} }, // Rhubarb
+    { "Rosemary",          16, { 2, 6, 8}, {16,14,14}, 0x08, {550,600}, {100,160}, 100, {19,23}, {18,26}, { 600, 750} }, // Rosemary
+    { "Sage",              12, { 2, 6, 4}, {16,14,14}, 0x08, {550,650}, {100,160}, 100, {19,23}, {18,26}, { 600, 750} }, // Sage
+    { "Silverbeet",         8, { 1, 5, 2}, {16,14,14}, 0x00, {600,700}, {180,230}, 100, {18,22}, {16,23}, { 600, 700} }, // Silverbeet
+    { "Spinach",            6, { 1, 4, 1}, {16,14,14}, 0x00, {600,700}, {180,230}, 100, {18,22}, {16,23}, { 600, 700} }, // Spinach
+    { "Squash",            13, { 1, 7, 5}, {18,16,14}, 0x24, {500,650}, {180,240}, 100, {20,24}, {20,28}, { 700, 900} }, // Squash
+    { "Sunflower",         12, { 2, 6, 4}, {18,16,14}, 0x00, {550,650}, {120,180}, 100, {20,24}, {18,28}, { 700, 900} }, // Sunflower
+    { "Strawberries",      10, { 2, 4, 4}, {16,14,14}, 0x08, {600,600}, {180,220}, 100, {18,22}, {16,24}, { 600, 750} }, // Strawberries
+    { "Swiss Chard",        8, { 1, 5, 2}, {16,14,14}, 0x00, {600,650}, {180,230}, 100, {18,22}, {16,23}, { 600, 700} }, // SwissChard
+    { "Taro",              40, { 4,24,12}, {16,14,12}, 0x10, {500,550}, {250,300}, 100, {20,24}, {20,28}, { 600, 750} }, // Taro
+    { "Tarragon",          12, { 2, 6, 4}, {16,14,14}, 0x10, {550,650}, {100,180}, 100, {19,23}, {18,26}, { 600, 750} }, // Tarragon
+    { "Thyme",             12, { 2, 6, 4}, {16,14,14}, 0x08, {500,700}, { 80,160}, 100, {19,23}, {18,26}, { 600, 750} }, // Thyme
+    { "Tomato",            16, { 5, 5, 6}, {18,16,14}, 0x30, {600,650}, {200,400}, 100, {20,24}, {20,28}, { 700, 900} }, // Tomato
+    { "Turnip",             7, { 1, 4, 2}, {16,14,14}, 0x00, {600,650}, {180,240}, 100, {18,22}, {16,23}, { 600, 700} }, // Turnip
+    { "Watercress",         8, { 1, 4, 3}, {16,14,14}, 0x18, {650,680}, {150,200}, 100, {18,22}, {16,23}, { 600, 700} }, // Watercress
+    { "Watermelon",        17, { 4, 6, 7}, {18,16,14}, 0x04, {580,580}, {150,240}, 100, {20,24}, {20,28}, { 700, 900} }, // Watermelon
+    { "Zucchini",          11, { 4, 3, 4}, {18,16,14}, 0x04, {600,600}, {180,240}, 100, {20,24}, {20,28}, { 700, 900} }, // Zucchini
+};
+
+#endif // /ifndef HydroCropsLibTable_H
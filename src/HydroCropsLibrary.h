@@ -8,6 +8,7 @@
 
 class HydroCropsLibrary;
 struct HydroCropsLibraryBook;
+struct HydroCropsLibPacked;
 
 #include "Hydruino.h"
 
@@ -19,8 +20,9 @@ struct HydroCropsLibraryBook;
 // if using a temporary, otherwise this checkout/return system. The returned crop lib data
 // instance is guaranteed to stay unique for as long as it is allocated.
 // Unless the HYDRO_DISABLE_BUILTIN_DATA define is defined, all crop data is
-// internally stored as JSON strings in the Flash PROGMEM memory space. See the Data
-// Writer Example sketch on how to program an EEPROM or SD card with such data.
+// internally stored as a packed binary table in the Flash PROGMEM memory space, indexed
+// directly by crop type. See the Data Writer Example sketch on how to program an EEPROM
+// or SD card with such data.
 class HydroCropsLibrary {
 public:
     // Begins crops library from external SD card library, with specified file prefix and data format.
@@ -29,8 +31,8 @@ public:
     // Begins crops library from external EEPROM, with specified data begin address and data format.
     void beginCropsLibraryFromEEPROM(size_t dataAddress = 0, bool jsonFormat = false);
 
-    // Checks out the crop data for this crop from the library, created via the JSON from
-    // PROGMEM if needed (nullptr return -> failure). Increments crop data ref count by one.
+    // Checks out the crop data for this crop from the library, created via the packed table
+    // in PROGMEM if needed (nullptr return -> failure). Increments crop data ref count by one.
     const HydroCropsLibData *checkoutCropsData(Hydro_CropType cropType);
 
     // Returns crop data back to the library, to delete when no longer used. Decrements crop
@@ -72,6 +74,7 @@ struct HydroCropsLibraryBook {
     HydroCropsLibraryBook(String jsonStringIn);
     HydroCropsLibraryBook(Stream &streamIn, bool jsonFormat);
     HydroCropsLibraryBook(const HydroCropsLibData &dataIn);
+    HydroCropsLibraryBook(Hydro_CropType cropType, const HydroCropsLibPacked &packedIn);
     inline Hydro_CropType getKey() const { return data.cropType; }
 };
 
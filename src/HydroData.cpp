@@ -82,6 +82,20 @@ HydroData *newDataFromJSONObject(JsonObjectConst &objectIn)
     return nullptr;
 }
 
+HydroData *newDataCopy(const HydroData *data)
+{
+    HydroData *retVal = _allocateDataFromBaseDecode(*data);
+    HYDRO_SOFT_ASSERT(retVal, SFP(HStr_Err_AllocationFailure));
+
+    if (retVal) { // same as binary serialization, copying all but vtable pointer
+        const uint16_t size = retVal->_size;
+        memcpy((uint8_t *)retVal + sizeof(void*), (const uint8_t *)data + sizeof(void*), min(size, data->_size) - sizeof(void*));
+        retVal->_size = size;
+    }
+
+    return retVal;
+}
+
 
 HydroData::HydroData()
     : id{.chars={'\000','\000','\000','\000'}}, _version(1), _revision(-1)
@@ -20,6 +20,8 @@ extern size_t deserializeDataFromBinaryStream(HydroData *data, Stream *streamIn,
 extern HydroData *newDataFromBinaryStream(Stream *streamIn);
 // Creates a new hydruino data object corresponding to an input JSON element (return ownership transfer - user code *must* delete returned data)
 extern HydroData *newDataFromJSONObject(JsonObjectConst &objectIn);
+// Creates a new hydruino data object copied from existing data, e.g. for snapshotting (return ownership transfer - user code *must* delete returned data)
+extern HydroData *newDataCopy(const HydroData *data);
 
 
 // Data Base
@@ -46,6 +48,7 @@ struct HydroData : public HydroJSONSerializableInterface {
     inline bool isCropsLibData() const { return isStandardData() && id.chars[1] == 'C' && id.chars[2] == 'L' && id.chars[3] == 'D'; }
     inline bool isAdditiveData() const { return isStandardData() && id.chars[1] == 'A' && id.chars[2] == 'D' && id.chars[3] == 'D'; }
     inline bool isUIData() const { return isStandardData() && id.chars[1] == 'U' && id.chars[2] == 'I' && id.chars[3] == 'D'; }
+    inline bool isJournalData() const { return isStandardData() && id.chars[1] == 'J' && id.chars[2] == 'N' && id.chars[3] == 'L'; }
     inline bool isObjectData() const { return !isStandardData() && id.object.idType >= 0; }
 
     HydroData();                                            // Default constructor
@@ -0,0 +1,413 @@
+/*  Hydruino: Simple automation controller for hydroponic grow systems.
+    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>
+    Hydruino Data Store
+*/
+
+#include "Hydruino.h"
+
+HydroDataStore::HydroDataStore()
+    : _filePrefix(), _began(false), _maxSegments(2), _ring{1, 0}, _ringSequence(0),
+      _layout{HYDRO_SYS_DATASTORE_SEGMENTSIZE, 0, HYDRO_SYS_DATASTORE_INDEXSIZE},
+      _activeRecords(0), _rowFile(nullptr), _rowBytes(0)
+{ ; }
+
+bool HydroDataStore::begin(const String &filePrefix, uint32_t budgetBytes)
+{
+    end();
+
+    _filePrefix = filePrefix;
+    _maxSegments = max((uint32_t)2, budgetBytes / HYDRO_SYS_DATASTORE_SEGMENTSIZE);
+    _ring.first = 1; _ring.count = 0;
+    _ringSequence = 0;
+    _layout.columnCount = 0;
+    _activeRecords = 0;
+
+    if (readRing() && _ring.count) { recoverActive(); }
+
+    return (_began = true);
+}
+
+void HydroDataStore::end()
+{
+    if (_rowFile) { endRow(); }
+    _began = false;
+}
+
+bool HydroDataStore::beginRow(time_t timestamp, uint16_t columnCount)
+{
+    if (!_began || _rowFile || !columnCount) { return false; }
+
+    if (!_ring.count || columnCount != _layout.columnCount || _activeRecords >= _layout.getRecordCapacity()) {
+        if (_ring.count && _activeRecords >= _layout.getRecordCapacity()) { sealSegment(); }
+        if (!startSegment(columnCount)) { return false; }
+    }
+
+    _rowFile = Hydruino::_activeInstance->getSDFile(getSegmentFilename(_ring.getNewest()).c_str(), true);
+    if (_rowFile) {
+        uint32_t rowTime = (uint32_t)timestamp;
+        _rowBytes = _rowFile->write((const uint8_t *)&rowTime, sizeof(rowTime));
+        return true;
+    }
+    return false;
+}
+
+void HydroDataStore::writeValue(float value)
+{
+    if (_rowFile) {
+        _rowBytes += _rowFile->write((const uint8_t *)&value, sizeof(value));
+    }
+}
+
+bool HydroDataStore::endRow()
+{
+    if (_rowFile) {
+        bool retVal = _rowBytes == _layout.getRecordSize();
+        Hydruino::_activeInstance->endSDFile(_rowFile);
+        _rowFile = nullptr;
+
+        // short/long rows misalign the segment, so roll to a new one on next row (unsealed segments are scanned)
+        _activeRecords = retVal ? _activeRecords + 1 : _layout.getRecordCapacity() + 1;
+        return retVal;
+    }
+    return false;
+}
+
+bool HydroDataStore::readRow(HydroDataCursor &cursor, time_t *timeOut, float *valuesOut, uint16_t maxValues, uint16_t *countOut, bool *endOut)
+{
+    if (endOut) { *endOut = false; }
+    if (!_began || _rowFile) { return false; }
+    if (!_ring.count) { if (endOut) { *endOut = true; } return false; }
+    if (cursor.segment < _ring.first) { cursor.segment = _ring.first; cursor.record = 0; } // expired (or fresh) cursor
+    Hydruino::_activeInstance->flushSDFiles();
+
+    while (cursor.segment <= _ring.getNewest()) {
+        auto file = Hydruino::_activeInstance->getSDFile(getSegmentFilename(cursor.segment).c_str());
+        if (!file) { return false; } // not end of data, retried later
+
+        uint8_t header[HydroSegmentLayout::HeaderSize];
+        HydroSegmentLayout layout = {HYDRO_SYS_DATASTORE_SEGMENTSIZE, 0, 0};
+        uint32_t records = 0;
+        if (file->read(header, sizeof(header)) == sizeof(header) && layout.unpackHeader(header) && layout.columnCount) {
+            records = layout.getRecordCount(file->size());
+            if (cursor.segment == _ring.getNewest()) { records = min(records, _activeRecords); }
+        }
+
+        if (cursor.record < records) {
+            uint32_t rowTime = 0;
+            uint16_t count = min(layout.columnCount, maxValues);
+            file->seek(layout.getRecordOffset(cursor.record));
+            bool retVal = file->read((uint8_t *)&rowTime, sizeof(rowTime)) == sizeof(rowTime) &&
+                          file->read((uint8_t *)valuesOut, sizeof(float) * count) == sizeof(float) * count;
+            Hydruino::_activeInstance->endSDFile(file);
+            if (retVal) {
+                *timeOut = (time_t)rowTime;
+                *countOut = count;
+                cursor.record++;
+            }
+            return retVal;
+        }
+
+        Hydruino::_activeInstance->endSDFile(file);
+        if (cursor.segment == _ring.getNewest()) { break; }
+        cursor.segment++; cursor.record = 0;
+    }
+
+    if (endOut) { *endOut = true; }
+    return false;
+}
+
+uint16_t HydroDataStore::readRange(time_t startTime, time_t endTime, uint16_t column, time_t *timesOut, float *valuesOut, uint16_t maxCount)
+{
+    uint16_t retVal = 0;
+    if (!_began || !_ring.count || !maxCount || _rowFile) { return retVal; }
+    Hydruino::_activeInstance->flushSDFiles();
+
+    bool pastEnd = false;
+    for (uint32_t segment = findSegment(startTime); !pastEnd && retVal < maxCount && segment <= _ring.getNewest(); ++segment) {
+        HydroSegmentLayout layout;
+        uint32_t records, entries[HYDRO_SYS_DATASTORE_INDEXSIZE];
+        uint16_t entryCount;
+        auto file = openSegment(segment, layout, records, entries, entryCount);
+        if (!file) { continue; }
+
+        if (column < layout.columnCount) {
+            for (uint32_t record = hydroSparseIndexSeek(entries, entryCount, layout.getIndexStride(), (uint32_t)startTime);
+                 record < records && retVal < maxCount; ++record) {
+                uint32_t rowTime = 0;
+                float value = 0;
+                file->seek(layout.getRecordOffset(record));
+                if (file->read((uint8_t *)&rowTime, sizeof(rowTime)) != sizeof(rowTime)) { break; }
+                if (rowTime < (uint32_t)startTime) { continue; }
+                if (rowTime > (uint32_t)endTime) { pastEnd = true; break; }
+                file->seek(layout.getRecordOffset(record) + sizeof(rowTime) + sizeof(float) * column);
+                if (file->read((uint8_t *)&value, sizeof(value)) != sizeof(value)) { break; }
+                timesOut[retVal] = (time_t)rowTime;
+                valuesOut[retVal] = value;
+                retVal++;
+            }
+        }
+
+        Hydruino::_activeInstance->endSDFile(file);
+    }
+
+    return retVal;
+}
+
+void HydroDataStore::clear()
+{
+    if (_rowFile) { endRow(); }
+    for (uint32_t segment = _ring.first; _ring.count && segment <= _ring.getNewest(); ++segment) { removeSegment(segment); }
+    removeFile(getRingFilename(0));
+    removeFile(getRingFilename(1));
+    _ring.first = 1; _ring.count = 0;
+    _ringSequence = 0;
+    _layout.columnCount = 0;
+    _activeRecords = 0;
+}
+
+bool HydroDataStore::expireOldest()
+{
+    if (_began && _ring.count > 1) {
+        removeSegment(_ring.first);
+        _ring.first++; _ring.count--;
+        return writeRing();
+    }
+    return false;
+}
+
+bool HydroDataStore::readRing()
+{
+    // newest valid record of the two ring files, the other being left by an unfinished ring write
+    bool retVal = false;
+    for (uint32_t which = 0; which < 2; ++which) {
+        auto file = Hydruino::_activeInstance->getSDFile(getRingFilename(which).c_str());
+        if (file) {
+            uint8_t bytes[HydroSegmentRing::PackedSize];
+            HydroSegmentRing ring;
+            uint32_t sequence;
+            if (file->read(bytes, sizeof(bytes)) == sizeof(bytes) && ring.unpack(bytes, &sequence) &&
+                (sequence & 1) == which && (!retVal || hydroIsNewerSequence(sequence, _ringSequence))) {
+                _ring = ring;
+                _ringSequence = sequence;
+                retVal = true;
+            }
+            Hydruino::_activeInstance->endSDFile(file);
+        }
+    }
+    return retVal;
+}
+
+bool HydroDataStore::writeRing()
+{
+    // written over the older of the two ring files, leaving the newer as is until this one is complete
+    String filename = getRingFilename(_ringSequence + 1);
+    removeFile(filename);
+    auto file = Hydruino::_activeInstance->getSDFile(filename.c_str(), true);
+    if (file) {
+        uint8_t bytes[HydroSegmentRing::PackedSize];
+        _ring.pack(_ringSequence + 1, bytes);
+        bool retVal = file->write(bytes, sizeof(bytes)) == sizeof(bytes);
+        Hydruino::_activeInstance->endSDFile(file);
+        if (retVal) { _ringSequence++; }
+        return retVal;
+    }
+    return false;
+}
+
+bool HydroDataStore::startSegment(uint16_t columnCount)
+{
+    uint32_t oldFirst = _ring.first;
+    uint32_t expired = _ring.push(_maxSegments);
+    for (uint32_t segment = oldFirst; segment < oldFirst + expired; ++segment) { removeSegment(segment); }
+
+    _layout.columnCount = columnCount;
+    _activeRecords = 0;
+    removeSegment(_ring.getNewest()); // stale segment of same #
+
+    auto file = Hydruino::_activeInstance->getSDFile(getSegmentFilename(_ring.getNewest()).c_str(), true);
+    if (file) {
+        uint8_t header[HydroSegmentLayout::HeaderSize];
+        _layout.packHeader(header);
+        bool retVal = file->write(header, sizeof(header)) == sizeof(header);
+        Hydruino::_activeInstance->endSDFile(file);
+        return writeRing() && retVal;
+    }
+    return false;
+}
+
+void HydroDataStore::sealSegment()
+{
+    // index footer is built from every stride'th record once full, rather than kept in memory while filling
+    uint32_t entries[HYDRO_SYS_DATASTORE_INDEXSIZE];
+    String filename = getSegmentFilename(_ring.getNewest());
+    auto file = Hydruino::_activeInstance->getSDFile(filename.c_str());
+    if (!file) { return; }
+
+    bool aligned = file->size() == _layout.getIndexOffset(); // only whole, aligned segments get index footer
+    for (uint32_t entry = 0; aligned && entry < HYDRO_SYS_DATASTORE_INDEXSIZE; ++entry) {
+        entries[entry] = 0;
+        if (entry * _layout.getIndexStride() < _activeRecords) {
+            file->seek(_layout.getRecordOffset(entry * _layout.getIndexStride()));
+            aligned = file->read((uint8_t *)&entries[entry], sizeof(uint32_t)) == sizeof(uint32_t);
+        }
+    }
+    Hydruino::_activeInstance->endSDFile(file);
+
+    if (aligned && (file = Hydruino::_activeInstance->getSDFile(filename.c_str(), true))) {
+        file->write((const uint8_t *)entries, sizeof(entries));
+        Hydruino::_activeInstance->endSDFile(file);
+    }
+}
+
+void HydroDataStore::recoverActive()
+{
+    auto file = Hydruino::_activeInstance->getSDFile(getSegmentFilename(_ring.getNewest()).c_str());
+    _activeRecords = _layout.getRecordCapacity() + 1; // roll on next row unless recovered
+
+    if (file) {
+        uint8_t header[HydroSegmentLayout::HeaderSize];
+        HydroSegmentLayout layout = {HYDRO_SYS_DATASTORE_SEGMENTSIZE, 0, 0};
+
+        if (file->read(header, sizeof(header)) == sizeof(header) && layout.unpackHeader(header) &&
+            layout.indexEntries == HYDRO_SYS_DATASTORE_INDEXSIZE) {
+            uint32_t fileSize = file->size();
+            uint32_t records = layout.getRecordCount(fileSize);
+
+            if (fileSize == layout.getRecordOffset(records) && records < layout.getRecordCapacity()) {
+                _layout = layout;
+                _activeRecords = records;
+            }
+        }
+
+        Hydruino::_activeInstance->endSDFile(file);
+    }
+}
+
+void HydroDataStore::removeSegment(uint32_t segment)
+{
+    removeFile(getSegmentFilename(segment));
+}
+
+void HydroDataStore::removeFile(const String &filename)
+{
+    Hydruino::_activeInstance->closeSDFile(filename.c_str());
+
+    auto sd = Hydruino::_activeInstance->getSDCard();
+    if (sd) {
+        if (sd->exists(filename.c_str())) {
+            sd->remove(filename.c_str());
+        }
+        Hydruino::_activeInstance->endSDCard(sd);
+    }
+}
+
+uint32_t HydroDataStore::findSegment(time_t time)
+{
+    // newest segment beginning at or before time, segments being in timestamp order
+    uint32_t low = _ring.first, high = _ring.getNewest(), retVal = _ring.first;
+    while (low <= high) {
+        uint32_t mid = low + (high - low) / 2;
+        uint32_t midTime = firstTimestamp(mid);
+        if (midTime && midTime <= (uint32_t)time) { retVal = mid; low = mid + 1; }
+        else { high = mid - 1; }
+    }
+    return retVal;
+}
+
+File *HydroDataStore::openSegment(uint32_t segment, HydroSegmentLayout &layoutOut, uint32_t &recordsOut, uint32_t *entriesOut, uint16_t &entryCountOut)
+{
+    auto file = Hydruino::_activeInstance->getSDFile(getSegmentFilename(segment).c_str());
+    if (!file) { return nullptr; }
+
+    uint8_t header[HydroSegmentLayout::HeaderSize];
+    layoutOut = {HYDRO_SYS_DATASTORE_SEGMENTSIZE, 0, 0};
+    if (file->read(header, sizeof(header)) != sizeof(header) || !layoutOut.unpackHeader(header) || !layoutOut.columnCount) {
+        Hydruino::_activeInstance->endSDFile(file);
+        return nullptr;
+    }
+
+    uint32_t fileSize = file->size();
+    recordsOut = layoutOut.getRecordCount(fileSize);
+    memset(entriesOut, 0, sizeof(uint32_t) * HYDRO_SYS_DATASTORE_INDEXSIZE);
+    entryCountOut = min(layoutOut.indexEntries, (uint16_t)HYDRO_SYS_DATASTORE_INDEXSIZE);
+
+    if (segment == _ring.getNewest()) { // not yet indexed, scanned from start
+        recordsOut = min(recordsOut, _activeRecords);
+        entryCountOut = 0;
+    } else if (fileSize >= layoutOut.getIndexOffset() + sizeof(uint32_t) * layoutOut.indexEntries) {
+        file->seek(layoutOut.getIndexOffset());
+        if (file->read((uint8_t *)entriesOut, sizeof(uint32_t) * entryCountOut) != sizeof(uint32_t) * entryCountOut) { entryCountOut = 0; }
+    } else { // unsealed, scanned from start
+        entryCountOut = 0;
+    }
+
+    return file;
+}
+
+uint32_t HydroDataStore::firstTimestamp(uint32_t segment)
+{
+    uint32_t retVal = 0;
+    auto file = Hydruino::_activeInstance->getSDFile(getSegmentFilename(segment).c_str());
+    if (file) {
+        file->seek(HydroSegmentLayout::HeaderSize);
+        if (file->read((uint8_t *)&retVal, sizeof(retVal)) != sizeof(retVal)) { retVal = 0; }
+        Hydruino::_activeInstance->endSDFile(file);
+    }
+    return retVal;
+}
+
+
+#ifdef HYDRO_USE_DATA_ROLLUPS
+
+HydroRollupTier::HydroRollupTier()
+    : _store(), _period(0), _bucket(0), _columnCount(0), _stats(nullptr)
+{ ; }
+
+HydroRollupTier::~HydroRollupTier()
+{
+    if (_stats) { delete [] _stats; _stats = nullptr; }
+}
+
+bool HydroRollupTier::begin(const String &filePrefix, uint32_t periodSeconds, uint32_t budgetBytes)
+{
+    _period = periodSeconds;
+    _bucket = 0;
+    return _store.begin(filePrefix, budgetBytes);
+}
+
+bool HydroRollupTier::beginRow(time_t timestamp, uint16_t columnCount)
+{
+    if (!isBegan() || !columnCount) { return false; }
+    uint32_t bucket = hydroRollupBucket((uint32_t)timestamp, _period);
+
+    if (_bucket != bucket || _columnCount != columnCount) {
+        flush();
+
+        if (_columnCount != columnCount) {
+            if (_stats) { delete [] _stats; _stats = nullptr; }
+            _stats = new HydroRollupStats[columnCount];
+            HYDRO_SOFT_ASSERT(_stats, SFP(HStr_Err_AllocationFailure));
+            _columnCount = _stats ? columnCount : 0;
+        }
+        for (uint16_t column = 0; column < _columnCount; ++column) { _stats[column].clear(); }
+        _bucket = bucket;
+    }
+
+    return _stats;
+}
+
+void HydroRollupTier::flush()
+{
+    if (_bucket && _stats && _store.beginRow((time_t)_bucket, _columnCount * Hydro_RollupValue_Count)) {
+        for (uint16_t column = 0; column < _columnCount; ++column) {
+            _store.writeValue(_stats[column].count ? _stats[column].minValue : NAN);
+            _store.writeValue(_stats[column].count ? _stats[column].maxValue : NAN);
+            _store.writeValue(_stats[column].count ? _stats[column].getMean() : NAN);
+            _store.writeValue(_stats[column].count ? _stats[column].lastValue : NAN);
+        }
+        _store.endRow();
+    }
+    _bucket = 0;
+}
+
+#endif // /ifdef HYDRO_USE_DATA_ROLLUPS
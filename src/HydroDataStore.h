@@ -0,0 +1,144 @@
+/*  Hydruino: Simple automation controller for hydroponic grow systems.
+    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>
+    Hydruino Data Store
+*/
+
+#ifndef HydroDataStore_H
+#define HydroDataStore_H
+
+class HydroDataStore;
+class HydroRollupTier;
+
+#include "Hydruino.h"
+#include "HydroCoreLogic.h"
+
+// Data Cursor
+// Position of a data row in a data store, for reading rows in order. Zero initialize to start at oldest row.
+struct HydroDataCursor {
+    uint32_t segment;                                       // Segment number
+    uint32_t record;                                        // Record index within segment
+};
+
+// Data Store
+// Log-structured, time-indexed binary storage of data rows on SD card. Rows are appended
+// to numbered, fixed-size segment files (see HydroSegmentLayout), each sealed with a sparse
+// timestamp index footer, so that range queries (see readRange, and tests/data_decode.py)
+// seek into a segment rather than rescan text files. Live segments are bounded by a byte
+// budget, with the oldest segments expired first. The segment ring (first segment # and
+// count) is alternately written to segment file #0's .dat and .bak files (see
+// HydroSegmentRing). Files are accessed through the shared SD session.
+class HydroDataStore {
+public:
+    HydroDataStore();
+
+    // Begins store under file prefix (e.g. "data/hy"), recovering segment ring and active segment.
+    bool begin(const String &filePrefix, uint32_t budgetBytes = HYDRO_SYS_DATASTORE_BUDGETKB * 1024UL);
+    void end();
+    inline bool isBegan() const { return _began; }
+
+    // Begins appending a data row of columnCount values (each written with writeValue), rolling
+    // to a new segment when active one is full or column count changes.
+    bool beginRow(time_t timestamp, uint16_t columnCount);
+    void writeValue(float value);
+    // Ends data row, returning success.
+    bool endRow();
+
+    // Reads data row at cursor (oldest first, expired rows skipped), of up to maxValues values, advancing
+    // cursor past it and returning success. Sets endOut once there are no more rows, as opposed to on errors.
+    bool readRow(HydroDataCursor &cursor, time_t *timeOut, float *valuesOut, uint16_t maxValues, uint16_t *countOut, bool *endOut = nullptr);
+    // Reads up to maxCount timestamps and values of column from rows within [startTime, endTime], oldest
+    // first, seeking through segments' sparse indexes. Returns number of values read.
+    uint16_t readRange(time_t startTime, time_t endTime, uint16_t column, time_t *timesOut, float *valuesOut, uint16_t maxCount);
+
+    // Expires oldest (non-active) segment, e.g. when low on space, returning success.
+    bool expireOldest();
+    // Removes all segments.
+    void clear();
+
+    inline uint32_t getSegmentCount() const { return _ring.count; }
+    inline uint32_t getSegmentBytes() const { return _ring.count * HYDRO_SYS_DATASTORE_SEGMENTSIZE; }
+    // Returns timestamp of oldest stored row, else 0 if empty.
+    inline time_t getOldestTime() { return _ring.count ? (time_t)firstTimestamp(_ring.first) : 0; }
+    inline uint32_t getMaxSegmentCount() const { return _maxSegments; }
+
+protected:
+    String _filePrefix;                                     // Segment file name prefix
+    bool _began;                                            // If store has begun
+    uint32_t _maxSegments;                                  // Maximum live segments, from byte budget
+    HydroSegmentRing _ring;                                 // Live segment numbering
+    uint32_t _ringSequence;                                 // Ring record save sequence #
+    HydroSegmentLayout _layout;                             // Active segment layout
+    uint32_t _activeRecords;                                // Number of records in active (newest) segment
+    File *_rowFile;                                         // Active segment file of row being appended (pooled)
+    uint16_t _rowBytes;                                     // Bytes written of row being appended
+
+    inline String getSegmentFilename(uint32_t segment) const { return getNNFilename(_filePrefix, (unsigned int)segment, SFP(HStr_dat)); }
+    inline String getRingFilename(uint32_t sequence) const { return getNNFilename(_filePrefix, 0, SFP(sequence & 1 ? HStr_dat : HStr_bak)); }
+    bool readRing();
+    bool writeRing();
+    bool startSegment(uint16_t columnCount);
+    void sealSegment();
+    void recoverActive();
+    void removeSegment(uint32_t segment);
+    void removeFile(const String &filename);
+    uint32_t findSegment(time_t time);
+    File *openSegment(uint32_t segment, HydroSegmentLayout &layoutOut, uint32_t &recordsOut, uint32_t *entriesOut, uint16_t &entryCountOut);
+    uint32_t firstTimestamp(uint32_t segment);
+};
+
+
+#ifdef HYDRO_USE_DATA_ROLLUPS
+
+// Rollup Value
+// Per column values stored in each data rollup tier bucket.
+enum Hydro_RollupValue : signed char {
+    Hydro_RollupValue_Min,                                  // Minimum value
+    Hydro_RollupValue_Max,                                  // Maximum value
+    Hydro_RollupValue_Mean,                                 // Mean value
+    Hydro_RollupValue_Last,                                 // Last value
+
+    Hydro_RollupValue_Count,                                // Placeholder
+    Hydro_RollupValue_Undefined = -1                        // Placeholder
+};
+
+// Data Rollup Tier
+// Downsampled tier of published data, computed incrementally as rows are added. Each bucket
+// of period seconds is written, once complete, as a data store row of min, max, mean, and
+// last value per column, into the tier's own data store (with its own retention budget), so
+// that long-range trends can be read without touching full resolution data.
+class HydroRollupTier {
+public:
+    HydroRollupTier();
+    ~HydroRollupTier();
+
+    // Begins tier under file prefix (distinct from other stores), with bucket period and retention budget.
+    bool begin(const String &filePrefix, uint32_t periodSeconds, uint32_t budgetBytes);
+    inline bool isBegan() const { return _store.isBegan(); }
+
+    // Begins adding a data row, writing out previous bucket once timestamp passes it (or column count changes).
+    bool beginRow(time_t timestamp, uint16_t columnCount);
+    // Adds column value of row to current bucket.
+    inline void addValue(uint16_t column, float value) { if (_stats && column < _columnCount) { _stats[column].add(value); } }
+    // Writes out current bucket, if any.
+    void flush();
+
+    // Reads up to maxCount bucket start times and rollup value of column from written out buckets
+    // starting within [startTime, endTime] (see HydroDataStore::readRange). Returns number of values read.
+    inline uint16_t readRange(time_t startTime, time_t endTime, uint16_t column, Hydro_RollupValue value, time_t *timesOut, float *valuesOut, uint16_t maxCount) {
+        return value >= 0 && value < Hydro_RollupValue_Count ? _store.readRange(startTime, endTime, hydroRollupColumn(column, value, Hydro_RollupValue_Count), timesOut, valuesOut, maxCount) : 0;
+    }
+
+    inline uint32_t getPeriod() const { return _period; }
+    inline HydroDataStore &getDataStore() { return _store; }
+
+protected:
+    HydroDataStore _store;                                  // Tier data store
+    uint32_t _period;                                       // Bucket period, in seconds
+    uint32_t _bucket;                                       // Current bucket start time, else 0
+    uint16_t _columnCount;                                  // Number of columns in current bucket
+    HydroRollupStats *_stats;                               // Current bucket column stats (owned)
+};
+
+#endif // /ifdef HYDRO_USE_DATA_ROLLUPS
+
+#endif // /ifndef HydroDataStore_H
@@ -20,6 +20,8 @@ HydroData *_allocateDataFromBaseDecode(const HydroData &baseDecode)
             retVal = new HydroCustomAdditiveData();
         } else if (baseDecode.isUIData()) {
             retVal = new HydroUIData();
+        } else if (baseDecode.isJournalData()) {
+            retVal = new HydroActivationJournalData();
         }
     } else if (baseDecode.isObjectData()) {
         retVal = _allocateDataForObjType(baseDecode.id.object.idType, baseDecode.id.object.classType);
@@ -106,14 +108,15 @@ HydroData *_allocateDataForObjType(int8_t idType, int8_t classType)
 }
 
 HydroSystemData::HydroSystemData()
-    : HydroData('H','S','Y','S', 1),
+    : HydroData('H','S','Y','S', 3),
       systemMode(Hydro_SystemMode_Undefined), measureMode(Hydro_MeasurementMode_Undefined),
       dispOutMode(Hydro_DisplayOutputMode_Undefined), ctrlInMode(Hydro_ControlInputMode_Undefined),
       systemName{0}, timeZoneOffset(0), pollingInterval(HYDRO_DATA_LOOP_INTERVAL),
       autosaveEnabled(Hydro_Autosave_Disabled), autosaveFallback(Hydro_Autosave_Disabled), autosaveInterval(HYDRO_SYS_AUTOSAVE_INTERVAL),
       wifiSSID{0}, wifiPassword{0}, wifiPasswordSeed(0),
       macAddress{0},
-      latitude(DBL_UNDEF), longitude(DBL_UNDEF), altitude(DBL_UNDEF)
+      latitude(DBL_UNDEF), longitude(DBL_UNDEF), altitude(DBL_UNDEF),
+      logBinary(false)
 {
     _size = sizeof(*this);
     HYDRO_HARD_ASSERT(isSystemData(), SFP(HStr_Err_OperationFailure));
@@ -162,7 +165,8 @@ void HydroSystemData::toJSONObject(JsonObject &objectOut) const
     JsonObject schedulerObj = objectOut.createNestedObject(SFP(HStr_Key_Scheduler));
     scheduler.toJSONObject(schedulerObj); if (!schedulerObj.size()) { objectOut.remove(SFP(HStr_Key_Scheduler)); }
     JsonObject loggerObj = objectOut.createNestedObject(SFP(HStr_Key_Logger));
-    logger.toJSONObject(loggerObj); if (!loggerObj.size()) { objectOut.remove(SFP(HStr_Key_Logger)); }
+    logger.toJSONObject(loggerObj); if (logBinary) { loggerObj[SFP(HStr_Key_LogBinary)] = logBinary; }
+    if (!loggerObj.size()) { objectOut.remove(SFP(HStr_Key_Logger)); }
     JsonObject publisherObj = objectOut.createNestedObject(SFP(HStr_Key_Publisher));
     publisher.toJSONObject(publisherObj); if (!publisherObj.size()) { objectOut.remove(SFP(HStr_Key_Publisher)); }
 }
@@ -210,11 +214,17 @@ void HydroSystemData::fromJSONObject(JsonObjectConst &objectIn)
     JsonObjectConst schedulerObj = objectIn[SFP(HStr_Key_Scheduler)];
     if (!schedulerObj.isNull()) { scheduler.fromJSONObject(schedulerObj); }
     JsonObjectConst loggerObj = objectIn[SFP(HStr_Key_Logger)];
-    if (!loggerObj.isNull()) { logger.fromJSONObject(loggerObj); }
+    if (!loggerObj.isNull()) { logger.fromJSONObject(loggerObj); logBinary = loggerObj[SFP(HStr_Key_LogBinary)] | logBinary; }
     JsonObjectConst publisherObj = objectIn[SFP(HStr_Key_Publisher)];
     if (!publisherObj.isNull()) { publisher.fromJSONObject(publisherObj); }
 }
 
+void HydroSystemData::migrateFromBinaryVersion(uint8_t fromVersion)
+{
+    if (fromVersion < 2) { publisher.clearDeadbands(); } // appended in v2, may hold prior padding
+    if (fromVersion < 3) { logBinary = false; } // appended in v3
+}
+
 
 HydroCalibrationData::HydroCalibrationData()
     : HydroData('H','C','A','L', 1),
@@ -492,3 +502,96 @@ void HydroCustomAdditiveData::fromJSONObject(JsonObjectConst &objectIn)
     JsonVariantConst weeklyDosingRatesVar = objectIn[SFP(HStr_Key_WeeklyDosingRates)];
     commaStringToArray(weeklyDosingRatesVar, weeklyDosingRates, HYDRO_CROPS_GROWWEEKS_MAX);
 }
+
+
+// Writes rollup tally fields out to JSON object
+static void journalTallyToJSONObject(const HydroActivationTally &tally, JsonObject &objectOut)
+{
+    if (tally.onTimeMillis) { objectOut[SFP(HStr_Key_OnTimeMillis)] = tally.onTimeMillis; }
+    if (tally.activations) { objectOut[SFP(HStr_Key_ActivationCount)] = tally.activations; }
+    if (tally.energyWh > FLT_EPSILON) { objectOut[SFP(HStr_Key_EnergyUsageWh)] = tally.energyWh; }
+}
+
+// Reads rollup tally fields in from JSON object
+static void journalTallyFromJSONObject(HydroActivationTally &tally, JsonObjectConst &objectIn)
+{
+    tally.onTimeMillis = objectIn[SFP(HStr_Key_OnTimeMillis)] | tally.onTimeMillis;
+    tally.activations = objectIn[SFP(HStr_Key_ActivationCount)] | tally.activations;
+    tally.energyWh = objectIn[SFP(HStr_Key_EnergyUsageWh)] | tally.energyWh;
+}
+
+// Writes rollup out to JSON object, with previous tally as nested object
+static void journalRollupToJSONObject(const HydroActivationRollup &rollup, JsonObject &objectOut)
+{
+    objectOut[SFP(HStr_Key_Bucket)] = rollup.bucket;
+    journalTallyToJSONObject(rollup.current, objectOut);
+    if (rollup.previous.onTimeMillis || rollup.previous.activations) {
+        JsonObject previousObj = objectOut.createNestedObject(SFP(HStr_Key_Previous));
+        journalTallyToJSONObject(rollup.previous, previousObj);
+    }
+}
+
+// Reads rollup in from JSON object
+static void journalRollupFromJSONObject(HydroActivationRollup &rollup, JsonObjectConst &objectIn)
+{
+    rollup.bucket = objectIn[SFP(HStr_Key_Bucket)] | rollup.bucket;
+    journalTallyFromJSONObject(rollup.current, objectIn);
+    JsonObjectConst previousObj = objectIn[SFP(HStr_Key_Previous)];
+    if (!previousObj.isNull()) { journalTallyFromJSONObject(rollup.previous, previousObj); }
+}
+
+HydroActivationJournalData::HydroActivationJournalData()
+    : HydroData('H','J','N','L', 1), ownerName{0}, journal()
+{
+    _size = sizeof(*this);
+    HYDRO_HARD_ASSERT(isJournalData(), SFP(HStr_Err_OperationFailure));
+}
+
+HydroActivationJournalData::HydroActivationJournalData(HydroIdentity ownerId)
+    : HydroData('H','J','N','L', 1), ownerName{0}, journal()
+{
+    _size = sizeof(*this);
+    HYDRO_HARD_ASSERT(isJournalData(), SFP(HStr_Err_OperationFailure));
+    if (ownerId) {
+        strncpy(ownerName, ownerId.keyString.c_str(), HYDRO_NAME_MAXSIZE);
+    }
+}
+
+void HydroActivationJournalData::toJSONObject(JsonObject &objectOut) const
+{
+    HydroData::toJSONObject(objectOut);
+
+    if (ownerName[0]) { objectOut[SFP(HStr_Key_ActuatorName)] = charsToString(ownerName, HYDRO_NAME_MAXSIZE); }
+    objectOut[SFP(HStr_Key_Timestamp)] = journal.lastTime;
+    objectOut[SFP(HStr_Key_ActivationCount)] = journal.totalActivations;
+    objectOut[SFP(HStr_Key_OnTimeSecs)] = journal.totalOnTimeSecs;
+    if (journal.totalOnTimeMillis) { objectOut[SFP(HStr_Key_OnTimeMillis)] = journal.totalOnTimeMillis; }
+    objectOut[SFP(HStr_Key_EnergyUsageWh)] = journal.totalEnergyWh;
+
+    JsonObject hourlyObj = objectOut.createNestedObject(SFP(HStr_Key_Hourly));
+    journalRollupToJSONObject(journal.hourly, hourlyObj);
+    JsonObject dailyObj = objectOut.createNestedObject(SFP(HStr_Key_Daily));
+    journalRollupToJSONObject(journal.daily, dailyObj);
+    JsonObject weeklyObj = objectOut.createNestedObject(SFP(HStr_Key_Weekly));
+    journalRollupToJSONObject(journal.weekly, weeklyObj);
+}
+
+void HydroActivationJournalData::fromJSONObject(JsonObjectConst &objectIn)
+{
+    HydroData::fromJSONObject(objectIn);
+
+    const char *ownerNameStr = objectIn[SFP(HStr_Key_ActuatorName)];
+    if (ownerNameStr && ownerNameStr[0]) { strncpy(ownerName, ownerNameStr, HYDRO_NAME_MAXSIZE); }
+    journal.lastTime = objectIn[SFP(HStr_Key_Timestamp)] | journal.lastTime;
+    journal.totalActivations = objectIn[SFP(HStr_Key_ActivationCount)] | journal.totalActivations;
+    journal.totalOnTimeSecs = objectIn[SFP(HStr_Key_OnTimeSecs)] | journal.totalOnTimeSecs;
+    journal.totalOnTimeMillis = objectIn[SFP(HStr_Key_OnTimeMillis)] | journal.totalOnTimeMillis;
+    journal.totalEnergyWh = objectIn[SFP(HStr_Key_EnergyUsageWh)] | journal.totalEnergyWh;
+
+    JsonObjectConst hourlyObj = objectIn[SFP(HStr_Key_Hourly)];
+    if (!hourlyObj.isNull()) { journalRollupFromJSONObject(journal.hourly, hourlyObj); }
+    JsonObjectConst dailyObj = objectIn[SFP(HStr_Key_Daily)];
+    if (!dailyObj.isNull()) { journalRollupFromJSONObject(journal.daily, dailyObj); }
+    JsonObjectConst weeklyObj = objectIn[SFP(HStr_Key_Weekly)];
+    if (!weeklyObj.isNull()) { journalRollupFromJSONObject(journal.weekly, weeklyObj); }
+}
@@ -10,9 +10,11 @@ struct HydroSystemData;
 struct HydroCalibrationData;
 struct HydroCropsLibData;
 struct HydroCustomAdditiveData;
+struct HydroActivationJournalData;
 
 #include "Hydruino.h"
 #include "HydroData.h"
+#include "HydroCoreLogic.h"
 #include "HydroScheduler.h"
 #include "HydroPublisher.h"
 #include "HydroLogger.h"
@@ -52,10 +54,12 @@ struct HydroSystemData : public HydroData {
     HydroSchedulerSubData scheduler;                        // Scheduler subdata
     HydroLoggerSubData logger;                              // Logger subdata
     HydroPublisherSubData publisher;                        // Publisher subdata
+    bool logBinary;                                         // Logger writes binary records (.dat) instead of text (.txt), appended in v3
 
     HydroSystemData();
     virtual void toJSONObject(JsonObject &objectOut) const override;
     virtual void fromJSONObject(JsonObjectConst &objectIn) override;
+    virtual void migrateFromBinaryVersion(uint8_t fromVersion) override;
 };
 
 
@@ -203,6 +207,20 @@ struct HydroCustomAdditiveData : public HydroData {
 };
 
 
+// Activation Journal Data
+// id: HJNL. Actuator activation journal data.
+// Persists an actuator's lifetime on-time, activation count, and energy usage totals,
+// along with its hourly/daily/weekly rollups, so that accounting survives restarts.
+struct HydroActivationJournalData : public HydroData {
+    char ownerName[HYDRO_NAME_MAXSIZE];                     // Owner actuator name this journal belongs to
+    HydroActivationJournal journal;                         // Journal totals and rollups
+
+    HydroActivationJournalData();
+    HydroActivationJournalData(HydroIdentity ownerId);
+    virtual void toJSONObject(JsonObject &objectOut) const override;
+    virtual void fromJSONObject(JsonObjectConst &objectIn) override;
+};
+
 // Internal use, but must contain all ways for all data types to be new'ed
 extern HydroData *_allocateDataFromBaseDecode(const HydroData &baseDecode);
 extern HydroData *_allocateDataForObjType(int8_t idType, int8_t classType);
@@ -168,7 +168,15 @@ typedef typeof(LOW)                     ard_pinstatus_t;    // Arduino pin statu
 #define HYDRO_JSON_DOC_SYSSIZE          256                 // JSON document chunk data bytes for reading in main system data (serialization buffer size)
 #define HYDRO_JSON_DOC_DEFSIZE          192                 // Default JSON document chunk data bytes (serialization buffer size)
 #define HYDRO_STRING_BUFFER_SIZE        32                  // Size in bytes of string serialization buffers
+#ifdef HYDRO_DISABLE_BUILTIN_DATA
+#define HYDRO_STRING_CACHE_ENTRIES      8                   // Number of entries in string lookup LRU cache (max # of recently looked up strings kept in memory, 0 compiles out)
+#else
+#define HYDRO_STRING_CACHE_ENTRIES      0                   // Number of entries in string lookup LRU cache (compiled out when Flash strings are built in, as lookups then rarely leave Flash)
+#endif
+#define HYDRO_STRING_CACHE_ENTRYSIZE    24                  // Size in bytes of each string lookup cache entry (longer strings only keep most recent lookup)
 #define HYDRO_WIFISTREAM_BUFFER_SIZE    128                 // Size in bytes of WiFi serialization buffers
+#define HYDRO_EEPROM_PAGEBUFFER_SIZE    32                  // Size in bytes of EEPROM stream read-ahead & write-combining page buffers (power of 2, write pages further limited to device page size)
+#define HYDRO_SYS_EEPROM_GENERATIONS    4                   // Number of wear-leveled system data generation slots rotated through in EEPROM (fewer used if data overflows, 1 disables rotation, still CRC checked)
 // The following sizes only apply to architectures that do not have STL support (AVR/SAM)
 #define HYDRO_DEFAULT_MAXSIZE           8                   // Default maximum array/map size
 #define HYDRO_ACTUATOR_SIGNAL_SLOTS     4                   // Maximum number of slots for actuator's activation signal
@@ -177,7 +185,13 @@ typedef typeof(LOW)                     ard_pinstatus_t;    // Arduino pin statu
 #define HYDRO_BALANCER_SIGNAL_SLOTS     2                   // Maximum number of slots for balancer's state signal
 #define HYDRO_BALANCER_STALE_FRAMES     3                   // Maximum sensor frames balancers will act on without a fresh reading
 #define HYDRO_LOG_SIGNAL_SLOTS          2                   // Maximum number of slots for system log signal
+#define HYDRO_LOG_RECORD_MAXSIZE        96                  // Maximum size in bytes of binary log records (text arguments truncated to fit, sized for soft assertion records)
+#define HYDRO_LOG_TEXT_MAXSIZE          48                  // Maximum size in bytes of log event message/suffix texts (including null terminator, truncated to fit)
 #define HYDRO_PUBLISH_SIGNAL_SLOTS      2                   // Maximum number of slots for data publish signal
+#define HYDRO_PUBLISH_SINK_SLOTS        5                   // Maximum number of publisher sinks, including built-in SD card/WiFiStorage/MQTT sinks once began (see HydroPublisherSinkInterface)
+#define HYDRO_PUBLISH_LINEPROTO_PACKETSIZE 512              // Size in bytes of line protocol sink packets (keep under network MTU for UDP)
+#define HYDRO_PUBLISH_LINEPROTO_FLUSHMILLIS 5000            // Maximum milliseconds line protocol sink lines are held before being sent
+#define HYDRO_PUBLISH_DEADBAND_SLOTS    4                   // Maximum number of sensors with change-only publishing settings (kept in HSYS system data, so changing it changes binary save layout)
 #define HYDRO_RESERVOIR_SIGNAL_SLOTS    2                   // Maximum number of slots for filled/empty signal
 #define HYDRO_FEEDING_SIGNAL_SLOTS      2                   // Maximum number of slots for crop feed signal
 #define HYDRO_RAIL_SIGNAL_SLOTS         8                   // Maximum number of slots for rail capacity signal
@@ -187,7 +201,10 @@ typedef typeof(LOW)                     ard_pinstatus_t;    // Arduino pin statu
 #define HYDRO_OBJ_LINKS_MAXSIZE         8                   // Maximum array size for object linkage list, per obj (max # of linked objects)
 #define HYDRO_BAL_ACTUATORS_MAXSIZE     8                   // Maximum array size for balancer actuators list (max # of actuators used)
 #define HYDRO_SCH_REQACTS_MAXSIZE       4                   // Maximum array size for scheduler required actuators list (max # of actuators active per process stage)
-#define HYDRO_SCH_PROCS_MAXSIZE         2                   // Maximum array size for scheduler feeding/lighting process lists (max # of feed reservoirs)
+#define HYDRO_SCH_PROCS_MAXSIZE         8                   // Maximum array size for scheduler feeding/lighting process lists (max # of feed reservoirs/bays)
+#define HYDRO_SCH_RESOURCES_MAXSIZE     8                   // Maximum array size for scheduler feeding shared resources list (max # of pumps/shared reservoirs booked per feeding)
+#define HYDRO_SCH_BOOKINGS_MAXSIZE      (HYDRO_SCH_PROCS_MAXSIZE * HYDRO_SCH_RESOURCES_MAXSIZE) // Maximum array size for scheduler shared resource bookings (max # of concurrently booked resources, every feed reservoir booking all of its resources)
+#define HYDRO_SCH_TIMELINE_MAXSIZE      24                  // Maximum array size for scheduler planned daily timeline (max # of planned stage transitions held at once, across all processes, with the remainder of the day replanned once stepped past)
 #define HYDRO_SYS_ONEWIRES_MAXSIZE      2                   // Maximum array size for pin OneWire list (max # of OneWire comm pins)
 #define HYDRO_SYS_PINLOCKS_MAXSIZE      2                   // Maximum array size for pin locks list (max # of locks)
 #define HYDRO_SYS_PINMUXERS_MAXSIZE     2                   // Maximum array size for pin muxers list (max # of muxers)
@@ -199,6 +216,8 @@ typedef typeof(LOW)                     ard_pinstatus_t;    // Arduino pin statu
 
 #define HYDRO_ACT_PUMPCALC_UPDATEMS     250                 // Minimum time millis needing to pass before a pump reports/writes changed volume to reservoir (reduces error accumulation)
 #define HYDRO_ACT_PUMPCALC_MINFLOWRATE  0.05f               // What percentage of continuous flow rate an instantaneous flow rate sensor must achieve before it is used in pump/volume calculations (reduces near-zero error jitters)
+#define HYDRO_ACT_TIMERWHEEL_LEVELS     4                   // Number of 16-slot levels in the activation expiry timer wheel (each level spans 16x the milliseconds of the one below, expiries beyond top level are re-filed on cascade)
+#define HYDRO_ACT_JOURNAL_UPDATEMS      1000                // Minimum time millis needing to pass before an enabled actuator accrues its running on-time/energy into its activation journal (rollup boundary granularity)
 
 #define HYDRO_CROPS_LINKS_BASESIZE      1                   // Base array size for crop's linkage list
 #define HYDRO_CROPS_GROWWEEKS_MAX       16                  // Maximum grow weeks to support scheduling up to
@@ -233,22 +252,36 @@ typedef typeof(LOW)                     ard_pinstatus_t;    // Arduino pin statu
 #define HYDRO_SCH_FEED_FRACTION         0.8f                // What percentage of crops need to have their feeding signal turned on/off for scheduler to act on such as a whole
 #define HYDRO_SCH_BALANCE_MINTIME       30                  // Minimum time, in seconds, that all balancers must register as balanced for until balancing is marked as completed
 #define HYDRO_SCH_AERATORS_FEEDRUN      true                // If aerators should be continued to be ran during feeding, after pre-feeding aeration is finished
+#define HYDRO_SCH_FEEDINGS_ACTIVEMAX    0                   // Default maximum number of feedings allowed to actively run at once across all feed reservoirs (0 for unlimited, shared pumps/reservoirs are always arbitrated)
 
 #define HYDRO_SENSOR_BINARY_STABLE_MILLIS 100                 // Minimum time a binary sensor input must remain changed before the new state is accepted, in milliseconds
 #define HYDRO_SENSOR_ANALOGREAD_SAMPLES 5                   // Number of samples to take for any analogRead call inside of a sensor's takeMeasurement call, or 0 to disable sampling (note: bitRes.maxValue * # of samples must fit inside a uint32_t)
 #define HYDRO_SENSOR_ANALOGREAD_DELAY   0                   // Delay time between samples, or 0 to disable delay, in milliseconds
 
 #define HYDRO_SYS_AUTOSAVE_INTERVAL     120                 // Default autosave interval, in minutes
+#define HYDRO_SYS_AUTOSAVE_WRITEMILLIS  10                  // Milliseconds of autosave writing done per misc loop run before yielding back to control (snapshot is written across multiple runs)
+#define HYDRO_SYS_SDCOPY_CHUNKSIZE      64                  // Size in bytes of SD card file chunks copied per autosave write when replacing config file with staged file (SD library has no rename)
 #define HYDRO_SYS_I2CEEPROM_BASEADDR    0x50                // Base address of I2C EEPROM (bitwise or'ed with passed address)
 #define HYDRO_SYS_ATWIFI_SERIALBAUD     115200              // Data baud rate for serial AT WiFi, in bps (older modules may need 9600)
 #define HYDRO_SYS_ATWIFI_SERIALMODE     SERIAL_8N1          // Data transfer mode for serial AT WiFi (see SERIAL_* defines)
 #define HYDRO_SYS_NMEAGPS_SERIALBAUD    9600                // Data baud rate for serial NMEA GPS, in bps (older modules may need 4800)
 #define HYDRO_SYS_URLHTTP_PORT          80                  // Which default port to access when accessing HTTP resources
 #define HYDRO_SYS_LEAVE_FILES_OPEN      !defined(__AVR__)   // If high access files should be left open to improve performance (true), or closed after use to reduce memory consumption (false)
+#define HYDRO_SYS_SDSESSION_FILES       3                   // Number of pooled SD card file handles shared by logger, publisher, strings, and crops library (reference counted, closed when idle)
 #define HYDRO_SYS_FREERAM_LOWBYTES      1024                // How many bytes of free memory left spawns a handle low mem call to all objects
 #define HYDRO_SYS_FREESPACE_INTERVAL    240                 // How many minutes should pass before checking attached file systems have enough disk space (performs cleanup if not)
 #define HYDRO_SYS_FREESPACE_LOWSPACE    256                 // How many kilobytes of disk space remaining will force cleanup of oldest log/data files first
 #define HYDRO_SYS_FREESPACE_DAYSBACK    180                 // How many days back log/data files are allowed to be stored up to (any beyond this are deleted during cleanup)
+#define HYDRO_SYS_DATASTORE_BUDGETKB    4096                // How many kilobytes of SD card space published data may use, daily CSV files and data store segments combined (oldest rows removed first)
+#define HYDRO_SYS_DATASTORE_SEGMENTSIZE 16384               // Size in bytes of each data store segment file (fixed-size, append-only binary records)
+#define HYDRO_SYS_DATASTORE_INDEXSIZE   32                  // Number of sparse timestamp index entries per data store segment (written as footer once segment is full)
+#define HYDRO_SYS_ROLLUP_MINUTE_BUDGETKB 512                // How many kilobytes of SD card space the 1-minute data rollup tier may use (min/max/mean/last per column, see HYDRO_ENABLE_DATA_ROLLUPS)
+#define HYDRO_SYS_ROLLUP_QUARTER_BUDGETKB 1024              // How many kilobytes of SD card space the 15-minute data rollup tier may use
+#define HYDRO_SYS_ROLLUP_HOURLY_BUDGETKB 2048               // How many kilobytes of SD card space the hourly data rollup tier may use
+#define HYDRO_SYS_MQTT_FRAMESIZE        256                 // Size in bytes of batched MQTT data frame payloads (frames that don't fit are published per column)
+#define HYDRO_SYS_MQTT_OUTBOXKB         256                 // How many kilobytes of SD card space the MQTT outbox of unsent data frames may use (replayed upon reconnect)
+#define HYDRO_SYS_MQTT_BACKFILLRATE     4                   // Maximum number of MQTT outbox data frames replayed per publisher update
+#define HYDRO_SYS_MQTT_RECONNECTMILLIS  15000               // How many milliseconds between MQTT broker reconnect attempts
 #define HYDRO_SYS_SUNRISESET_CALCITERS  3                   // # of iterations that sunrise/sunset calculations should run (higher # = more accurate but also more costly)
 #define HYDRO_SYS_LATLONG_DISTSQRDTOL   0.25                // Squared difference in lat/long coords that needs to occur for it to be considered significant enough for system update
 #define HYDRO_SYS_ALTITUDE_DISTTOL      0.5                 // Difference in altitude coords that needs to occur for it to be considered significant enough for system update
@@ -266,10 +299,10 @@ typedef typeof(LOW)                     ard_pinstatus_t;    // Arduino pin statu
 #define HYDRO_FSPATH_SEPARATOR          '/'                 // Path separator for filesystem paths (SD card/WiFiStorage)
 #define HYDRO_URLPATH_SEPARATOR         '/'                 // Path separator for URL paths
 
-#if HYDRO_SYS_LEAVE_FILES_OPEN                              // How subsequent getters should be called when file left open
-#define HYDRO_LOFS_BEGIN false
+#if HYDRO_SYS_LEAVE_FILES_OPEN                              // How long unreferenced SD session files (and card session) are kept open, in milliseconds
+#define HYDRO_SYS_SDSESSION_IDLEMILLIS  60000
 #else
-#define HYDRO_LOFS_BEGIN true
+#define HYDRO_SYS_SDSESSION_IDLEMILLIS  2000
 #endif
 
 #if !(defined(NO_GLOBAL_INSTANCES) || defined(NO_GLOBAL_SPI)) && (SPI_INTERFACES_COUNT > 0 || SPI_HOWMANY > 0)
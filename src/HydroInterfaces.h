@@ -11,6 +11,8 @@ struct HydroJSONSerializableInterface;
 class HydroObjInterface;
 class HydroUIInterface;
 class HydroRTCInterface;
+class HydroPublisherSinkInterface;
+struct HydroDataColumn;
 
 struct HydroDigitalInputPinInterface;
 struct HydroDigitalOutputPinInterface;
@@ -102,6 +104,20 @@ public:
     virtual void setNeedsRedraw() = 0;
 };
 
+// Publisher Sink Interface
+class HydroPublisherSinkInterface {
+public:
+    // Accepts published data frame's columns (see HydroDataColumn::changed), returning false if backed up (frame dropped).
+    // Called every polling frame, including frames without any changed columns (e.g. for downsampling), which sinks may skip.
+    virtual bool publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns) = 0;
+    // Flushes any buffered frames, called every publisher update.
+    virtual void update() = 0;
+    // Called once data columns are (re)tabulated, and upon being added if already tabulated (e.g. to write headers).
+    virtual void notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns) { ; }
+    // Called once local date changes (e.g. to roll over to next day's file).
+    virtual void notifyDateChanged() { ; }
+};
+
 // RTC Module Interface
 class HydroRTCInterface {
 public:
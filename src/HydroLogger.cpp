@@ -5,17 +5,80 @@
 
 #include "Hydruino.h"
 
-HydroLogEvent::HydroLogEvent(Hydro_LogLevel levelIn, const String &prefixIn, const String &msgIn, const String &suffix1In, const String &suffix2In)
-    : level(levelIn), timestamp(localNow().timestamp(DateTime::TIMESTAMP_FULL)), prefix(prefixIn), msg(msgIn), suffix1(suffix1In), suffix2(suffix2In)
-{ ; }
+static Hydro_String logLevelPrefix(Hydro_LogLevel level)
+{
+    return level == Hydro_LogLevel_Errors ? HStr_Log_Prefix_Error : level == Hydro_LogLevel_Warnings ? HStr_Log_Prefix_Warning : HStr_Log_Prefix_Info;
+}
+
+// String table lookups for HydroLogArgResolver, straight from Flash when built-in.
+struct HydroLogStrings {
+    template<size_t N>
+    void appendString(HydroFixedString<N> &out, uint16_t stringId) const {
+        if (stringId < HStr_Count) { appendStringFromPGM(out, (Hydro_String)stringId); }
+    }
+    int objectTypeStringId(int8_t type, int8_t objType) const {
+        Hydro_String strNum = HStr_Count;
+        switch (type) {
+            case HydroIdentity::Actuator: strNum = actuatorTypeToStringId((Hydro_ActuatorType)objType); break;
+            case HydroIdentity::Sensor: strNum = sensorTypeToStringId((Hydro_SensorType)objType); break;
+            case HydroIdentity::Crop: strNum = cropTypeToStringId((Hydro_CropType)objType); break;
+            case HydroIdentity::Reservoir: strNum = reservoirTypeToStringId((Hydro_ReservoirType)objType); break;
+            case HydroIdentity::Rail: strNum = railTypeToStringId((Hydro_RailType)objType); break;
+            default: break;
+        }
+        return strNum != HStr_Count && strNum != HStr_Undefined ? (int)strNum : -1;
+    }
+};
+
+static inline HydroLogArgResolver<HydroLogStrings> logArgResolver()
+{
+    return HydroLogArgResolver<HydroLogStrings>(HydroLogStrings(), HYDRO_POS_EXPORT_BEGFROM, HYDRO_POS_MAXSIZE);
+}
+
+static inline HydroLogFileHeader logFileHeader()
+{
+    HydroLogFileHeader header;
+    header.stringCount = (uint16_t)HStr_Count;
+    header.stringsCRC = getStringsCRC();
+    return header;
+}
+
+HydroLogEvent::HydroLogEvent(Hydro_LogLevel levelIn, const char *msgIn, const char *suffix1In, const char *suffix2In)
+    : level(levelIn), timestamp(), prefix(), msg(), suffix1(), suffix2()
+{
+    DateTime currTime = localNow();
+    timestamp.appendTimestamp(currTime.year(), currTime.month(), currTime.day(), currTime.hour(), currTime.minute(), currTime.second());
+    appendStringFromPGM(prefix, logLevelPrefix(level));
+    msg.append(msgIn).markTruncation();
+    suffix1.append(suffix1In).markTruncation();
+    suffix2.append(suffix2In).markTruncation();
+}
+
+HydroLogEvent::HydroLogEvent(const uint8_t *recordData, size_t recordSize)
+    : level(Hydro_LogLevel_None), timestamp(), prefix(), msg(), suffix1(), suffix2()
+{
+    HydroLogRecordReader reader(recordData, recordSize);
+
+    if (reader.isValid()) {
+        DateTime recordTime(reader.getTimestamp());
+        level = (Hydro_LogLevel)reader.getLevel();
+        timestamp.appendTimestamp(recordTime.year(), recordTime.month(), recordTime.day(), recordTime.hour(), recordTime.minute(), recordTime.second());
+        appendStringFromPGM(prefix, logLevelPrefix(level));
+
+        HydroLogArg arg;
+        for (int textIndex = 0; reader.next(arg); ++textIndex) {
+            hydroAppendLogArg(textIndex == 0 ? msg : textIndex == 1 ? suffix1 : suffix2, arg, logArgResolver());
+        }
+        msg.markTruncation();
+        suffix1.markTruncation();
+        suffix2.markTruncation();
+    }
+}
 
 
 HydroLogger::HydroLogger() :
-#if HYDRO_SYS_LEAVE_FILES_OPEN
-    _logFileSD(nullptr),
-#ifdef HYDRO_USE_WIFI_STORAGE
+#if HYDRO_SYS_LEAVE_FILES_OPEN && defined(HYDRO_USE_WIFI_STORAGE)
     _logFileWS(nullptr),
-#endif
 #endif
     _logFilename(), _initTime(0), _lastSpaceCheck(0)
 { ; }
@@ -24,55 +87,32 @@ HydroLogger::~HydroLogger()
 {
     flush();
 
-    #if HYDRO_SYS_LEAVE_FILES_OPEN
-        if (_logFileSD) {
-            _logFileSD->close();
-            delete _logFileSD; _logFileSD = nullptr;
-            Hydruino::_activeInstance->endSDCard();
+    #if HYDRO_SYS_LEAVE_FILES_OPEN && defined(HYDRO_USE_WIFI_STORAGE)
+        if (_logFileWS) {
+            _logFileWS->close();
+            delete _logFileWS; _logFileWS = nullptr;
         }
-        #ifdef HYDRO_USE_WIFI_STORAGE
-            if (_logFileWS) {
-                _logFileWS->close();
-                delete _logFileWS; _logFileWS = nullptr;
-            }
-        #endif
     #endif
 }
 
-bool HydroLogger::beginLoggingToSDCard(String logFilePrefix)
+bool HydroLogger::beginLoggingToSDCard(const String &logFilePrefix)
 {
     HYDRO_SOFT_ASSERT(hasLoggerData(), SFP(HStr_Err_NotYetInitialized));
 
     if (hasLoggerData() && !loggerData()->logToSDCard) {
-        auto sd = Hydruino::_activeInstance->getSDCard();
-
-        if (sd) {
-            String logFilename = getYYMMDDFilename(logFilePrefix, SFP(HStr_txt));
-            createDirectoryFor(sd, logFilename);
-            #if HYDRO_SYS_LEAVE_FILES_OPEN
-                auto &logFile = _logFileSD ? *_logFileSD : *(_logFileSD = new File(sd->open(logFilename.c_str(), FILE_WRITE)));
-            #else
-                auto logFile = sd->open(logFilename.c_str(), FILE_WRITE);
-            #endif
+        String logFilename = getYYMMDDFilename(logFilePrefix, SFP(isLoggingBinary() ? HStr_dat : HStr_txt));
+        auto logFile = Hydruino::_activeInstance->getSDFile(logFilename.c_str(), true);
 
-            if (logFile) {
-                #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                    logFile.close();
-                    Hydruino::_activeInstance->endSDCard(sd);
-                #endif
+        if (logFile) {
+            Hydruino::_activeInstance->endSDFile(logFile);
 
-                strncpy(loggerData()->logFilePrefix, logFilePrefix.c_str(), 16);
-                loggerData()->logToSDCard = true;
-                _logFilename = logFilename;
-                Hydruino::_activeInstance->_systemData->bumpRevisionIfNeeded();
+            strncpy(loggerData()->logFilePrefix, logFilePrefix.c_str(), 16);
+            loggerData()->logToSDCard = true;
+            _logFilename = logFilename;
+            Hydruino::_activeInstance->_systemData->bumpRevisionIfNeeded();
 
-                return true;
-            }
+            return true;
         }
-
-        #if !HYDRO_SYS_LEAVE_FILES_OPEN
-            Hydruino::_activeInstance->endSDCard(sd);
-        #endif
     }
 
     return false;
@@ -80,12 +120,12 @@ bool HydroLogger::beginLoggingToSDCard(String logFilePrefix)
 
 #ifdef HYDRO_USE_WIFI_STORAGE
 
-bool HydroLogger::beginLoggingToWiFiStorage(String logFilePrefix)
+bool HydroLogger::beginLoggingToWiFiStorage(const String &logFilePrefix)
 {
     HYDRO_SOFT_ASSERT(hasLoggerData(), SFP(HStr_Err_NotYetInitialized));
 
     if (hasLoggerData() && !loggerData()->logToWiFiStorage) {
-        String logFilename = getYYMMDDFilename(logFilePrefix, SFP(HStr_txt));
+        String logFilename = getYYMMDDFilename(logFilePrefix, SFP(isLoggingBinary() ? HStr_dat : HStr_txt));
         #if HYDRO_SYS_LEAVE_FILES_OPEN
             auto &logFile = _logFileWS ? *_logFileWS : *(_logFileWS = new WiFiStorageFile(WiFiStorage.open(logFilename.c_str())));
         #else
@@ -115,78 +155,151 @@ void HydroLogger::logSystemUptime()
 {
     TimeSpan elapsed(getSystemUptime());
     if (elapsed.totalseconds()) {
-        logMessage(SFP(HStr_Log_SystemUptime), timeSpanToString(elapsed));
+        logTimeSpan(HStr_Log_SystemUptime, elapsed.totalseconds());
+    }
+}
+
+void HydroLogger::logMeasurement(Hydro_String fieldStr, float value, Hydro_UnitsType units, unsigned int additionalDecPlaces)
+{
+    if (isLevelEnabled(Hydro_LogLevel_Info)) {
+        HydroFixedString<16> unitsSuffix;
+        unitsSuffix.append(' ');
+        appendUnitsTypeSymbol(unitsSuffix, units, true); // also excludes dimensionless, e.g. pH
+        if (unitsSuffix.length() == 1) { unitsSuffix.truncate(0); }
+        log(Hydro_LogLevel_Info, logArg(fieldStr), logArg(value, defaultDecimalPlaces() + additionalDecPlaces),
+            unitsSuffix.length() ? logArg(unitsSuffix.c_str()) : HydroLogArg());
+    }
+}
+
+void HydroLogger::logTimeSpan(Hydro_String fieldStr, uint32_t seconds)
+{
+    if (isLevelEnabled(Hydro_LogLevel_Info)) {
+        HydroFixedString<16> timeSpan;
+        timeSpan.appendTimeSpan(seconds);
+        log(Hydro_LogLevel_Info, logArg(fieldStr), logArg(timeSpan.c_str()), HydroLogArg());
+    }
+}
+
+void HydroLogger::logTimeOfDay(Hydro_String fieldStr, time_t time)
+{
+    if (isLevelEnabled(Hydro_LogLevel_Info)) {
+        DateTime dateTime((uint32_t)time);
+        HydroFixedString<9> timeOfDay;
+        timeOfDay.appendTime(dateTime.hour(), dateTime.minute(), dateTime.second());
+        log(Hydro_LogLevel_Info, logArg(fieldStr), logArg(timeOfDay.c_str()), HydroLogArg());
     }
 }
 
 void HydroLogger::logMessage(const String &msg, const String &suffix1, const String &suffix2)
 {
     if (!hasLoggerData() || (loggerData()->logLevel != Hydro_LogLevel_None && loggerData()->logLevel <= Hydro_LogLevel_All)) {
-        log(HydroLogEvent(Hydro_LogLevel_Info, SFP(HStr_Log_Prefix_Info), msg, suffix1, suffix2));
+        log(HydroLogEvent(Hydro_LogLevel_Info, msg.c_str(), suffix1.c_str(), suffix2.c_str()));
     }
 }
 
 void HydroLogger::logWarning(const String &warn, const String &suffix1, const String &suffix2)
 {
     if (!hasLoggerData() || (loggerData()->logLevel != Hydro_LogLevel_None && loggerData()->logLevel <= Hydro_LogLevel_Warnings)) {
-        log(HydroLogEvent(Hydro_LogLevel_Warnings, SFP(HStr_Log_Prefix_Warning), warn, suffix1, suffix2));
+        log(HydroLogEvent(Hydro_LogLevel_Warnings, warn.c_str(), suffix1.c_str(), suffix2.c_str()));
     }
 }
 
 void HydroLogger::logError(const String &err, const String &suffix1, const String &suffix2)
 {
     if (!hasLoggerData() || (loggerData()->logLevel != Hydro_LogLevel_None && loggerData()->logLevel <= Hydro_LogLevel_Errors)) {
-        log(HydroLogEvent(Hydro_LogLevel_Errors, SFP(HStr_Log_Prefix_Error), err, suffix1, suffix2));
+        log(HydroLogEvent(Hydro_LogLevel_Errors, err.c_str(), suffix1.c_str(), suffix2.c_str()));
     }
 }
 
-void HydroLogger::log(const HydroLogEvent &event)
+void HydroLogger::logMessage(const HydroLogArg &msg, const HydroLogArg &suffix1, const HydroLogArg &suffix2, const HydroLogArg &suffix3)
+{
+    if (isLevelEnabled(Hydro_LogLevel_Info)) { log(Hydro_LogLevel_Info, msg, suffix1, suffix2, suffix3); }
+}
+
+void HydroLogger::logWarning(const HydroLogArg &warn, const HydroLogArg &suffix1, const HydroLogArg &suffix2, const HydroLogArg &suffix3)
+{
+    if (isLevelEnabled(Hydro_LogLevel_Warnings)) { log(Hydro_LogLevel_Warnings, warn, suffix1, suffix2, suffix3); }
+}
+
+void HydroLogger::logError(const HydroLogArg &err, const HydroLogArg &suffix1, const HydroLogArg &suffix2, const HydroLogArg &suffix3)
+{
+    if (isLevelEnabled(Hydro_LogLevel_Errors)) { log(Hydro_LogLevel_Errors, err, suffix1, suffix2, suffix3); }
+}
+
+void HydroLogger::log(Hydro_LogLevel level, const HydroLogArg &msg, const HydroLogArg &suffix1, const HydroLogArg &suffix2, const HydroLogArg &suffix3)
+{
+    bool logBinary = isLoggingBinary();
+
+    if (logBinary) {
+        if (isLoggingEnabled()) {
+            HydroLogRecordWriter<HYDRO_LOG_RECORD_MAXSIZE> record;
+            record.begin(level, localNow().unixtime());
+            record.add(msg);
+            record.add(suffix1);
+            record.add(suffix2);
+            record.add(suffix3);
+            record.end();
+            writeRecord(record.data(), record.size());
+        }
+
+        #ifndef HYDRO_ENABLE_DEBUG_OUTPUT
+            if (_logSignal.isEmpty()) { return; } // no one left needing text
+        #endif
+    }
+
+    HydroLogEvent event(level);
+    hydroAppendLogArg(event.msg, msg, HydroLogArgResolver());
+    hydroAppendLogArg(event.suffix1, suffix1, HydroLogArgResolver());
+    hydroAppendLogArg(event.suffix2, suffix2, HydroLogArgResolver());
+    hydroAppendLogArg(event.suffix2, suffix3, HydroLogArgResolver());
+    log(event, !logBinary);
+}
+
+void HydroLogger::log(const HydroLogEvent &event, bool toFiles)
 {
     #ifdef HYDRO_ENABLE_DEBUG_OUTPUT
         if (Serial) {
-            Serial.print(event.timestamp);
+            Serial.print(event.timestamp.c_str());
             Serial.print(' ');
-            Serial.print(event.prefix);
-            Serial.print(event.msg);
-            Serial.print(event.suffix1);
-            Serial.println(event.suffix2);
+            Serial.print(event.prefix.c_str());
+            Serial.print(event.msg.c_str());
+            Serial.print(event.suffix1.c_str());
+            Serial.println(event.suffix2.c_str());
         }
     #endif
 
-    if (isLoggingToSDCard()) {
-        auto sd = Hydruino::_activeInstance->getSDCard(HYDRO_LOFS_BEGIN);
-
-        if (sd) {
-            #if HYDRO_SYS_LEAVE_FILES_OPEN
-                auto &logFile = _logFileSD ? *_logFileSD : *(_logFileSD = new File(sd->open(_logFilename.c_str(), FILE_WRITE)));
-            #else
-                createDirectoryFor(sd, _logFilename);
-                auto logFile = sd->open(_logFilename.c_str(), FILE_WRITE);
-            #endif
+    if (toFiles && isLoggingBinary()) {
+        toFiles = false; // binary record replaces text lines
+
+        if (isLoggingEnabled()) {
+            HydroLogRecordWriter<HYDRO_LOG_RECORD_MAXSIZE> record;
+            record.begin(event.level, localNow().unixtime());
+            record.add(HydroLogArg::chars(event.msg.c_str()));
+            record.add(HydroLogArg::chars(event.suffix1.c_str()));
+            record.add(HydroLogArg::chars(event.suffix2.c_str()));
+            record.end();
+            writeRecord(record.data(), record.size());
+        }
+    }
 
-            if (logFile) {
-                logFile.print(event.timestamp);
-                logFile.print(' ');
-                logFile.print(event.prefix);
-                logFile.print(event.msg);
-                logFile.print(event.suffix1);
-                logFile.println(event.suffix2);
-
-                #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                    logFile.flush();
-                    logFile.close();
-                #endif
-            }
+    if (toFiles && isLoggingToSDCard()) {
+        auto logFile = Hydruino::_activeInstance->getSDFile(_logFilename.c_str(), true);
 
-            #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                Hydruino::_activeInstance->endSDCard(sd);
-            #endif
+        if (logFile) {
+            logFile->print(event.timestamp.c_str());
+            logFile->print(' ');
+            logFile->print(event.prefix.c_str());
+            logFile->print(event.msg.c_str());
+            logFile->print(event.suffix1.c_str());
+            logFile->println(event.suffix2.c_str());
+
+            Hydruino::_activeInstance->endSDFile(logFile);
         }
     }
 
 #ifdef HYDRO_USE_WIFI_STORAGE
 
-    if (isLoggingToWiFiStorage()) {
+    if (toFiles && isLoggingToWiFiStorage()) {
         #if HYDRO_SYS_LEAVE_FILES_OPEN
             auto &logFile = _logFileWS ? *_logFileWS : *(_logFileWS = new WiFiStorageFile(WiFiStorage.open(_logFilename.c_str())));
         #else
@@ -196,12 +309,12 @@ void HydroLogger::log(const HydroLogEvent &event)
         if (logFile) {
             auto logFileStream = HydroWiFiStorageFileStream(logFile, logFile.size());
 
-            logFileStream.print(event.timestamp);
+            logFileStream.print(event.timestamp.c_str());
             logFileStream.print(' ');
-            logFileStream.print(event.prefix);
-            logFileStream.print(event.msg);
-            logFileStream.print(event.suffix1);
-            logFileStream.println(event.suffix2);
+            logFileStream.print(event.prefix.c_str());
+            logFileStream.print(event.msg.c_str());
+            logFileStream.print(event.suffix1.c_str());
+            logFileStream.println(event.suffix2.c_str());
 
             #if !HYDRO_SYS_LEAVE_FILES_OPEN
                 logFileStream.flush();
@@ -213,20 +326,63 @@ void HydroLogger::log(const HydroLogEvent &event)
 #endif
 
     #ifdef HYDRO_USE_MULTITASKING
-        scheduleSignalFireOnce<const HydroLogEvent>(_logSignal, event);
+        scheduleSignalFireOnce<const HydroLogEvent &>(_logSignal, event);
     #else
         _logSignal.fire(event);
     #endif
 }
 
+void HydroLogger::writeRecord(const uint8_t *recordData, size_t recordSize)
+{
+    if (isLoggingToSDCard()) {
+        auto logFile = Hydruino::_activeInstance->getSDFile(_logFilename.c_str(), true);
+
+        if (logFile) {
+            if (!logFile->size()) {
+                uint8_t header[HydroLogFileHeader::PackedSize];
+                logFileHeader().pack(header);
+                logFile->write(header, sizeof(header));
+            }
+            logFile->write(recordData, recordSize);
+
+            Hydruino::_activeInstance->endSDFile(logFile);
+        }
+    }
+
+#ifdef HYDRO_USE_WIFI_STORAGE
+
+    if (isLoggingToWiFiStorage()) {
+        #if HYDRO_SYS_LEAVE_FILES_OPEN
+            auto &logFile = _logFileWS ? *_logFileWS : *(_logFileWS = new WiFiStorageFile(WiFiStorage.open(_logFilename.c_str())));
+        #else
+            auto logFile = WiFiStorage.open(_logFilename.c_str());
+        #endif
+
+        if (logFile) {
+            auto logFileStream = HydroWiFiStorageFileStream(logFile, logFile.size());
+            if (!logFile.size()) {
+                uint8_t header[HydroLogFileHeader::PackedSize];
+                logFileHeader().pack(header);
+                logFileStream.write(header, sizeof(header));
+            }
+            logFileStream.write(recordData, recordSize);
+
+            #if !HYDRO_SYS_LEAVE_FILES_OPEN
+                logFileStream.flush();
+                logFile.close();
+            #endif
+        }
+    }
+
+#endif
+}
+
 void HydroLogger::flush()
 {
     #ifdef HYDRO_ENABLE_DEBUG_OUTPUT
         if (Serial) { Serial.flush(); }
     #endif
-    #if HYDRO_SYS_LEAVE_FILES_OPEN
-        if(_logFileSD) { _logFileSD->flush(); }
-    #endif
+    if (Hydruino::_activeInstance) { Hydruino::_activeInstance->flushSDFiles(); }
     yield();
 }
 
@@ -239,7 +395,21 @@ void HydroLogger::setLogLevel(Hydro_LogLevel logLevel)
     }
 }
 
-Signal<const HydroLogEvent, HYDRO_LOG_SIGNAL_SLOTS> &HydroLogger::getLogSignal()
+void HydroLogger::setLogBinary(bool logBinary)
+{
+    HYDRO_SOFT_ASSERT(hasLoggerData(), SFP(HStr_Err_NotYetInitialized));
+    if (hasLoggerData() && Hydruino::_activeInstance->_systemData->logBinary != logBinary) {
+        Hydruino::_activeInstance->_systemData->logBinary = logBinary;
+        Hydruino::_activeInstance->_systemData->bumpRevisionIfNeeded();
+
+        #if HYDRO_SYS_LEAVE_FILES_OPEN && defined(HYDRO_USE_WIFI_STORAGE)
+            if (_logFileWS) { _logFileWS->close(); delete _logFileWS; _logFileWS = nullptr; }
+        #endif
+        notifyDateChanged(); // switches log file extension
+    }
+}
+
+Signal<const HydroLogEvent &, HYDRO_LOG_SIGNAL_SLOTS> &HydroLogger::getLogSignal()
 {
     return _logSignal;
 }
@@ -247,7 +417,7 @@ Signal<const HydroLogEvent, HYDRO_LOG_SIGNAL_SLOTS> &HydroLogger::getLogSignal()
 void HydroLogger::notifyDateChanged()
 {
     if (isLoggingEnabled()) {
-        _logFilename = getYYMMDDFilename(charsToString(loggerData()->logFilePrefix, 16), SFP(HStr_txt));
+        _logFilename = getYYMMDDFilename(charsToString(loggerData()->logFilePrefix, 16), SFP(isLoggingBinary() ? HStr_dat : HStr_txt));
         cleanupOldestLogs();
     }
 }
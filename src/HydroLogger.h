@@ -10,6 +10,7 @@ class HydroLogger;
 struct HydroLoggerSubData;
 
 #include "Hydruino.h"
+#include "HydroCoreLogic.h"
 
 // Logging Level
 // Log levels that can be filtered upon if desired.
@@ -22,22 +23,30 @@ enum Hydro_LogLevel : signed char {
 };
 
 // Logging Events
-// Logging event structure that is used in signaling.
+// Logging event structure that is used in signaling, passed by reference. Texts are held in fixed
+// buffers, so that events are assembled without heap use (overlong texts end in "...").
 struct HydroLogEvent {
     Hydro_LogLevel level;                                   // Log level
-    String timestamp;                                       // Timestamp (generated)
-    String prefix;                                          // Prefix
-    String msg;                                             // Message
-    String suffix1;                                         // Suffix1 (optional)
-    String suffix2;                                         // Suffix2 (optional)
+    HydroFixedString<20> timestamp;                         // Timestamp (generated, YYYY-MM-DDThh:mm:ss)
+    HydroFixedString<8> prefix;                             // Prefix (generated, by log level)
+    HydroFixedString<HYDRO_LOG_TEXT_MAXSIZE> msg;           // Message
+    HydroFixedString<HYDRO_LOG_TEXT_MAXSIZE> suffix1;       // Suffix1 (optional)
+    HydroFixedString<HYDRO_LOG_TEXT_MAXSIZE> suffix2;       // Suffix2 (optional)
 
     HydroLogEvent(Hydro_LogLevel levelIn,
-                  const String &prefixIn,
-                  const String &msgIn,
-                  const String &suffix1In = String(),
-                  const String &suffix2In = String());
+                  const char *msgIn = nullptr,
+                  const char *suffix1In = nullptr,
+                  const char *suffix2In = nullptr);
+    // Expands binary log record (see HydroLogRecordWriter) into event text, e.g. for UI display.
+    HydroLogEvent(const uint8_t *recordData, size_t recordSize);
 };
 
+// Log argument helpers, for structured logging (text expansion deferred).
+inline HydroLogArg logArg(Hydro_String strNum) { return HydroLogArg::string(strNum); }
+inline HydroLogArg logArg(const HydroIdentity &id) { return HydroLogArg::object(id.type, id.objTypeAs.idType, id.posIndex); }
+inline HydroLogArg logArg(float value, uint8_t decimals) { return HydroLogArg::number(value, decimals); }
+inline HydroLogArg logArg(const char *text) { return HydroLogArg::chars(text); }
+
 // Data Logger
 // The Logger acts as the system's event monitor that collects and reports on the various
 // processes of interest inside of the system. It allows for different log levels to be
@@ -46,59 +55,79 @@ struct HydroLogEvent {
 // avoid large string concatenations that can overstress and crash constrained devices.
 // Logging to SD card .txt log files (via SPI card reader) is supported as is logging to
 // WiFiStorage .txt log files (via OS/OTA filesystem / WiFiNINA_Generic only).
+// With binary logging set (see setLogBinary), log files instead hold compact binary records
+// (.dat) of the string table ids, object ids, and numbers logged (see HydroLogArg), with text
+// expansion deferred to the reader (tests/log_decode.py, or HydroLogEvent on device). Structured
+// log calls then skip building text entirely, unless debug output or log signal slots need it.
 class HydroLogger {
 public:
     HydroLogger();
     ~HydroLogger();
 
-    bool beginLoggingToSDCard(String logFilePrefix);
+    bool beginLoggingToSDCard(const String &logFilePrefix);
     inline bool isLoggingToSDCard() const;
 
 #ifdef HYDRO_USE_WIFI_STORAGE
-    bool beginLoggingToWiFiStorage(String logFilePrefix);
+    bool beginLoggingToWiFiStorage(const String &logFilePrefix);
     inline bool isLoggingToWiFiStorage() const;
 #endif
 
     inline void logActivation(const HydroActuator *actuator);
     inline void logDeactivation(const HydroActuator *actuator);
     inline void logProcess(const HydroObjInterface *obj, const String &processString = String(), const String &statusString = String());
+    inline void logProcess(const HydroObjInterface *obj, Hydro_String processStr, Hydro_String statusStr = HStr_Count);
     inline void logStatus(const HydroObjInterface *obj, const String &statusString = String());
+    inline void logStatus(const HydroObjInterface *obj, Hydro_String statusStr);
 
     void logSystemUptime();
-    inline void logSystemSave() { logMessage(SFP(HStr_Log_SystemDataSaved)); }
+    inline void logSystemSave() { logMessage(logArg(HStr_Log_SystemDataSaved)); }
+    // Logs field name with measured/setpoint value (at default decimal places, plus additional) and units.
+    void logMeasurement(Hydro_String fieldStr, float value, Hydro_UnitsType units, unsigned int additionalDecPlaces = 0);
+    inline void logMeasurement(Hydro_String fieldStr, const HydroSingleMeasurement &measurement, unsigned int additionalDecPlaces = 0);
+    // Logs field name with time span, in seconds (e.g. "1d 2h 5s").
+    void logTimeSpan(Hydro_String fieldStr, uint32_t seconds);
+    // Logs field name with time of day (hh:mm:ss).
+    void logTimeOfDay(Hydro_String fieldStr, time_t time);
 
     void logMessage(const String &msg, const String &suffix1 = String(), const String &suffix2 = String());
     void logWarning(const String &warn, const String &suffix1 = String(), const String &suffix2 = String());
     void logError(const String &err, const String &suffix1 = String(), const String &suffix2 = String());
+    // Structured log methods (see logArg), with text expansion deferred until needed. Text logs append suffix3 to suffix2.
+    void logMessage(const HydroLogArg &msg, const HydroLogArg &suffix1 = HydroLogArg(), const HydroLogArg &suffix2 = HydroLogArg(), const HydroLogArg &suffix3 = HydroLogArg());
+    void logWarning(const HydroLogArg &warn, const HydroLogArg &suffix1 = HydroLogArg(), const HydroLogArg &suffix2 = HydroLogArg(), const HydroLogArg &suffix3 = HydroLogArg());
+    void logError(const HydroLogArg &err, const HydroLogArg &suffix1 = HydroLogArg(), const HydroLogArg &suffix2 = HydroLogArg(), const HydroLogArg &suffix3 = HydroLogArg());
     void flush();
 
     void setLogLevel(Hydro_LogLevel logLevel);
     inline Hydro_LogLevel getLogLevel() const;
+    // Sets if log files hold binary records (YYMMDD.dat) instead of text (YYMMDD.txt), switching today's log file.
+    void setLogBinary(bool logBinary);
+    inline bool isLoggingBinary() const;
 
     inline bool isLoggingEnabled() const;
+    inline bool isLevelEnabled(Hydro_LogLevel level) const { return !hasLoggerData() || (loggerData()->logLevel != Hydro_LogLevel_None && loggerData()->logLevel <= level); }
     inline time_t getSystemInit() const { return _initTime; }
     inline time_t getSystemUptime() const { return unixNow() - (_initTime ?: SECS_YR_2000); }
 
-    Signal<const HydroLogEvent, HYDRO_LOG_SIGNAL_SLOTS> &getLogSignal();
+    Signal<const HydroLogEvent &, HYDRO_LOG_SIGNAL_SLOTS> &getLogSignal();
 
     void notifyDateChanged();
 
 protected:
-#if HYDRO_SYS_LEAVE_FILES_OPEN
-    File *_logFileSD;                                       // SD card log file instance (owned)
-#ifdef HYDRO_USE_WIFI_STORAGE
+#if HYDRO_SYS_LEAVE_FILES_OPEN && defined(HYDRO_USE_WIFI_STORAGE)
     WiFiStorageFile *_logFileWS;                            // WiFiStorageFile log file instance (owned)
-#endif
 #endif
     String _logFilename;                                    // Resolved log file name (based on day)
     time_t _initTime;                                       // Time of init, for uptime (UTC)
     time_t _lastSpaceCheck;                                 // Last time enough space was checked (UTC)
 
-    Signal<const HydroLogEvent, HYDRO_LOG_SIGNAL_SLOTS> _logSignal; // Logging signal
+    Signal<const HydroLogEvent &, HYDRO_LOG_SIGNAL_SLOTS> _logSignal; // Logging signal
 
     friend class Hydruino;
 
-    void log(const HydroLogEvent &event);
+    void log(const HydroLogEvent &event, bool toFiles = true);
+    void log(Hydro_LogLevel level, const HydroLogArg &msg, const HydroLogArg &suffix1, const HydroLogArg &suffix2, const HydroLogArg &suffix3 = HydroLogArg());
+    void writeRecord(const uint8_t *recordData, size_t recordSize);
 
 public: // consider protected
     inline HydroLoggerSubData *loggerData() const;
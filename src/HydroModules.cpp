@@ -220,6 +220,12 @@ SharedPtr<HydroObject> HydroObjectRegistration::objectById(HydroIdentity id) con
     return nullptr;
 }
 
+SharedPtr<HydroObject> HydroObjectRegistration::objectByKey(hkey_t key) const
+{
+    auto iter = _objects.find(key);
+    return iter != _objects.end() ? iter->second : nullptr;
+}
+
 SharedPtr<HydroObject> HydroObjectRegistration::objectById_Col(const HydroIdentity &id) const
 {
     HYDRO_SOFT_ASSERT(false, F("Hashing collision")); // exhaustive search must be performed, publishing may miss values
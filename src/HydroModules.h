@@ -70,6 +70,8 @@ public:
 
     // Searches for object by id key (nullptr return = no obj by that id, position index may use HYDRO_POS_SEARCH* defines)
     SharedPtr<HydroObject> objectById(HydroIdentity id) const;
+    // Looks up object by its key alone (nullptr return = no obj by that key)
+    SharedPtr<HydroObject> objectByKey(hkey_t key) const;
 
     // Finds first position either open or taken, given the id type
     hposi_t firstPosition(HydroIdentity id, bool taken);
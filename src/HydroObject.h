@@ -134,6 +134,8 @@ public:
     virtual hkey_t getKey() const override;
     // Returns the key string of the object
     virtual String getKeyString() const override;
+    // Returns the key string chars of the object (no copy)
+    inline const char *getKeyChars() const { return _id.keyString.c_str(); }
     // Returns the SharedPtr instance for this object
     virtual SharedPtr<HydroObjInterface> getSharedPtr() const override;
     // Returns the SharedPtr instance for passed object
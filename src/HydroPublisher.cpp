@@ -6,32 +6,25 @@
 #include "Hydruino.h"
 
 HydroPublisher::HydroPublisher()
-    : _dataFilename(), _needsTabulation(false), _pollingFrame(0), _dataColumns(nullptr), _columnSize(0)
-#if HYDRO_SYS_LEAVE_FILES_OPEN
-      , _dataFileSD(nullptr)
+    : _pollingFrame(0), _needsTabulation(false), _columnSize(0), _dataColumns(nullptr), _sdCardSink(nullptr),
 #ifdef HYDRO_USE_WIFI_STORAGE
-      , _dataFileWS(nullptr)
-#endif
+      _wifiStorageSink(nullptr),
 #endif
 #ifdef HYDRO_USE_MQTT
-    , _mqttClient(nullptr)
+      _mqttSink(nullptr),
 #endif
+      _sinks{nullptr}
 { ; }
 
 HydroPublisher::~HydroPublisher()
 {
     if (_dataColumns) { delete [] _dataColumns; _dataColumns = nullptr; }
-    #if HYDRO_SYS_LEAVE_FILES_OPEN
-        if (_dataFileSD) { _dataFileSD->flush(); _dataFileSD->close(); delete _dataFileSD; _dataFileSD = nullptr; }
-        #ifdef HYDRO_USE_WIFI_STORAGE
-            if (_dataFileWS) { _dataFileWS->close(); delete _dataFileWS; _dataFileWS = nullptr; }
-        #endif
+    if (_sdCardSink) { delete _sdCardSink; _sdCardSink = nullptr; }
+    #ifdef HYDRO_USE_WIFI_STORAGE
+        if (_wifiStorageSink) { delete _wifiStorageSink; _wifiStorageSink = nullptr; }
     #endif
     #ifdef HYDRO_USE_MQTT
-        if (_mqttClient) {
-            if (_mqttClient->connected()) { _mqttClient->disconnect(); }
-            delete _mqttClient; _mqttClient = nullptr;
-        }
+        if (_mqttSink) { delete _mqttSink; _mqttSink = nullptr; }
     #endif
 }
 
@@ -41,44 +34,31 @@ void HydroPublisher::update()
         if (_needsTabulation) { performTabulation(); }
 
         publishIfNeeded();
+
+        for (int sinkIndex = 0; sinkIndex < HYDRO_PUBLISH_SINK_SLOTS && _sinks[sinkIndex]; ++sinkIndex) {
+            _sinks[sinkIndex]->update();
+        }
     }
 }
 
-bool HydroPublisher::beginPublishingToSDCard(String dataFilePrefix)
+bool HydroPublisher::beginPublishingToSDCard(const String &dataFilePrefix)
 {
     HYDRO_SOFT_ASSERT(hasPublisherData(), SFP(HStr_Err_NotYetInitialized));
 
     if (hasPublisherData() && !publisherData()->pubToSDCard) {
-        auto sd = Hydruino::_activeInstance->getSDCard();
-
-        if (sd) {
-            String dataFilename = getYYMMDDFilename(dataFilePrefix, SFP(HStr_csv));
-            createDirectoryFor(sd, dataFilename);
-            #if HYDRO_SYS_LEAVE_FILES_OPEN
-                auto &dataFile = _dataFileSD ? *_dataFileSD : *(_dataFileSD = new File(sd->open(dataFilename.c_str(), FILE_WRITE)));
-            #else
-                auto dataFile = sd->open(dataFilename.c_str(), FILE_WRITE);
-            #endif
-
-            if (dataFile) {
-                #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                    dataFile.close();
-                    Hydruino::_activeInstance->endSDCard(sd);
-                #endif
+        String dataFilename = getYYMMDDFilename(dataFilePrefix, SFP(HStr_csv));
+        auto dataFile = Hydruino::_activeInstance->getSDFile(dataFilename.c_str(), true);
 
-                strncpy(publisherData()->dataFilePrefix, dataFilePrefix.c_str(), 16);
-                publisherData()->pubToSDCard = true;
-                _dataFilename = dataFilename;
+        if (dataFile) {
+            Hydruino::_activeInstance->endSDFile(dataFile);
 
-                setNeedsTabulation();
-                Hydruino::_activeInstance->_systemData->bumpRevisionIfNeeded();
+            strncpy(publisherData()->dataFilePrefix, dataFilePrefix.c_str(), 16);
+            publisherData()->pubToSDCard = true;
 
-                return true;
-            }
+            setNeedsTabulation();
+            Hydruino::_activeInstance->_systemData->bumpRevisionIfNeeded();
 
-            #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                Hydruino::_activeInstance->endSDCard(sd);
-            #endif
+            return true;
         }
     }
 
@@ -87,26 +67,19 @@ bool HydroPublisher::beginPublishingToSDCard(String dataFilePrefix)
 
 #ifdef HYDRO_USE_WIFI_STORAGE
 
-bool HydroPublisher::beginPublishingToWiFiStorage(String dataFilePrefix)
+bool HydroPublisher::beginPublishingToWiFiStorage(const String &dataFilePrefix)
 {
     HYDRO_SOFT_ASSERT(hasPublisherData(), SFP(HStr_Err_NotYetInitialized));
 
     if (hasPublisherData() && !publisherData()->pubToWiFiStorage) {
         String dataFilename = getYYMMDDFilename(dataFilePrefix, SFP(HStr_csv));
-        #if HYDRO_SYS_LEAVE_FILES_OPEN
-            auto &dataFile = _dataFileWS ? *_dataFileWS : *(_dataFileWS = new WiFiStorageFile(WiFiStorage.open(dataFilename.c_str())));
-        #else
-            auto dataFile = WiFiStorage.open(dataFilename.c_str());
-        #endif
+        auto dataFile = WiFiStorage.open(dataFilename.c_str());
 
         if (dataFile) {
-            #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                dataFile.close();
-            #endif
+            dataFile.close();
 
             strncpy(publisherData()->dataFilePrefix, dataFilePrefix.c_str(), 16);
             publisherData()->pubToWiFiStorage = true;
-            _dataFilename = dataFilename;
 
             setNeedsTabulation();
             Hydruino::_activeInstance->_systemData->bumpRevisionIfNeeded();
@@ -121,27 +94,16 @@ bool HydroPublisher::beginPublishingToWiFiStorage(String dataFilePrefix)
 #endif
 #ifdef HYDRO_USE_MQTT
 
-static uint32_t mqttNow()
-{
-    return unixNow();
-}
-
-bool HydroPublisher::beginPublishingToMQTTClient(MQTTClient &client)
+bool HydroPublisher::beginPublishingToMQTTClient(MQTTClient &client, bool batchFrames, int qos)
 {
     HYDRO_SOFT_ASSERT(hasPublisherData(), SFP(HStr_Err_NotYetInitialized));
 
-    if (hasPublisherData() && !_mqttClient) {
-        _mqttClient = &client;
-        _mqttClient->setClockSource(&mqttNow);
-        if (!_mqttClient->connected()) {
-            String unPw = String(F("public"));
-            _mqttClient->connect(Hydruino::_activeInstance->getSystemName().c_str(),
-                                 unPw.c_str(), unPw.c_str());
-        }
-
-        setNeedsTabulation();
+    if (hasPublisherData() && !_mqttSink) {
+        _mqttSink = new HydroMQTTDataSink(client, charsToString(publisherData()->dataFilePrefix, 16) + 'o', batchFrames, qos);
+        HYDRO_SOFT_ASSERT(_mqttSink, SFP(HStr_Err_AllocationFailure));
 
-        return true;
+        if (_mqttSink && !beginSink(_mqttSink)) { delete _mqttSink; _mqttSink = nullptr; }
+        return _mqttSink;
     }
 
     return false;
@@ -171,6 +133,46 @@ hposi_t HydroPublisher::getColumnIndexStart(hkey_t sensorKey)
     return (hposi_t)-1;
 }
 
+bool HydroPublisher::setSensorDeadband(const String &sensorKeyName, float deadband, uint16_t heartbeat)
+{
+    HYDRO_SOFT_ASSERT(hasPublisherData(), SFP(HStr_Err_NotYetInitialized));
+
+    if (hasPublisherData() && publisherData()->setDeadband(sensorKeyName.c_str(), deadband, heartbeat)) {
+        setNeedsTabulation();
+        Hydruino::_activeInstance->_systemData->bumpRevisionIfNeeded();
+
+        return true;
+    }
+
+    return false;
+}
+
+bool HydroPublisher::addSink(HydroPublisherSinkInterface *sink)
+{
+    for (int sinkIndex = 0; sink && sinkIndex < HYDRO_PUBLISH_SINK_SLOTS; ++sinkIndex) {
+        if (_sinks[sinkIndex] == sink) { return true; }
+        if (!_sinks[sinkIndex]) {
+            _sinks[sinkIndex] = sink;
+            if (_dataColumns) { sink->notifyTabulated(_columnSize, _dataColumns); }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool HydroPublisher::removeSink(HydroPublisherSinkInterface *sink)
+{
+    // used slots are kept packed at front
+    for (int sinkIndex = 0; sink && sinkIndex < HYDRO_PUBLISH_SINK_SLOTS; ++sinkIndex) {
+        if (_sinks[sinkIndex] == sink) {
+            for (; sinkIndex + 1 < HYDRO_PUBLISH_SINK_SLOTS; ++sinkIndex) { _sinks[sinkIndex] = _sinks[sinkIndex + 1]; }
+            _sinks[HYDRO_PUBLISH_SINK_SLOTS - 1] = nullptr;
+            return true;
+        }
+    }
+    return false;
+}
+
 Signal<Pair<uint8_t, const HydroDataColumn *>, HYDRO_PUBLISH_SIGNAL_SLOTS> &HydroPublisher::getPublishSignal()
 {
     return _publishSignal;
@@ -178,9 +180,8 @@ Signal<Pair<uint8_t, const HydroDataColumn *>, HYDRO_PUBLISH_SIGNAL_SLOTS> &Hydr
 
 void HydroPublisher::notifyDateChanged()
 {
-    if (isPublishingEnabled()) {
-        _dataFilename = getYYMMDDFilename(charsToString(publisherData()->dataFilePrefix, 16), SFP(HStr_csv));
-        cleanupOldestData();
+    for (int sinkIndex = 0; sinkIndex < HYDRO_PUBLISH_SINK_SLOTS && _sinks[sinkIndex]; ++sinkIndex) {
+        _sinks[sinkIndex]->notifyDateChanged();
     }
 }
 
@@ -237,89 +238,29 @@ void HydroPublisher::publishIfNeeded()
 
 void HydroPublisher::publish(time_t timestamp)
 {
-    if (isPublishingToSDCard()) {
-        auto sd = Hydruino::_activeInstance->getSDCard(HYDRO_LOFS_BEGIN);
-
-        if (sd) {
-            #if HYDRO_SYS_LEAVE_FILES_OPEN
-                auto &dataFile = _dataFileSD ? *_dataFileSD : *(_dataFileSD = new File(sd->open(_dataFilename.c_str(), FILE_WRITE)));
-            #else
-                createDirectoryFor(sd, _dataFilename);
-                auto dataFile = sd->open(_dataFilename.c_str(), FILE_WRITE);
-            #endif
-
-            if (dataFile) {
-                dataFile.print(timestamp);
-
-                for (int columnIndex = 0; columnIndex < _columnSize; ++columnIndex) {
-                    dataFile.print(',');
-                    dataFile.print(_dataColumns[columnIndex].measurement.value);
-                }
-
-                dataFile.println();
-
-                #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                    dataFile.flush();
-                    dataFile.close();
-                #endif
-            }
-
-            #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                Hydruino::_activeInstance->endSDCard(sd);
-            #endif
+    bool anyChanged = false;
+    for (int columnIndex = 0; columnIndex < _columnSize; ++columnIndex) {
+        auto &column = _dataColumns[columnIndex];
+        column.changed = hydroShouldPublishValue(column.measurement.value, column.publishedValue, (uint32_t)timestamp, (uint32_t)column.publishedTime,
+                                                 column.deadband, column.heartbeat);
+        if (column.changed) {
+            column.publishedValue = column.measurement.value;
+            column.publishedTime = timestamp;
+            anyChanged = true;
         }
     }
 
-#ifdef HYDRO_USE_WIFI_STORAGE
+    for (int sinkIndex = 0; sinkIndex < HYDRO_PUBLISH_SINK_SLOTS && _sinks[sinkIndex]; ++sinkIndex) {
+        _sinks[sinkIndex]->publishFrame(timestamp, _columnSize, _dataColumns);
+    }
 
-    if (isPublishingToWiFiStorage()) {
-        #if HYDRO_SYS_LEAVE_FILES_OPEN
-            auto &dataFile = _dataFileWS ? *_dataFileWS : *(_dataFileWS = new WiFiStorageFile(WiFiStorage.open(_dataFilename.c_str())));
+    if (anyChanged) {
+        #ifdef HYDRO_USE_MULTITASKING
+            scheduleSignalFireOnce<Pair<uint8_t, const HydroDataColumn *>>(_publishSignal, make_pair(_columnSize, (const HydroDataColumn *)_dataColumns));
         #else
-            auto dataFile = WiFiStorage.open(_dataFilename.c_str());
+            _publishSignal.fire(make_pair(_columnSize, (const HydroDataColumn *)_dataColumns));
         #endif
-
-        if (dataFile) {
-            auto dataFileStream = HydroWiFiStorageFileStream(dataFile, dataFile.size());
-            dataFileStream.print(timestamp);
-
-            for (int columnIndex = 0; columnIndex < _columnSize; ++columnIndex) {
-                dataFileStream.print(',');
-                dataFileStream.print(_dataColumns[columnIndex].measurement.value);
-            }
-
-            dataFileStream.println();
-            #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                dataFile.close();
-            #endif
-        }
     }
-
-#endif
-#ifdef HYDRO_USE_MQTT
-
-    if (isPublishingToMQTTClient()) {
-        String systemName = Hydruino::_activeInstance->getSystemName();
-        for (int columnIndex = 0; columnIndex < _columnSize; ++columnIndex) {
-            auto sensor = (HydroSensor *)(Hydruino::_activeInstance->_objects[_dataColumns[columnIndex].sensorKey].get());
-            if (sensor) {
-                String topic; topic.reserve(systemName.length() + 1 + sensor->getKeyString().length() + 1);
-                topic.concat(systemName);
-                topic.concat('/');
-                topic.concat(sensor->getKeyString());
-                String payload = String(_dataColumns[columnIndex].measurement.value, 6); // skipping units/rounding/etc to allow MQTT broker full value data
-                _mqttClient->publish(topic.c_str(), payload.c_str());
-            }
-        }
-    }
-
-#endif
-
-    #ifdef HYDRO_USE_MULTITASKING
-        scheduleSignalFireOnce<Pair<uint8_t, const HydroDataColumn *>>(_publishSignal, make_pair(_columnSize, (const HydroDataColumn *)_dataColumns));
-    #else
-        _publishSignal.fire(make_pair(_columnSize, (const HydroDataColumn *)_dataColumns));
-    #endif
 }
 
 void HydroPublisher::performTabulation()
@@ -366,6 +307,9 @@ void HydroPublisher::performTabulation()
                             HYDRO_HARD_ASSERT(columnIndex < _columnSize, SFP(HStr_Err_OperationFailure));
                             _dataColumns[columnIndex].measurement = getAsSingleMeasurement(measurement, rowIndex);
                             _dataColumns[columnIndex].sensorKey = sensor->getKey();
+                            _dataColumns[columnIndex].changed = true;
+                            _dataColumns[columnIndex].publishedValue = NAN;
+                            _dataColumns[columnIndex].publishedTime = 0;
                             columnIndex++;
                         }
                     }
@@ -373,128 +317,578 @@ void HydroPublisher::performTabulation()
             }
         }
 
-        resetDataFile();
+        for (int sinkIndex = 0; sinkIndex < HYDRO_PUBLISH_SINK_SLOTS && _sinks[sinkIndex]; ++sinkIndex) {
+            _sinks[sinkIndex]->notifyTabulated(_columnSize, _dataColumns);
+        }
+    }
+
+    for (int columnIndex = 0; columnIndex < _columnSize; ++columnIndex) {
+        auto deadband = publisherData()->getDeadband(_dataColumns[columnIndex].sensorKey);
+        _dataColumns[columnIndex].deadband = deadband ? deadband->deadband : -1.0f;
+        _dataColumns[columnIndex].heartbeat = deadband ? deadband->heartbeat : 0;
     }
 
     _needsTabulation = false;
+
+    beginSinks();
 }
 
-void HydroPublisher::resetDataFile()
+void HydroPublisher::beginSinks()
 {
-    if (isPublishingToSDCard()) {
-        auto sd = Hydruino::_activeInstance->getSDCard(HYDRO_LOFS_BEGIN);
+    // built-in sinks of persisted publishing services, began once tabulated (notified of columns when added)
+    if (publisherData()->pubToSDCard && !_sdCardSink) {
+        _sdCardSink = new HydroSDCardDataSink(charsToString(publisherData()->dataFilePrefix, 16));
+        HYDRO_SOFT_ASSERT(_sdCardSink, SFP(HStr_Err_AllocationFailure));
 
-        if (sd) {
-            #if HYDRO_SYS_LEAVE_FILES_OPEN
-                if (_dataFileSD) { _dataFileSD->flush(); _dataFileSD->close(); delete _dataFileSD; _dataFileSD = nullptr; }
-            #endif
-            if (sd->exists(_dataFilename.c_str())) {
-                sd->remove(_dataFilename.c_str());
-            }
-            #if HYDRO_SYS_LEAVE_FILES_OPEN
-                auto &dataFile = _dataFileSD ? *_dataFileSD : *(_dataFileSD = new File(sd->open(_dataFilename.c_str(), FILE_WRITE)));
-            #else
-                createDirectoryFor(sd, _dataFilename);
-                auto dataFile = sd->open(_dataFilename.c_str(), FILE_WRITE);
-            #endif
+        if (_sdCardSink && !beginSink(_sdCardSink)) { delete _sdCardSink; _sdCardSink = nullptr; }
+    }
 
-            if (dataFile) {
-                HydroSensor *lastSensor = nullptr;
-                uint8_t measurementRow = 0;
+    #ifdef HYDRO_USE_WIFI_STORAGE
+        if (publisherData()->pubToWiFiStorage && !_wifiStorageSink) {
+            _wifiStorageSink = new HydroWiFiStorageDataSink(charsToString(publisherData()->dataFilePrefix, 16));
+            HYDRO_SOFT_ASSERT(_wifiStorageSink, SFP(HStr_Err_AllocationFailure));
 
-                dataFile.print(SFP(HStr_Key_Timestamp));
+            if (_wifiStorageSink && !beginSink(_wifiStorageSink)) { delete _wifiStorageSink; _wifiStorageSink = nullptr; }
+        }
+    #endif
+}
 
-                for (int columnIndex = 0; columnIndex < _columnSize; ++columnIndex) {
-                    dataFile.print(',');
+bool HydroPublisher::beginSink(HydroPublisherSinkInterface *sink)
+{
+    bool added = addSink(sink);
+    HYDRO_SOFT_ASSERT(added, SFP(HStr_Err_OperationFailure)); // out of sink slots
+    return added;
+}
+
+void HydroPublisher::cleanupOldestData(bool force)
+{
+    if (_sdCardSink) { _sdCardSink->cleanupOldestData(force); }
+}
 
-                    auto sensor = (HydroSensor *)(Hydruino::_activeInstance->_objects[_dataColumns[columnIndex].sensorKey].get());
-                    if (sensor && sensor == lastSensor) { ++measurementRow; }
-                    else { measurementRow = 0; lastSensor = sensor; }
 
-                    if (sensor) {
-                        dataFile.print(sensor->getKeyString());
-                        dataFile.print('_');
-                        dataFile.print(unitsCategoryToString(defaultCategoryForSensor(sensor->getSensorType(), measurementRow)));
-                        dataFile.print('_');
-                        dataFile.print(unitsTypeToSymbol(getMeasurementUnits(sensor->getMeasurement(), measurementRow)));
-                    } else {
-                        HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_OperationFailure));
-                        dataFile.print(SFP(HStr_Undefined));
-                    }
+// Returns if any data column is flagged changed, as frames without any are skipped by file/network sinks
+static bool hasChangedColumns(uint8_t columnCount, const HydroDataColumn *columns)
+{
+    for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+        if (columns[columnIndex].changed) { return true; }
+    }
+    return false;
+}
+
+// Prints data file header row, naming columns by sensor key, units category, and units symbol
+static void printDataHeader(Print &out, uint8_t columnCount, const HydroDataColumn *columns)
+{
+    HydroSensor *lastSensor = nullptr;
+    uint8_t measurementRow = 0;
+
+    out.print(SFP(HStr_Key_Timestamp));
+
+    for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+        out.print(',');
+
+        auto sensor = (HydroSensor *)(Hydruino::_activeInstance->objectByKey(columns[columnIndex].sensorKey).get());
+        if (sensor && sensor == lastSensor) { ++measurementRow; }
+        else { measurementRow = 0; lastSensor = sensor; }
+
+        if (sensor) {
+            out.print(sensor->getKeyString());
+            out.print('_');
+            out.print(unitsCategoryToString(defaultCategoryForSensor(sensor->getSensorType(), measurementRow)));
+            out.print('_');
+            out.print(unitsTypeToSymbol(getMeasurementUnits(sensor->getMeasurement(), measurementRow)));
+        } else {
+            HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_OperationFailure));
+            out.print(SFP(HStr_Undefined));
+        }
+    }
+
+    out.println();
+}
+
+// Prints data file row, leaving unchanged column values empty
+static void printDataRow(Print &out, time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns)
+{
+    out.print(timestamp);
+
+    for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+        out.print(',');
+        if (columns[columnIndex].changed) { out.print(columns[columnIndex].measurement.value); }
+    }
+
+    out.println();
+}
+
+
+HydroSDCardDataSink::HydroSDCardDataSink(const String &dataFilePrefix)
+    : _dataFilePrefix(dataFilePrefix), _dataFilename(getYYMMDDFilename(dataFilePrefix, SFP(HStr_csv)))
+{ ; }
+
+bool HydroSDCardDataSink::publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns)
+{
+    bool retVal = true;
+
+    if (hasChangedColumns(columnCount, columns)) {
+        auto dataFile = Hydruino::_activeInstance->getSDFile(_dataFilename.c_str(), true);
+
+        if (dataFile) {
+            printDataRow(*dataFile, timestamp, columnCount, columns);
+
+            Hydruino::_activeInstance->endSDFile(dataFile);
+        } else {
+            retVal = false;
+        }
+
+        // data store rows stay complete (fixed size records), only unchanged frames are skipped
+        if (!_dataStore.isBegan()) { beginDataStores(); }
+        if (_dataStore.beginRow(timestamp, columnCount)) {
+            for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+                _dataStore.writeValue(columns[columnIndex].measurement.value);
+            }
+            _dataStore.endRow();
+        }
+    }
+
+    #ifdef HYDRO_USE_DATA_ROLLUPS
+        if (!_dataStore.isBegan()) { beginDataStores(); }
+        for (int tierIndex = 0; tierIndex < 3; ++tierIndex) {
+            if (_rollupTiers[tierIndex].beginRow(timestamp, columnCount)) {
+                for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+                    _rollupTiers[tierIndex].addValue(columnIndex, columns[columnIndex].measurement.value);
                 }
+            }
+        }
+    #endif
 
-                dataFile.println();
+    return retVal;
+}
 
-                #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                    dataFile.flush();
-                    dataFile.close();
-                #endif
+void HydroSDCardDataSink::update()
+{ ; }
+
+void HydroSDCardDataSink::notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns)
+{
+    auto sd = Hydruino::_activeInstance->getSDCard();
+
+    if (sd) {
+        Hydruino::_activeInstance->closeSDFile(_dataFilename.c_str());
+        if (sd->exists(_dataFilename.c_str())) {
+            sd->remove(_dataFilename.c_str());
+        }
+        auto dataFile = Hydruino::_activeInstance->getSDFile(_dataFilename.c_str(), true);
+
+        if (dataFile) {
+            printDataHeader(*dataFile, columnCount, columns);
+
+            Hydruino::_activeInstance->endSDFile(dataFile);
+        }
+
+        Hydruino::_activeInstance->endSDCard(sd);
+    }
+}
+
+void HydroSDCardDataSink::notifyDateChanged()
+{
+    _dataFilename = getYYMMDDFilename(_dataFilePrefix, SFP(HStr_csv));
+    cleanupOldestData();
+}
+
+void HydroSDCardDataSink::beginDataStores()
+{
+    _dataStore.begin(_dataFilePrefix);
+#ifdef HYDRO_USE_DATA_ROLLUPS
+    _rollupTiers[0].begin(_dataFilePrefix + 'm', SECS_PER_MIN, HYDRO_SYS_ROLLUP_MINUTE_BUDGETKB * 1024UL);
+    _rollupTiers[1].begin(_dataFilePrefix + 'q', SECS_PER_MIN * 15, HYDRO_SYS_ROLLUP_QUARTER_BUDGETKB * 1024UL);
+    _rollupTiers[2].begin(_dataFilePrefix + 'h', SECS_PER_HOUR, HYDRO_SYS_ROLLUP_HOURLY_BUDGETKB * 1024UL);
+#endif
+}
+
+void HydroSDCardDataSink::cleanupOldestData(bool force)
+{
+    // Daily CSV files and data store segments hold the same rows, so they share one byte budget, with
+    // whichever holds the oldest rows removed first (one extra when forced, e.g. low on space)
+    if (!_dataStore.isBegan()) { beginDataStores(); }
+
+    int slashIndex = _dataFilePrefix.lastIndexOf(HYDRO_FSPATH_SEPARATOR);
+    String directory = slashIndex != -1 ? _dataFilePrefix.substring(0, slashIndex + 1) : String();
+    String namePrefix = _dataFilePrefix.substring(slashIndex + 1);
+    String csvExt = SFP(HStr_csv);
+    DateTime currTime = localNow();
+    DateTime cutoffTime = localTime(unixNow() - (time_t)HYDRO_SYS_FREESPACE_DAYSBACK * SECS_PER_DAY);
+    int32_t todayDate = (currTime.year() % 100) * 10000L + currTime.month() * 100 + currTime.day();
+    int32_t cutoffDate = (cutoffTime.year() % 100) * 10000L + cutoffTime.month() * 100 + cutoffTime.day();
+    bool forced = force;
+
+    auto sd = Hydruino::_activeInstance->getSDCard();
+    while (sd) {
+        uint32_t totalBytes = _dataStore.getSegmentBytes();
+        int32_t oldestDate = -1;
+        String oldestFilename;
+
+        File dir = sd->open(directory.length() ? directory.c_str() : "/");
+        if (dir) {
+            for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+                int32_t date = entry.isDirectory() ? -1 : hydroDayFilenameDate(entry.name(), namePrefix.c_str(), csvExt.c_str());
+                if (date != -1) {
+                    totalBytes += entry.size();
+                    if (date < todayDate && (oldestDate == -1 || date < oldestDate)) { oldestDate = date; oldestFilename = directory + entry.name(); }
+                }
+                entry.close();
             }
+            dir.close();
+        }
 
-            #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                Hydruino::_activeInstance->endSDCard(sd);
-            #endif
+        bool expired = oldestDate != -1 && oldestDate < cutoffDate;
+        if (!expired && !force && totalBytes <= HYDRO_SYS_DATASTORE_BUDGETKB * 1024UL) { break; }
+        force = false;
+
+        time_t storeTime = _dataStore.getSegmentCount() > 1 ? _dataStore.getOldestTime() : 0;
+        time_t csvTime = oldestDate != -1 ? unixTime(DateTime(2000 + oldestDate / 10000, (oldestDate / 100) % 100, oldestDate % 100)) : 0;
+
+        if (oldestDate != -1 && (expired || !storeTime || csvTime <= storeTime)) {
+            Hydruino::_activeInstance->closeSDFile(oldestFilename.c_str());
+            if (!sd->remove(oldestFilename.c_str())) { break; }
+        } else if (!_dataStore.expireOldest()) {
+            break;
         }
     }
+    if (sd) { Hydruino::_activeInstance->endSDCard(sd); }
+
+    #ifdef HYDRO_USE_DATA_ROLLUPS
+        if (forced) {
+            for (int tierIndex = 0; tierIndex < 3; ++tierIndex) { _rollupTiers[tierIndex].getDataStore().expireOldest(); }
+        }
+    #else
+        (void)forced;
+    #endif
+}
 
 #ifdef HYDRO_USE_WIFI_STORAGE
 
-    if (isPublishingToWiFiStorage()) {
-        #if HYDRO_SYS_LEAVE_FILES_OPEN
-            if (_dataFileWS) { _dataFileWS->close(); delete _dataFileWS; _dataFileWS = nullptr; }
+HydroWiFiStorageDataSink::HydroWiFiStorageDataSink(const String &dataFilePrefix)
+    : _dataFilePrefix(dataFilePrefix), _dataFilename(getYYMMDDFilename(dataFilePrefix, SFP(HStr_csv)))
+#if HYDRO_SYS_LEAVE_FILES_OPEN
+      , _dataFileWS(nullptr)
+#endif
+{ ; }
+
+HydroWiFiStorageDataSink::~HydroWiFiStorageDataSink()
+{
+    #if HYDRO_SYS_LEAVE_FILES_OPEN
+        if (_dataFileWS) { _dataFileWS->close(); delete _dataFileWS; _dataFileWS = nullptr; }
+    #endif
+}
+
+bool HydroWiFiStorageDataSink::publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns)
+{
+    if (!hasChangedColumns(columnCount, columns)) { return true; }
+
+    #if HYDRO_SYS_LEAVE_FILES_OPEN
+        auto &dataFile = _dataFileWS ? *_dataFileWS : *(_dataFileWS = new WiFiStorageFile(WiFiStorage.open(_dataFilename.c_str())));
+    #else
+        auto dataFile = WiFiStorage.open(_dataFilename.c_str());
+    #endif
+
+    if (dataFile) {
+        auto dataFileStream = HydroWiFiStorageFileStream(dataFile, dataFile.size());
+        printDataRow(dataFileStream, timestamp, columnCount, columns);
+
+        #if !HYDRO_SYS_LEAVE_FILES_OPEN
+            dataFile.close();
         #endif
-        if (WiFiStorage.exists(_dataFilename.c_str())) {
-            WiFiStorage.remove(_dataFilename.c_str());
-        }
-        #if HYDRO_SYS_LEAVE_FILES_OPEN
-            auto &dataFile = _dataFileWS ? *_dataFileWS : *(_dataFileWS = new WiFiStorageFile(WiFiStorage.open(_dataFilename.c_str())));
-        #else
-            auto dataFile = WiFiStorage.open(_dataFilename.c_str());
+        return true;
+    }
+
+    return false;
+}
+
+void HydroWiFiStorageDataSink::update()
+{ ; }
+
+void HydroWiFiStorageDataSink::notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns)
+{
+    #if HYDRO_SYS_LEAVE_FILES_OPEN
+        if (_dataFileWS) { _dataFileWS->close(); delete _dataFileWS; _dataFileWS = nullptr; }
+    #endif
+    if (WiFiStorage.exists(_dataFilename.c_str())) {
+        WiFiStorage.remove(_dataFilename.c_str());
+    }
+    #if HYDRO_SYS_LEAVE_FILES_OPEN
+        auto &dataFile = _dataFileWS ? *_dataFileWS : *(_dataFileWS = new WiFiStorageFile(WiFiStorage.open(_dataFilename.c_str())));
+    #else
+        auto dataFile = WiFiStorage.open(_dataFilename.c_str());
+    #endif
+
+    if (dataFile) {
+        auto dataFileStream = HydroWiFiStorageFileStream(dataFile);
+        printDataHeader(dataFileStream, columnCount, columns);
+
+        #if !HYDRO_SYS_LEAVE_FILES_OPEN
+            dataFile.close();
         #endif
+    }
+}
 
-        if (dataFile) {
-            auto dataFileStream = HydroWiFiStorageFileStream(dataFile);
-            HydroSensor *lastSensor = nullptr;
-            uint8_t measurementRow = 0;
-
-            dataFileStream.print(SFP(HStr_Key_Timestamp));
-
-            for (int columnIndex = 0; columnIndex < _columnSize; ++columnIndex) {
-                dataFileStream.print(',');
-
-                auto sensor = (HydroSensor *)(Hydruino::_activeInstance->_objects[_dataColumns[columnIndex].sensorKey].get());
-                if (sensor && sensor == lastSensor) { ++measurementRow; }
-                else { measurementRow = 0; lastSensor = sensor; }
-
-                if (sensor) {
-                    dataFileStream.print(sensor->getKeyString());
-                    dataFileStream.print('_');
-                    dataFileStream.print(unitsCategoryToString(defaultCategoryForSensor(sensor->getSensorType(), measurementRow)));
-                    dataFileStream.print('_');
-                    dataFileStream.print(unitsTypeToSymbol(getMeasurementUnits(sensor->getMeasurement(), measurementRow)));
-                } else {
-                    HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_OperationFailure));
-                    dataFileStream.print(SFP(HStr_Undefined));
+void HydroWiFiStorageDataSink::notifyDateChanged()
+{
+    #if HYDRO_SYS_LEAVE_FILES_OPEN
+        if (_dataFileWS) { _dataFileWS->close(); delete _dataFileWS; _dataFileWS = nullptr; }
+    #endif
+    _dataFilename = getYYMMDDFilename(_dataFilePrefix, SFP(HStr_csv));
+}
+
+#endif
+#ifdef HYDRO_USE_MQTT
+
+static uint32_t mqttNow()
+{
+    return unixNow();
+}
+
+HydroMQTTDataSink::HydroMQTTDataSink(MQTTClient &client, const String &outboxPrefix, bool batchFrames, int qos)
+    : _client(&client), _topics(nullptr), _columnCount(0), _backfillCursor{0,0}, _lastConnect(0), _qos(constrain(qos, 0, 2)), _batching(batchFrames)
+{
+    _client->setClockSource(&mqttNow);
+    if (!_client->connected()) { connect(); }
+    _outbox.begin(outboxPrefix, HYDRO_SYS_MQTT_OUTBOXKB * 1024UL);
+}
+
+HydroMQTTDataSink::~HydroMQTTDataSink()
+{
+    if (_client->connected()) { _client->disconnect(); }
+    if (_topics) { delete [] _topics; _topics = nullptr; }
+}
+
+void HydroMQTTDataSink::connect()
+{
+    String unPw = String(F("public"));
+    _lastConnect = millis();
+    _client->connect(Hydruino::_activeInstance->getSystemName().c_str(),
+                     unPw.c_str(), unPw.c_str());
+}
+
+bool HydroMQTTDataSink::publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns)
+{
+    if (!hasChangedColumns(columnCount, columns)) { return true; }
+    bool connected = _client->connected();
+
+    if (connected && _batching) {
+        HydroFramePayload<HYDRO_SYS_MQTT_FRAMESIZE> payload;
+        payload.begin((uint32_t)timestamp);
+        for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+            if (columns[columnIndex].changed) {
+                payload.add(columnIndex, columns[columnIndex].measurement.value); // skipping units/rounding/etc to allow MQTT broker full value data
+            }
+        }
+        if (payload.end()) {
+            if (_client->publish(Hydruino::_activeInstance->getSystemNameChars(), payload.c_str(), payload.length(), false, _qos)) { return true; }
+            connected = false; // whole frame kept
+        }
+    }
+
+    // changed values not sent are kept in outbox for replay upon reconnect, with the rest skipped
+    bool outboxRow = false, outboxBegun = false;
+    int outboxColumn = 0;
+    for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+        if (columns[columnIndex].changed && !(connected && publishValue(columnIndex, columns[columnIndex].measurement.value))) {
+            if (!outboxBegun) { outboxBegun = true; outboxRow = _outbox.beginRow(timestamp, columnCount); }
+            if (outboxRow) {
+                for (; outboxColumn < columnIndex; ++outboxColumn) { _outbox.writeValue(hydroSkippedValue()); }
+                _outbox.writeValue(columns[columnIndex].measurement.value);
+                ++outboxColumn;
+            }
+        }
+    }
+    if (outboxRow) {
+        for (; outboxColumn < columnCount; ++outboxColumn) { _outbox.writeValue(hydroSkippedValue()); }
+        _outbox.endRow();
+    }
+
+    return !outboxBegun || outboxRow;
+}
+
+bool HydroMQTTDataSink::publishValue(uint16_t columnIndex, float value)
+{
+    if (!_topics || columnIndex >= _columnCount) { return false; }
+    if (!_topics[columnIndex].length()) { return true; } // no sensor to publish under
+
+    HydroFixedString<24> payload;
+    payload.appendFloat(value, 6); // skipping units/rounding/etc to allow MQTT broker full value data
+    return _client->publish(_topics[columnIndex].c_str(), payload.c_str(), payload.length(), false, _qos);
+}
+
+bool HydroMQTTDataSink::replayFrame(time_t timestamp, const float *values, uint16_t valueCount)
+{
+    if (_batching) {
+        HydroFramePayload<HYDRO_SYS_MQTT_FRAMESIZE> payload;
+        payload.begin((uint32_t)timestamp);
+        for (uint16_t valueIndex = 0; valueIndex < valueCount; ++valueIndex) {
+            if (!hydroIsSkippedValue(values[valueIndex])) { payload.add(valueIndex, values[valueIndex]); }
+        }
+        if (payload.end()) {
+            return _client->publish(Hydruino::_activeInstance->getSystemNameChars(), payload.c_str(), payload.length(), false, _qos);
+        }
+    }
+
+    if (valueCount != _columnCount) { return true; } // retabulated since, columns no longer map to topics
+    bool retVal = _topics;
+    for (uint16_t valueIndex = 0; retVal && valueIndex < valueCount; ++valueIndex) {
+        if (!hydroIsSkippedValue(values[valueIndex])) { retVal = publishValue(valueIndex, values[valueIndex]); }
+    }
+    return retVal;
+}
+
+void HydroMQTTDataSink::update()
+{
+    if (!_client->connected()) {
+        if (hydroHasElapsed(millis(), _lastConnect, HYDRO_SYS_MQTT_RECONNECTMILLIS)) { connect(); }
+        return;
+    }
+
+    _client->loop();
+
+    // replays outbox oldest first, in configured publishing mode (a partly sent frame is resent whole)
+    if (_outbox.getSegmentCount()) {
+        float values[HYDRO_SYS_MQTT_FRAMESIZE / 8];         // wider frames are cut short, and then only replayed batched
+        time_t frameTime;
+        uint16_t valueCount;
+
+        for (int frame = 0; frame < HYDRO_SYS_MQTT_BACKFILLRATE; ++frame) {
+            HydroDataCursor cursor = _backfillCursor;
+            bool outboxEnd = false;
+
+            if (!_outbox.readRow(cursor, &frameTime, values, HYDRO_SYS_MQTT_FRAMESIZE / 8, &valueCount, &outboxEnd)) {
+                if (outboxEnd) { // fully replayed
+                    _outbox.clear();
+                    _backfillCursor = {0,0};
                 }
+                break; // else retried next update
             }
+            if (!replayFrame(frameTime, values, valueCount)) {
+                break; // retried next update
+            }
+            _backfillCursor = cursor;
+        }
+    }
+}
+
+void HydroMQTTDataSink::notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns)
+{
+    if (_topics) { delete [] _topics; _topics = nullptr; }
+    _columnCount = columnCount;
+
+    if (_columnCount) {
+        _topics = new HydroFixedString<HYDRO_NAME_MAXSIZE * 2 + 2>[_columnCount];
+        HYDRO_SOFT_ASSERT(_topics, SFP(HStr_Err_AllocationFailure));
 
-            dataFileStream.println();
+        for (int columnIndex = 0; _topics && columnIndex < _columnCount; ++columnIndex) {
+            auto sensor = (HydroSensor *)(Hydruino::_activeInstance->objectByKey(columns[columnIndex].sensorKey).get());
+            if (sensor) {
+                _topics[columnIndex].append(Hydruino::_activeInstance->getSystemNameChars());
+                _topics[columnIndex].append('/');
+                _topics[columnIndex].append(sensor->getKeyChars());
+            }
         }
     }
+}
 
 #endif
+
+#ifdef HYDRO_USE_NET
+
+HydroLineProtocolSink::HydroLineProtocolSink(UDP &udp, IPAddress address, uint16_t port, String measurement)
+    : _udp(&udp), _client(nullptr), _address(address), _port(port), _measurement(measurement),
+      _columnFields(nullptr), _columnCount(0), _lastFlush(0), _batcher(*this)
+{ ; }
+
+HydroLineProtocolSink::HydroLineProtocolSink(Client &client, IPAddress address, uint16_t port, String measurement)
+    : _udp(nullptr), _client(&client), _address(address), _port(port), _measurement(measurement),
+      _columnFields(nullptr), _columnCount(0), _lastFlush(0), _batcher(*this)
+{ ; }
+
+HydroLineProtocolSink::~HydroLineProtocolSink()
+{
+    if (_columnFields) { delete [] _columnFields; _columnFields = nullptr; }
 }
 
-void HydroPublisher::cleanupOldestData(bool force)
+bool HydroLineProtocolSink::publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns)
 {
-    // TODO: Old data cleanup. #17 in Hydruino.
+    bool retVal = true;
+
+    for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex) {
+        if (!columns[columnIndex].changed) { continue; }
+        auto sensor = (HydroSensor *)(Hydruino::_activeInstance->objectByKey(columns[columnIndex].sensorKey).get());
+
+        if (sensor) {
+            // units and field resolved into fixed buffers, rather than Strings per column per frame
+            HydroFixedString<HYDRO_NAME_MAXSIZE> units, field;
+            appendUnitsTypeSymbol(units, columns[columnIndex].measurement.units);
+            appendStringFromPGM(field, columnIndex < _columnCount ? _columnFields[columnIndex] : HStr_Undefined);
+            const char *tags[] = { "system", Hydruino::_activeInstance->getSystemNameChars(),
+                                   "sensor", sensor->getKeyChars(),
+                                   "units", units.c_str() };
+            retVal = _batcher.addLine(_measurement.c_str(), tags, 3, field.c_str(),
+                                      columns[columnIndex].measurement.value, (uint32_t)timestamp) && retVal;
+        }
+    }
+
+    return retVal;
 }
 
+void HydroLineProtocolSink::notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns)
+{
+    if (_columnFields) { delete [] _columnFields; _columnFields = nullptr; }
+    _columnCount = 0;
+
+    if (columnCount) {
+        _columnFields = new Hydro_String[columnCount];
+        HYDRO_SOFT_ASSERT(_columnFields, SFP(HStr_Err_AllocationFailure));
+        if (!_columnFields) { return; }
+        _columnCount = columnCount;
+    }
+
+    HydroSensor *lastSensor = nullptr;
+    uint8_t measurementRow = 0;
+
+    for (int columnIndex = 0; columnIndex < _columnCount; ++columnIndex) {
+        auto sensor = (HydroSensor *)(Hydruino::_activeInstance->objectByKey(columns[columnIndex].sensorKey).get());
+        if (sensor && sensor == lastSensor) { ++measurementRow; }
+        else { measurementRow = 0; lastSensor = sensor; }
+
+        _columnFields[columnIndex] = sensor ? unitsCategoryToStringId(defaultCategoryForSensor(sensor->getSensorType(), measurementRow)) : HStr_Undefined;
+    }
+}
+
+void HydroLineProtocolSink::update()
+{
+    if (_batcher.getPendingLength() && hydroHasElapsed(millis(), _lastFlush, HYDRO_PUBLISH_LINEPROTO_FLUSHMILLIS)) {
+        _lastFlush = millis(); // failed sends retried next interval
+        _batcher.flush();
+    }
+}
+
+size_t HydroLineProtocolSink::send(const char *data, size_t length)
+{
+    if (_udp) {
+        return _udp->beginPacket(_address, _port) && _udp->write((const uint8_t *)data, length) == length && _udp->endPacket() ? length : 0;
+    } else if (_client) {
+        if (!_client->connected()) {
+            if (!_client->connect(_address, _port)) { return 0; }
+            // rest of a partly sent packet would arrive as a broken line on the new connection, so resent whole next flush
+            if (_batcher.getSentLength()) { _batcher.restartPacket(); return 0; }
+        }
+        return _client->write((const uint8_t *)data, length);
+    }
+    return 0;
+}
+
+#endif
+
 
 HydroPublisherSubData::HydroPublisherSubData()
     : HydroSubData(), dataFilePrefix{0}, pubToSDCard(false), pubToWiFiStorage(false)
 {
     type = 0; // no type differentiation
+    clearDeadbands();
 }
 
 void HydroPublisherSubData::toJSONObject(JsonObject &objectOut) const
@@ -504,6 +898,15 @@ void HydroPublisherSubData::toJSONObject(JsonObject &objectOut) const
     if (dataFilePrefix[0]) { objectOut[SFP(HStr_Key_DataFilePrefix)] = charsToString(dataFilePrefix, 16); }
     if (pubToSDCard != false) { objectOut[SFP(HStr_Key_PublishToSDCard)] = pubToSDCard; }
     if (pubToWiFiStorage != false) { objectOut[SFP(HStr_Key_PublishToWiFiStorage)] = pubToWiFiStorage; }
+    if (deadbands[0].sensorName[0]) {
+        JsonArray deadbandsArray = objectOut.createNestedArray(SFP(HStr_Key_Deadbands));
+        for (int slotIndex = 0; slotIndex < HYDRO_PUBLISH_DEADBAND_SLOTS && deadbands[slotIndex].sensorName[0]; ++slotIndex) {
+            JsonObject deadbandObj = deadbandsArray.createNestedObject();
+            deadbandObj[SFP(HStr_Key_SensorName)] = charsToString(deadbands[slotIndex].sensorName, HYDRO_NAME_MAXSIZE);
+            deadbandObj[SFP(HStr_Key_Deadband)] = deadbands[slotIndex].deadband;
+            if (deadbands[slotIndex].heartbeat) { deadbandObj[SFP(HStr_Key_Heartbeat)] = deadbands[slotIndex].heartbeat; }
+        }
+    }
 }
 
 void HydroPublisherSubData::fromJSONObject(JsonObjectConst &objectIn)
@@ -514,4 +917,45 @@ void HydroPublisherSubData::fromJSONObject(JsonObjectConst &objectIn)
     if (dataFilePrefixStr && dataFilePrefixStr[0]) { strncpy(dataFilePrefix, dataFilePrefixStr, 16); }
     pubToSDCard = objectIn[SFP(HStr_Key_PublishToSDCard)] | pubToSDCard;
     pubToWiFiStorage = objectIn[SFP(HStr_Key_PublishToWiFiStorage)] | pubToWiFiStorage;
+    {   JsonArrayConst deadbandsArray = objectIn[SFP(HStr_Key_Deadbands)];
+        for (JsonObjectConst deadbandObj : deadbandsArray) {
+            const char *sensorNameStr = deadbandObj[SFP(HStr_Key_SensorName)];
+            if (sensorNameStr && sensorNameStr[0]) {
+                setDeadband(sensorNameStr, deadbandObj[SFP(HStr_Key_Deadband)] | 0.0f, deadbandObj[SFP(HStr_Key_Heartbeat)] | 0);
+            }
+        }
+    }
+}
+
+const HydroPublisherDeadband *HydroPublisherSubData::getDeadband(hkey_t sensorKey) const
+{
+    for (int slotIndex = 0; slotIndex < HYDRO_PUBLISH_DEADBAND_SLOTS && deadbands[slotIndex].sensorName[0]; ++slotIndex) {
+        if (stringHash(charsToString(deadbands[slotIndex].sensorName, HYDRO_NAME_MAXSIZE)) == sensorKey) {
+            return &deadbands[slotIndex];
+        }
+    }
+    return nullptr;
+}
+
+bool HydroPublisherSubData::setDeadband(const char *sensorName, float deadband, uint16_t heartbeat)
+{
+    if (!sensorName || !sensorName[0]) { return false; }
+
+    // used slots are kept packed at front
+    int slotIndex = 0;
+    while (slotIndex < HYDRO_PUBLISH_DEADBAND_SLOTS && deadbands[slotIndex].sensorName[0] &&
+           strncmp(deadbands[slotIndex].sensorName, sensorName, HYDRO_NAME_MAXSIZE)) { ++slotIndex; }
+
+    if (deadband < 0.0f) {
+        if (slotIndex >= HYDRO_PUBLISH_DEADBAND_SLOTS || !deadbands[slotIndex].sensorName[0]) { return false; }
+        for (; slotIndex + 1 < HYDRO_PUBLISH_DEADBAND_SLOTS; ++slotIndex) { deadbands[slotIndex] = deadbands[slotIndex + 1]; }
+        memset(&deadbands[HYDRO_PUBLISH_DEADBAND_SLOTS - 1], 0, sizeof(HydroPublisherDeadband));
+        return true;
+    }
+    if (slotIndex >= HYDRO_PUBLISH_DEADBAND_SLOTS) { return false; }
+
+    strncpy(deadbands[slotIndex].sensorName, sensorName, HYDRO_NAME_MAXSIZE);
+    deadbands[slotIndex].deadband = deadband;
+    deadbands[slotIndex].heartbeat = heartbeat;
+    return true;
 }
@@ -9,6 +9,11 @@
 
 class HydroPublisher;
 struct HydroPublisherSubData;
+class HydroSDCardDataSink;
+class HydroWiFiStorageDataSink;
+class HydroMQTTDataSink;
+class HydroLineProtocolSink;
+struct HydroPublisherDeadband;
 struct HydroDataColumn;
 
 #include "Hydruino.h"
@@ -24,7 +29,16 @@ struct HydroDataColumn;
 // submitted to configured publishing services.
 // Publishing to SD card .csv data files (via SPI card reader) is supported as is logging to
 // WiFiStorage .csv data files (via OS/OTA filesystem / WiFiNINA_Generic only). MQTT is also
-// supported but requires additional setup.
+// supported but requires additional setup. Data published to SD card is also appended to a
+// time-indexed data store for historical range queries, and, if HYDRO_ENABLE_DATA_ROLLUPS is
+// defined, downsampled into 1-minute, 15-minute, and hourly rollup tiers for long-range trends.
+// Sensors may be set to change-only publishing (see setSensorDeadband), in which case their
+// unchanged values are left empty (.csv), left out (batched MQTT, where NaN values are null),
+// or unsent (per column MQTT), and frames without any changed values are skipped entirely
+// (outside of rollup tiers).
+// Each publishing service is a sink (see HydroPublisherSinkInterface) that data frames are
+// fanned out to, with the SD card, WiFiStorage, and MQTT sinks built-in and owned. Additional
+// sinks, such as the line protocol sink for time-series collectors, can be added as well.
 class HydroPublisher {
 public:
     HydroPublisher();
@@ -32,16 +46,19 @@ public:
 
     void update();
  
-    bool beginPublishingToSDCard(String dataFilePrefix);
+    bool beginPublishingToSDCard(const String &dataFilePrefix);
     inline bool isPublishingToSDCard() const;
 
 #ifdef HYDRO_USE_WIFI_STORAGE
-    bool beginPublishingToWiFiStorage(String dataFilePrefix);
+    bool beginPublishingToWiFiStorage(const String &dataFilePrefix);
     inline bool isPublishingToWiFiStorage() const;
 #endif
 
 #ifdef HYDRO_USE_MQTT
-    bool beginPublishingToMQTTClient(MQTTClient &client);
+    // Begins publishing to MQTT client, either per column (to system name/sensor key topics) or
+    // batched as one {"t":timestamp,"column":value,...} frame (to system name topic), at given QoS level.
+    // Values that fail to send are kept in an SD card outbox and replayed, in the same mode, on reconnect.
+    bool beginPublishingToMQTTClient(MQTTClient &client, bool batchFrames = false, int qos = 0);
     inline bool isPublishingToMQTTClient() const;
 #endif
 
@@ -53,25 +70,42 @@ public:
     inline bool isPublishingEnabled() const;
     hposi_t getColumnIndexStart(hkey_t sensorKey);
 
+    // Sets change-only publishing of sensor's data column(s): values publish only once moved beyond deadband (0 for
+    // any change), or once heartbeat seconds pass (0 for never). A negative deadband restores publishing every frame.
+    // Settings are kept for up to HYDRO_PUBLISH_DEADBAND_SLOTS sensors, returning false once full.
+    bool setSensorDeadband(const String &sensorKeyName, float deadband, uint16_t heartbeat = 0);
+
+    // Adds additional sink (strong, not owned) that published data frames are fanned out to, returning success.
+    // Sinks share HYDRO_PUBLISH_SINK_SLOTS slots with the built-in sinks of any publishing services began.
+    bool addSink(HydroPublisherSinkInterface *sink);
+    // Removes previously added sink, returning success.
+    bool removeSink(HydroPublisherSinkInterface *sink);
+
+    // Publish signal, fired with data columns (flagged changed, under change-only publishing) on frames that publish
     Signal<Pair<uint8_t, const HydroDataColumn *>, HYDRO_PUBLISH_SIGNAL_SLOTS> &getPublishSignal();
 
+    // Built-in SD card sink, with its data store and rollup tiers (once publishing to SD card), else nullptr
+    inline HydroSDCardDataSink *getSDCardSink() const { return _sdCardSink; }
+#ifdef HYDRO_USE_MQTT
+    // Built-in MQTT sink (once publishing to MQTT client), else nullptr
+    inline HydroMQTTDataSink *getMQTTSink() const { return _mqttSink; }
+#endif
+
     void notifyDateChanged();
 
 protected:
-#if HYDRO_SYS_LEAVE_FILES_OPEN
-    File *_dataFileSD;                                      // SD card log file instance (owned)
-#ifdef HYDRO_USE_WIFI_STORAGE
-    WiFiStorageFile *_dataFileWS;                           // WiFiStorageFile log file instance (owned)
-#endif
-#endif
-#ifdef HYDRO_USE_MQTT
-    MQTTClient *_mqttClient;                                // MQTT client object (strong)
-#endif
-    String _dataFilename;                                   // Resolved data file name (based on day)
     hframe_t _pollingFrame;                                 // Polling frame that publishing is caught up to
     bool _needsTabulation;                                  // Needs tabulation tracking flag
     uint8_t _columnSize;                                    // Number of data columns
     HydroDataColumn *_dataColumns;                          // Data columns array (owned)
+    HydroSDCardDataSink *_sdCardSink;                       // Built-in SD card sink (owned), else nullptr
+#ifdef HYDRO_USE_WIFI_STORAGE
+    HydroWiFiStorageDataSink *_wifiStorageSink;             // Built-in WiFiStorage sink (owned), else nullptr
+#endif
+#ifdef HYDRO_USE_MQTT
+    HydroMQTTDataSink *_mqttSink;                           // Built-in MQTT sink (owned), else nullptr
+#endif
+    HydroPublisherSinkInterface *_sinks[HYDRO_PUBLISH_SINK_SLOTS]; // Sinks published to (strong)
 
     Signal<Pair<uint8_t, const HydroDataColumn *>, HYDRO_PUBLISH_SIGNAL_SLOTS> _publishSignal; // Data publishing signal
 
@@ -84,12 +118,13 @@ protected:
     void publish(time_t timestamp);
 
     void performTabulation();
+    void beginSinks();
+    bool beginSink(HydroPublisherSinkInterface *sink);
 
 public: // consider protected
     inline HydroPublisherSubData *publisherData() const;
     inline bool hasPublisherData() const;
 
-    void resetDataFile();
     void cleanupOldestData(bool force = false);
 };
 
@@ -98,6 +133,152 @@ public: // consider protected
 struct HydroDataColumn {
     hkey_t sensorKey;                                       // Key to sensor object
     HydroSingleMeasurement measurement;                     // Storage polling frame measurement
+    float deadband;                                         // Change-only publishing deadband (else -1 for every frame)
+    uint16_t heartbeat;                                     // Change-only publishing heartbeat, in seconds (else 0)
+    bool changed;                                           // If measurement is published this frame
+    float publishedValue;                                   // Last published value
+    time_t publishedTime;                                   // Last published time, else 0
+};
+
+
+// SD Card Data Sink
+// Built-in publisher sink writing data frames to daily .csv data files on SD card, which are
+// (re)started with a header row upon tabulation. Rows are also appended to a time-indexed data
+// store (sharing one byte budget with the .csv files) and, if HYDRO_ENABLE_DATA_ROLLUPS is
+// defined, downsampled into rollup tiers, both kept alongside under the data file prefix.
+class HydroSDCardDataSink : public HydroPublisherSinkInterface {
+public:
+    HydroSDCardDataSink(const String &dataFilePrefix);
+
+    virtual bool publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns) override;
+    virtual void update() override;
+    virtual void notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns) override;
+    virtual void notifyDateChanged() override;
+
+    // Removes oldest data files/segments while over data budget, or past days back (one extra when forced).
+    void cleanupOldestData(bool force = false);
+
+    // Time-indexed store of published data rows, for historical range queries
+    inline HydroDataStore &getDataStore() { return _dataStore; }
+#ifdef HYDRO_USE_DATA_ROLLUPS
+    // Downsampled rollup tier of published data rows (0: 1-minute, 1: 15-minute, 2: hourly), for long-range trends
+    inline HydroRollupTier &getRollupTier(uint8_t tierIndex) { return _rollupTiers[tierIndex < 3 ? tierIndex : 2]; }
+#endif
+
+protected:
+    String _dataFilePrefix;                                 // Data file name prefix / folder
+    String _dataFilename;                                   // Resolved data file name (based on day)
+    HydroDataStore _dataStore;                              // Time-indexed data store
+#ifdef HYDRO_USE_DATA_ROLLUPS
+    HydroRollupTier _rollupTiers[3];                        // Downsampled rollup tiers
+#endif
+
+    void beginDataStores();
+};
+
+#ifdef HYDRO_USE_WIFI_STORAGE
+
+// WiFiStorage Data Sink
+// Built-in publisher sink writing data frames to daily .csv data files on WiFiStorage, which
+// are (re)started with a header row upon tabulation.
+class HydroWiFiStorageDataSink : public HydroPublisherSinkInterface {
+public:
+    HydroWiFiStorageDataSink(const String &dataFilePrefix);
+    virtual ~HydroWiFiStorageDataSink();
+
+    virtual bool publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns) override;
+    virtual void update() override;
+    virtual void notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns) override;
+    virtual void notifyDateChanged() override;
+
+protected:
+    String _dataFilePrefix;                                 // Data file name prefix / folder
+    String _dataFilename;                                   // Resolved data file name (based on day)
+#if HYDRO_SYS_LEAVE_FILES_OPEN
+    WiFiStorageFile *_dataFileWS;                           // WiFiStorageFile data file instance (owned)
+#endif
+};
+
+#endif
+#ifdef HYDRO_USE_MQTT
+
+// MQTT Data Sink
+// Built-in publisher sink publishing data frames to an MQTT broker, either per column (to system
+// name/sensor key topics) or batched (to system name topic). Values that fail to send are kept
+// in an SD card outbox and replayed, oldest first, once reconnected.
+class HydroMQTTDataSink : public HydroPublisherSinkInterface {
+public:
+    HydroMQTTDataSink(MQTTClient &client, const String &outboxPrefix, bool batchFrames, int qos);
+    virtual ~HydroMQTTDataSink();
+
+    virtual bool publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns) override;
+    virtual void update() override;
+    virtual void notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns) override;
+
+    inline MQTTClient &getClient() { return *_client; }
+
+protected:
+    MQTTClient *_client;                                    // MQTT client object (strong)
+    HydroFixedString<HYDRO_NAME_MAXSIZE * 2 + 2> *_topics;  // Cached per column topics (owned)
+    uint8_t _columnCount;                                   // Number of data columns topics are cached for
+    HydroDataStore _outbox;                                 // Outbox of unsent data frames (SD card)
+    HydroDataCursor _backfillCursor;                        // Outbox cursor of next frame to replay
+    uint32_t _lastConnect;                                  // Last broker connect attempt time (millis)
+    int8_t _qos;                                            // MQTT publish QoS level
+    bool _batching;                                         // If frames are published batched
+
+    void connect();
+    bool publishValue(uint16_t columnIndex, float value);
+    bool replayFrame(time_t timestamp, const float *values, uint16_t valueCount);
+};
+
+#endif
+#ifdef HYDRO_USE_NET
+
+// Line Protocol Sink
+// Publisher sink exporting data frames as InfluxDB-style line protocol (seconds timestamps,
+// i.e. precision=s) to a time-series collector (e.g. Telegraf socket_listener) over UDP or TCP,
+// skipping the MQTT broker hop. Each changed column becomes a line tagged with system name,
+// sensor key, and units, with its units category as field. Lines are batched into packets
+// sent once full or every HYDRO_PUBLISH_LINEPROTO_FLUSHMILLIS. While sends fail, lines that
+// no longer fit are dropped (see getDropCount) rather than stalling publishing.
+class HydroLineProtocolSink : public HydroPublisherSinkInterface {
+public:
+    // UDP sink (udp expected to be began) sending to collector at address:port.
+    HydroLineProtocolSink(UDP &udp, IPAddress address, uint16_t port, String measurement = String(F("hydruino")));
+    // TCP sink (client connected on demand) sending to collector at address:port.
+    HydroLineProtocolSink(Client &client, IPAddress address, uint16_t port, String measurement = String(F("hydruino")));
+    ~HydroLineProtocolSink();
+
+    virtual bool publishFrame(time_t timestamp, uint8_t columnCount, const HydroDataColumn *columns) override;
+    virtual void update() override;
+    virtual void notifyTabulated(uint8_t columnCount, const HydroDataColumn *columns) override;
+
+    // Sends packet data to collector, returning number of bytes sent (TCP may send partially).
+    size_t send(const char *data, size_t length);
+
+    inline uint32_t getDropCount() const { return _batcher.getDropCount(); }
+
+protected:
+    UDP *_udp;                                              // UDP transport (strong), else nullptr
+    Client *_client;                                        // TCP transport (strong), else nullptr
+    IPAddress _address;                                     // Collector address
+    uint16_t _port;                                         // Collector port
+    String _measurement;                                    // Line measurement name
+    Hydro_String *_columnFields;                            // Per column field (units category) string ids (owned), from tabulation
+    uint8_t _columnCount;                                   // Number of tabulated columns
+    uint32_t _lastFlush;                                    // Last flush time (millis)
+    HydroLineProtocolBatcher<HydroLineProtocolSink, HYDRO_PUBLISH_LINEPROTO_PACKETSIZE> _batcher; // Packet batcher
+};
+
+#endif
+
+// Publisher Deadband
+// Change-only publishing settings for the data column(s) of a sensor. A part of publisher subdata.
+struct HydroPublisherDeadband {
+    char sensorName[HYDRO_NAME_MAXSIZE];                    // Sensor key name, else empty for unused
+    float deadband;                                         // Change in value needed to publish again (0 for any change)
+    uint16_t heartbeat;                                     // Seconds after which an unchanged value publishes again (0 for never)
 };
 
 
@@ -107,10 +288,17 @@ struct HydroPublisherSubData : public HydroSubData {
     char dataFilePrefix[HYDRO_PREFIX_MAXSIZE];              // Base data file name prefix / folder (default: "data/hy")
     bool pubToSDCard;                                       // If publishing sensor data to SD card is enabled (default: false)
     bool pubToWiFiStorage;                                  // If publishing sensor data to WiFiStorage is enabled (default: false)
+    HydroPublisherDeadband deadbands[HYDRO_PUBLISH_DEADBAND_SLOTS]; // Per sensor change-only publishing settings (default: none, every frame)
 
     HydroPublisherSubData();
     void toJSONObject(JsonObject &objectOut) const;
     void fromJSONObject(JsonObjectConst &objectIn);
+
+    // Returns deadband settings slot of sensor key name, else nullptr.
+    const HydroPublisherDeadband *getDeadband(hkey_t sensorKey) const;
+    // Sets deadband settings slot of sensor key name, else clears it with negative deadband, returning success.
+    bool setDeadband(const char *sensorName, float deadband, uint16_t heartbeat);
+    inline void clearDeadbands() { memset(deadbands, 0, sizeof(deadbands)); }
 };
 
 #endif // /ifndef HydroPublisher_H
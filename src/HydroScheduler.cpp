@@ -6,7 +6,8 @@
 #include "Hydruino.h"
 
 HydroScheduler::HydroScheduler()
-    : _needsScheduling(false), _inDaytimeMode(false), _lastDay{0}
+    : _needsScheduling(false), _inDaytimeMode(false), _lastDay{0}, _timeKeepStart(0), _timeKeepUntil(0), _nextDayStart(0),
+      _maxActiveFeedings(HYDRO_SCH_FEEDINGS_ACTIVEMAX), _timelineIndex(0)
 { ; }
 
 HydroScheduler::~HydroScheduler()
@@ -30,7 +31,10 @@ void HydroScheduler::update()
             Serial.println(F("Scheduler::update")); flushYield();
         #endif
 
-        {   time_t time = unixNow();
+        time_t time = unixNow();
+
+        // Date and daytime checks only need done once the next time boundary passes (or the clock jumps back)
+        if (!_timeKeepUntil || time >= _timeKeepUntil || time < _timeKeepStart) {
             DateTime currTime = localTime(time);
             bool daytimeMode = _dailyTwilight.isDaytime(time);
 
@@ -49,15 +53,42 @@ void HydroScheduler::update()
                 }
                 broadcastDateChange();
             }
+
+            if (time < _timeKeepStart) { // clock jumped back, wake any sleeping processes
+                for (auto feedingIter = _feedings.begin(); feedingIter != _feedings.end(); ++feedingIter) { feedingIter->second->wakeTime = 0; }
+                for (auto lightingIter = _lightings.begin(); lightingIter != _lightings.end(); ++lightingIter) { lightingIter->second->wakeTime = 0; }
+                _timelineIndex = 0;
+            }
+
+            updateTimeKeeping(time);
         }
 
         if (needsScheduling()) { performScheduling(); }
 
+        // step through planned timeline, waking processes as their planned transitions come due
+        while (_timelineIndex < _timeline.size() && (time_t)_timeline[_timelineIndex].time <= time) {
+            auto &entry = _timeline[_timelineIndex++];
+            if (entry.processType == HydroPlanProcess_Feeding) {
+                auto feedingIter = _feedings.find(entry.ownerKey);
+                if (feedingIter != _feedings.end() && feedingIter->second) { feedingIter->second->wakeTime = 0; }
+            } else {
+                auto lightingIter = _lightings.find(entry.ownerKey);
+                if (lightingIter != _lightings.end() && lightingIter->second) { lightingIter->second->wakeTime = 0; }
+            }
+        }
+
+        // stepped past end of a partial timeline, so replan the remainder, waking all processes in place of any dropped transitions due by now
+        if (_timelineIndex >= _timeline.size() && _timeline.hasDropped()) {
+            for (auto feedingIter = _feedings.begin(); feedingIter != _feedings.end(); ++feedingIter) { feedingIter->second->wakeTime = 0; }
+            for (auto lightingIter = _lightings.begin(); lightingIter != _lightings.end(); ++lightingIter) { lightingIter->second->wakeTime = 0; }
+            planTimeline(time + 1);
+        }
+
         for (auto feedingIter = _feedings.begin(); feedingIter != _feedings.end(); ++feedingIter) {
-            feedingIter->second->update();
+            if (!feedingIter->second->canSkipUpdate(time)) { feedingIter->second->update(); }
         }
         for (auto lightingIter = _lightings.begin(); lightingIter != _lightings.end(); ++lightingIter) {
-            lightingIter->second->update();
+            if (!lightingIter->second->canSkipUpdate(time)) { lightingIter->second->update(); }
         }
 
         #ifdef HYDRO_USE_VERBOSE_OUTPUT
@@ -485,9 +516,21 @@ void HydroScheduler::updateDayTracking()
     _inDaytimeMode = _dailyTwilight.isDaytime(time);
 
     setNeedsScheduling();
+    setNeedsTimeKeeping();
     Hydruino::_activeInstance->setNeedsRedraw();
 }
 
+void HydroScheduler::updateTimeKeeping(time_t time)
+{
+    _nextDayStart = unixTime(localDayStart(time)) + SECS_PER_DAY;
+
+    time_t twilightDayStart = _dailyTwilight.isUTC ? unixDayStart(time) : _nextDayStart - SECS_PER_DAY;
+    time_t nextTwilight = hydroNextTwilightTime(time, twilightDayStart, _dailyTwilight.sunrise, _dailyTwilight.sunset);
+
+    _timeKeepStart = time;
+    _timeKeepUntil = min(_nextDayStart, nextTwilight);
+}
+
 void HydroScheduler::performScheduling()
 {
     HYDRO_HARD_ASSERT(hasSchedulerData(), SFP(HStr_Err_NotYetInitialized));
@@ -517,7 +560,7 @@ void HydroScheduler::performScheduling()
                     #ifdef HYDRO_USE_VERBOSE_OUTPUT
                         Serial.print(F("Scheduler::performScheduling NO sowable crop linkages found for: ")); Serial.println(iter->second->getId().getDisplayString()); flushYield();
                     #endif
-                    if (feedingIter->second) { delete feedingIter->second; }
+                    if (feedingIter->second) { releaseFeeding(feedingIter->second); delete feedingIter->second; }
                     _feedings.erase(feedingIter);
                 }
             }
@@ -552,9 +595,146 @@ void HydroScheduler::performScheduling()
         }
     }
 
+    planTimeline(unixNow());
+
     _needsScheduling = false;
 }
 
+void HydroScheduler::planTimeline(time_t planFrom)
+{
+    _timeline.clear();
+
+    {   auto maxFeedingsDay = schedulerData()->totalFeedingsPerDay;
+        time_t dayStart = unixTime(localDayStart());
+
+        for (auto feedingIter = _feedings.begin(); feedingIter != _feedings.end(); ++feedingIter) {
+            for (int slotIndex = 0; slotIndex < maxFeedingsDay; ++slotIndex) {
+                HydroPlanEntry entry;
+                entry.time = hydroFeedingSlotTime(dayStart, maxFeedingsDay, slotIndex);
+                entry.ownerKey = feedingIter->first;
+                entry.processType = HydroPlanProcess_Feeding;
+                entry.stage = HydroFeeding::TopOff;
+                if ((time_t)entry.time >= planFrom) { _timeline.insert(entry); }
+            }
+        }
+    }
+
+    for (auto lightingIter = _lightings.begin(); lightingIter != _lightings.end(); ++lightingIter) {
+        auto lighting = lightingIter->second;
+        if (!lighting) { continue; }
+        // lighting times are kept in local time, timeline is kept in unix/UTC
+        time_t stageTimes[5] = { lighting->sprayStart, lighting->lightStart, lighting->augNatLightCease, lighting->augNatLightResume, lighting->lightEnd };
+        int8_t stages[5] = { HydroLighting::Spray, HydroLighting::Light, HydroLighting::NatLight, HydroLighting::Light, HydroLighting::Done };
+        bool planned[5] = { lighting->lightStart > lighting->sprayStart, true,
+                            lighting->augNatLightCease < lighting->augNatLightResume, lighting->augNatLightCease < lighting->augNatLightResume, true };
+
+        for (int timeIndex = 0; timeIndex < 5; ++timeIndex) {
+            if (planned[timeIndex]) {
+                HydroPlanEntry entry;
+                entry.time = unixTime(DateTime((uint32_t)stageTimes[timeIndex]));
+                entry.ownerKey = lightingIter->first;
+                entry.processType = HydroPlanProcess_Lighting;
+                entry.stage = stages[timeIndex];
+                if ((time_t)entry.time >= planFrom) { _timeline.insert(entry); } // dropped entries are replanned for once stepped past last
+            }
+        }
+    }
+
+    {   int nextIndex = _timeline.nextIndex(planFrom);
+        _timelineIndex = nextIndex >= 0 ? nextIndex : _timeline.size();
+    }
+
+    #ifdef HYDRO_USE_VERBOSE_OUTPUT
+        Serial.print(F("Scheduler::planTimeline planned transitions: ")); Serial.print(_timeline.size());
+        if (_timeline.hasDropped()) { Serial.print(F(" (partial)")); }
+        Serial.println(); flushYield();
+    #endif
+}
+
+time_t HydroScheduler::getNextPlannedTime(hkey_t feedResKey, time_t time) const
+{
+    int nextIndex = _timeline.nextIndex(time + 1);
+    if (nextIndex >= 0) {
+        for (size_t timeIndex = nextIndex; timeIndex < _timeline.size(); ++timeIndex) {
+            if (_timeline[timeIndex].ownerKey == feedResKey) { return _timeline[timeIndex].time; }
+        }
+    }
+    // partial timeline gets replanned past its last entry, which may then hold this process's next transition
+    if (_timeline.hasDropped() && _timeline.size() && (time_t)_timeline[_timeline.size() - 1].time > time) {
+        return _timeline[_timeline.size() - 1].time;
+    }
+    return 0;
+}
+
+void HydroScheduler::setMaxActiveFeedings(uint8_t maxActiveFeedings)
+{
+    _maxActiveFeedings = maxActiveFeedings;
+}
+
+unsigned int HydroScheduler::getActiveFeedingsCount() const
+{
+    unsigned int activeCount = 0;
+    for (auto feedingIter = _feedings.begin(); feedingIter != _feedings.end(); ++feedingIter) {
+        if (feedingIter->second && feedingIter->second->isActive()) { ++activeCount; }
+    }
+    return activeCount;
+}
+
+bool HydroScheduler::tryBookFeeding(HydroFeeding *feeding)
+{
+    if (!feeding->bookingWaitStart) { feeding->bookingWaitStart = unixNow(); }
+
+    if (_maxActiveFeedings && getActiveFeedingsCount() >= _maxActiveFeedings) { return false; }
+
+    Vector<hkey_t, HYDRO_SCH_RESOURCES_MAXSIZE> resources;
+    feeding->getSharedResources(resources);
+
+    // Defer to any feedings that have been waiting longer on the same resources (or on an active slot)
+    for (auto feedingIter = _feedings.begin(); feedingIter != _feedings.end(); ++feedingIter) {
+        auto otherFeeding = feedingIter->second;
+        if (otherFeeding && otherFeeding != feeding && otherFeeding->bookingWaitStart &&
+            otherFeeding->bookingWaitStart < feeding->bookingWaitStart) {
+            if (_maxActiveFeedings && getActiveFeedingsCount() + 1 >= _maxActiveFeedings) { return false; }
+
+            Vector<hkey_t, HYDRO_SCH_RESOURCES_MAXSIZE> otherResources;
+            otherFeeding->getSharedResources(otherResources);
+            for (auto resIter = resources.begin(); resIter != resources.end(); ++resIter) {
+                for (auto otherResIter = otherResources.begin(); otherResIter != otherResources.end(); ++otherResIter) {
+                    if (*resIter == *otherResIter) { return false; }
+                }
+            }
+        }
+    }
+
+    // Pumps must also be able to run on their power rails alongside everything else already running
+    for (auto resIter = resources.begin(); resIter != resources.end(); ++resIter) {
+        auto objIter = Hydruino::_activeInstance->_objects.find(*resIter);
+        if (objIter != Hydruino::_activeInstance->_objects.end() && objIter->second->isActuatorType()) {
+            auto actuator = static_pointer_cast<HydroActuator>(objIter->second);
+            if (!actuator->isEnabled() && actuator->getParentRail() && !actuator->getParentRail()->canActivate(actuator.get())) { return false; }
+        }
+    }
+
+    if (_bookings.book(feeding->feedRes->getKey(), resources.size() ? &resources[0] : nullptr, resources.size())) {
+        feeding->bookingWaitStart = 0;
+        feeding->bookingsFull = false;
+        return true;
+    }
+
+    // Resources being free yet unbookable means the bookings table has run out of space
+    if (!feeding->bookingsFull && _bookings.isFree(feeding->feedRes->getKey(), resources.size() ? &resources[0] : nullptr, resources.size())) {
+        feeding->bookingsFull = true;
+        HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_NoPositionsAvailable));
+        getLogger()->logWarning(feeding->feedRes->getId().getDisplayString() + SFP(HStr_Log_FeedingSequence), SFP(HStr_ColonSpace), SFP(HStr_Err_NoPositionsAvailable));
+    }
+    return false;
+}
+
+void HydroScheduler::releaseFeeding(HydroFeeding *feeding)
+{
+    _bookings.release(feeding->feedRes->getKey());
+}
+
 void HydroScheduler::broadcastDateChange()
 {
     updateDayTracking();
@@ -590,9 +770,17 @@ void HydroScheduler::broadcastDateChange()
 
 
 HydroProcess::HydroProcess(SharedPtr<HydroFeedReservoir> feedResIn)
-    : feedRes(feedResIn), stageStart(unixNow())
+    : feedRes(feedResIn), stageStart(unixNow()), wakeTime(0)
 { ; }
 
+bool HydroProcess::actuatorReqsActivated()
+{
+    for (auto attachIter = actuatorReqs.begin(); attachIter != actuatorReqs.end(); ++attachIter) {
+        if (!attachIter->isActivated()) { return false; }
+    }
+    return true;
+}
+
 void HydroProcess::clearActuatorReqs()
 {
     while (actuatorReqs.size()) {
@@ -629,7 +817,7 @@ void HydroProcess::setActuatorReqs(const Vector<HydroActuatorAttachment, HYDRO_S
 
 
 HydroFeeding::HydroFeeding(SharedPtr<HydroFeedReservoir> feedRes)
-    : HydroProcess(feedRes), stage(Init), canProcessAfter(0), lastAirReport(0),
+    : HydroProcess(feedRes), stage(Init), canProcessAfter(0), lastAirReport(0), bookingWaitStart(0), bookingsFull(false),
       phSetpoint(0), tdsSetpoint(0), waterTempSetpoint(0), airTempSetpoint(0), co2Setpoint(0)
 {
     recalcFeeding();
@@ -682,6 +870,7 @@ void HydroFeeding::recalcFeeding()
     waterTempSetpoint = totalSetpoints[2] / totalWeights;
     airTempSetpoint = totalSetpoints[3] / totalWeights;
     co2Setpoint = totalSetpoints[4] / totalWeights;
+    wakeTime = 0;
 
     #ifdef HYDRO_USE_VERBOSE_OUTPUT // only works for singular feed res in system, otherwise output will be erratic
     {   static float _totalSetpoints[5] = {0,0,0,0,0};
@@ -799,7 +988,7 @@ void HydroFeeding::setupStaging()
                 canProcessAfter = (time_t)0;
             } else if (feedingsToday < maxFeedingsDay) {
                 // this will force feedings to be spread out during the entire day
-                canProcessAfter = unixTime(localDayStart()) + (time_t)(((float)SECS_PER_DAY / (maxFeedingsDay + 1)) * feedingsToday);
+                canProcessAfter = hydroFeedingSlotTime(unixTime(localDayStart()), maxFeedingsDay, feedingsToday);
             } else {
                 canProcessAfter = unixTime(localDayStart()) + SECS_PER_DAY; // no more feedings today
             }
@@ -871,6 +1060,7 @@ void HydroFeeding::setupStaging()
 
         case Done: {
             clearActuatorReqs();
+            getScheduler()->releaseFeeding(this);
         } break;
 
         default:
@@ -896,7 +1086,7 @@ void HydroFeeding::update()
         (getScheduler()->schedulerData()->airReportInterval > 0) && // 0 disables
         (feedRes->getAirTemperatureSensor() ||
          feedRes->getAirCO2Sensor())) {
-        getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_AirReport));
+        getLogger()->logProcess(feedRes.get(), HStr_Log_AirReport);
         logFeeding(HydroFeedingLogType_AirReport);
         lastAirReport = time;
     }
@@ -915,13 +1105,19 @@ void HydroFeeding::update()
                 }
 
                 if (!cropsCount || cropsHungry / (float)cropsCount >= HYDRO_SCH_FEED_FRACTION - FLT_EPSILON) {
-                    stage = TopOff; stageStart = time;
-                    setupStaging();
+                    if (getScheduler()->tryBookFeeding(this)) {
+                        stage = TopOff; stageStart = time;
+                        setupStaging();
 
-                    if (actuatorReqs.size()) {
-                        getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_PreFeedTopOff), SFP(HStr_Log_HasBegan));
+                        if (actuatorReqs.size()) {
+                            getLogger()->logProcess(feedRes.get(), HStr_Log_PreFeedTopOff, HStr_Log_HasBegan);
+                        }
                     }
+                } else {
+                    bookingWaitStart = 0;
                 }
+            } else {
+                bookingWaitStart = 0;
             }
         } break;
 
@@ -931,14 +1127,14 @@ void HydroFeeding::update()
                 canProcessAfter = 0; // will be used to track how long balancers stay balanced
                 setupStaging();
 
-                getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_PreFeedBalancing), SFP(HStr_Log_HasBegan));
+                getLogger()->logProcess(feedRes.get(), HStr_Log_PreFeedBalancing, HStr_Log_HasBegan);
                 if (actuatorReqs.size()) {
-                    getLogger()->logMessage(SFP(HStr_Log_Field_Aerator_Duration), String(getScheduler()->schedulerData()->preFeedAeratorMins), String('m'));
+                    getLogger()->logMessage(logArg(HStr_Log_Field_Aerator_Duration), logArg((float)getScheduler()->schedulerData()->preFeedAeratorMins, 0), logArg("m"));
                 }
                 if (feedRes->getWaterPHBalancer() || feedRes->getWaterTDSBalancer()) {
                     auto balancer = static_pointer_cast<HydroTimedDosingBalancer>(feedRes->getWaterPHBalancer() ? feedRes->getWaterPHBalancer() : feedRes->getWaterTDSBalancer());
                     if (balancer) {
-                        getLogger()->logMessage(SFP(HStr_Log_Field_MixTime_Duration), timeSpanToString(TimeSpan(balancer->getMixTime())));
+                        getLogger()->logTimeSpan(HStr_Log_Field_MixTime_Duration, balancer->getMixTime());
                     }
                 }
                 logFeeding(HydroFeedingLogType_WaterReport);
@@ -1013,27 +1209,68 @@ void HydroFeeding::update()
         }
     }
 
+    // Only a feeding waiting out its spread-out start time is purely time driven, all other stages poll sensors
+    wakeTime = 0;
+    if (stage == Init && canProcessAfter > time && actuatorReqsActivated()) {
+        wakeTime = canProcessAfter;
+        if (getScheduler()->schedulerData()->airReportInterval > 0 && (feedRes->getAirTemperatureSensor() || feedRes->getAirCO2Sensor())) {
+            wakeTime = min(wakeTime, lastAirReport + getScheduler()->schedulerData()->airReportInterval);
+        }
+    }
+
     #ifdef HYDRO_USE_VERBOSE_OUTPUT
     {   static int8_t _stageFU2 = (int8_t)-1; if (_stageFU2 != (int8_t)stage) {
         Serial.print(F("Feeding::~update stage: ")); Serial.println((_stageFU2 = (int8_t)stage)); flushYield(); } }
     #endif
 }
 
+void HydroFeeding::getSharedResources(Vector<hkey_t, HYDRO_SCH_RESOURCES_MAXSIZE> &resourcesOut)
+{
+    Vector<HydroObject *, HYDRO_SCH_RESOURCES_MAXSIZE> pumps;
+
+    {   auto topOffPumps = linksFilterPumpActuatorsByOutputReservoirAndSourceReservoirType<HYDRO_SCH_RESOURCES_MAXSIZE>(feedRes->getLinkages(), feedRes.get(), Hydro_ReservoirType_FreshWater);
+        for (auto pumpIter = topOffPumps.begin(); pumpIter != topOffPumps.end() && pumps.size() < HYDRO_SCH_RESOURCES_MAXSIZE; ++pumpIter) { pumps.push_back(*pumpIter); }
+    }
+    {   auto feedPumps = linksFilterPumpActuatorsBySourceReservoirAndOutputReservoirType<HYDRO_SCH_RESOURCES_MAXSIZE>(feedRes->getLinkages(), feedRes.get(), Hydro_ReservoirType_FeedWater);
+        for (auto pumpIter = feedPumps.begin(); pumpIter != feedPumps.end() && pumps.size() < HYDRO_SCH_RESOURCES_MAXSIZE; ++pumpIter) { pumps.push_back(*pumpIter); }
+    }
+    {   auto drainPumps = linksFilterPumpActuatorsBySourceReservoirAndOutputReservoirType<HYDRO_SCH_RESOURCES_MAXSIZE>(feedRes->getLinkages(), feedRes.get(), Hydro_ReservoirType_DrainageWater);
+        for (auto pumpIter = drainPumps.begin(); pumpIter != drainPumps.end() && pumps.size() < HYDRO_SCH_RESOURCES_MAXSIZE; ++pumpIter) { pumps.push_back(*pumpIter); }
+    }
+
+    for (auto pumpIter = pumps.begin(); pumpIter != pumps.end(); ++pumpIter) {
+        auto pump = static_cast<HydroRelayPumpActuator *>(*pumpIter);
+        hkey_t keys[3] = { pump->getKey(), hkey_none, hkey_none };
+        auto sourceRes = pump->getSourceReservoir();
+        auto destRes = pump->getDestinationReservoir();
+        if (sourceRes && sourceRes.get() != feedRes.get()) { keys[1] = sourceRes->getKey(); }
+        if (destRes && destRes.get() != feedRes.get()) { keys[2] = destRes->getKey(); }
+
+        for (int keyIndex = 0; keyIndex < 3; ++keyIndex) {
+            if (keys[keyIndex] != hkey_none && resourcesOut.size() < HYDRO_SCH_RESOURCES_MAXSIZE) {
+                bool found = false;
+                for (auto resIter = resourcesOut.begin(); resIter != resourcesOut.end() && !found; ++resIter) { found = (*resIter == keys[keyIndex]); }
+                if (!found) { resourcesOut.push_back(keys[keyIndex]); }
+            }
+        }
+    }
+}
+
 void HydroFeeding::logFeeding(HydroFeedingLogType logType, bool withSetpoints)
 {
     switch (logType) {
         case HydroFeedingLogType_WaterReport:
             if (withSetpoints) {
                 {   auto ph = HydroSingleMeasurement(phSetpoint, Hydro_UnitsType_Alkalinity_pH_14);
-                    getLogger()->logMessage(SFP(HStr_Log_Field_pH_Setpoint), measurementToString(ph));
+                    getLogger()->logMeasurement(HStr_Log_Field_pH_Setpoint, ph);
                 }
                 {   auto tds = HydroSingleMeasurement(tdsSetpoint, Hydro_UnitsType_Concentration_TDS);
                     convertUnits(&tds, feedRes->getAirConcentrateUnits());
-                    getLogger()->logMessage(SFP(HStr_Log_Field_TDS_Setpoint), measurementToString(tds, 1));
+                    getLogger()->logMeasurement(HStr_Log_Field_TDS_Setpoint, tds, 1);
                 }
                 {   auto temp = HydroSingleMeasurement(waterTempSetpoint, Hydro_UnitsType_Temperature_Celsius);
                     convertUnits(&temp, feedRes->getTemperatureUnits());
-                    getLogger()->logMessage(SFP(HStr_Log_Field_Temp_Setpoint), measurementToString(temp));
+                    getLogger()->logMeasurement(HStr_Log_Field_Temp_Setpoint, temp);
                 }
             }
             if (feedRes->getWaterPHSensor(true)) {
@@ -1042,7 +1279,7 @@ void HydroFeeding::logFeeding(HydroFeedingLogType logType, bool withSetpoints)
                 #endif
                 auto ph = feedRes->getWaterPHSensorAttachment().getMeasurement();
                 
-                getLogger()->logMessage(SFP(HStr_Log_Field_pH_Measured), measurementToString(ph));
+                getLogger()->logMeasurement(HStr_Log_Field_pH_Measured, ph);
             }
             if (feedRes->getWaterTDSSensor(true)) {
                 #ifdef HYDRO_USE_MULTITASKING
@@ -1050,7 +1287,7 @@ void HydroFeeding::logFeeding(HydroFeedingLogType logType, bool withSetpoints)
                 #endif
                 auto tds = feedRes->getWaterTDSSensorAttachment().getMeasurement();
                 convertUnits(&tds, feedRes->getAirConcentrateUnits());
-                getLogger()->logMessage(SFP(HStr_Log_Field_TDS_Measured), measurementToString(tds, 1));
+                getLogger()->logMeasurement(HStr_Log_Field_TDS_Measured, tds, 1);
             }
             if (feedRes->getWaterTemperatureSensor(true)) {
                 #ifdef HYDRO_USE_MULTITASKING
@@ -1058,7 +1295,7 @@ void HydroFeeding::logFeeding(HydroFeedingLogType logType, bool withSetpoints)
                 #endif
                 auto temp = feedRes->getWaterTemperatureSensorAttachment().getMeasurement();
                 convertUnits(&temp, feedRes->getTemperatureUnits());
-                getLogger()->logMessage(SFP(HStr_Log_Field_Temp_Measured), measurementToString(temp));
+                getLogger()->logMeasurement(HStr_Log_Field_Temp_Measured, temp);
             }
             break;
 
@@ -1066,10 +1303,10 @@ void HydroFeeding::logFeeding(HydroFeedingLogType logType, bool withSetpoints)
             if (withSetpoints) {
                 {   auto temp = HydroSingleMeasurement(airTempSetpoint, Hydro_UnitsType_Temperature_Celsius);
                     convertUnits(&temp, feedRes->getTemperatureUnits());
-                    getLogger()->logMessage(SFP(HStr_Log_Field_Temp_Setpoint), measurementToString(temp));
+                    getLogger()->logMeasurement(HStr_Log_Field_Temp_Setpoint, temp);
                 }
                 {   auto co2 = HydroSingleMeasurement(co2Setpoint, Hydro_UnitsType_Concentration_PPM);
-                    getLogger()->logMessage(SFP(HStr_Log_Field_CO2_Setpoint), measurementToString(co2));
+                    getLogger()->logMeasurement(HStr_Log_Field_CO2_Setpoint, co2);
                 }
             }
             if (feedRes->getAirTemperatureSensor(true)) {
@@ -1078,14 +1315,14 @@ void HydroFeeding::logFeeding(HydroFeedingLogType logType, bool withSetpoints)
                 #endif
                 auto temp = feedRes->getAirTemperatureSensorAttachment().getMeasurement();
                 convertUnits(&temp, feedRes->getTemperatureUnits());
-                getLogger()->logMessage(SFP(HStr_Log_Field_Temp_Measured), measurementToString(temp));
+                getLogger()->logMeasurement(HStr_Log_Field_Temp_Measured, temp);
             }
             if (feedRes->getAirCO2Sensor(true)) {
                 #ifdef HYDRO_USE_MULTITASKING
                     feedRes->getAirCO2Sensor()->yieldForMeasurement();
                 #endif
                 auto co2 = feedRes->getAirCO2SensorAttachment().getMeasurement();
-                getLogger()->logMessage(SFP(HStr_Log_Field_CO2_Measured), measurementToString(co2));
+                getLogger()->logMeasurement(HStr_Log_Field_CO2_Measured, co2);
             }
             break;
     }
@@ -1093,8 +1330,8 @@ void HydroFeeding::logFeeding(HydroFeedingLogType logType, bool withSetpoints)
 
 void HydroFeeding::broadcastFeeding(HydroFeedingBroadcastType broadcastType)
 {
-    getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_FeedingSequence),
-                            SFP(broadcastType == HydroFeedingBroadcastType_Began ? HStr_Log_HasBegan : HStr_Log_HasEnded));
+    getLogger()->logProcess(feedRes.get(), HStr_Log_FeedingSequence,
+                            broadcastType == HydroFeedingBroadcastType_Began ? HStr_Log_HasBegan : HStr_Log_HasEnded);
     logFeeding(HydroFeedingLogType_WaterReport, false);
 
     broadcastType == HydroFeedingBroadcastType_Began ? feedRes->notifyFeedingBegan() : feedRes->notifyFeedingEnded();
@@ -1160,11 +1397,10 @@ void HydroLighting::recalcLighting()
             daySprayerSecs = getScheduler()->schedulerData()->preDawnSprayMins * SECS_PER_MIN;
         }
 
-        time_t dayStart = localDayStart().unixtime();
-        lightStart = dayStart + ((SECS_PER_DAY - dayLightSecs) >> 1);
-        sprayStart = max(dayStart, lightStart - daySprayerSecs);
-        lightStart = sprayStart + daySprayerSecs;
-        lightEnd = lightStart + dayLightSecs;
+        auto lightingTimes = hydroLightingTimes(localDayStart().unixtime(), dayLightSecs, daySprayerSecs);
+        sprayStart = lightingTimes.sprayStart;
+        lightStart = lightingTimes.lightStart;
+        lightEnd = lightingTimes.lightEnd;
 
         int natLightOffset = getScheduler()->getNaturalLightOffsetMins();
         if (natLightOffset >= 0) {
@@ -1185,6 +1421,7 @@ void HydroLighting::recalcLighting()
                 Serial.print(F("Lighting::recalcLighting lightHours: ")); Serial.println(_totalLightHours); flushYield(); } }
         #endif
     }
+    wakeTime = 0;
 
     setupStaging();
 }
@@ -1254,10 +1491,10 @@ void HydroLighting::update()
                 setupStaging();
 
                 if (lightStart > sprayStart) {
-                    getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_PreDawnSpraying), SFP(HStr_Log_HasBegan));
-                    getLogger()->logMessage(SFP(HStr_Log_Field_Sprayer_Duration), String(getScheduler()->schedulerData()->preDawnSprayMins), String('m'));
-                    getLogger()->logMessage(SFP(HStr_Log_Field_Time_Start), DateTime((uint32_t)sprayStart).timestamp(DateTime::TIMESTAMP_TIME));
-                    getLogger()->logMessage(SFP(HStr_Log_Field_Time_Finish), DateTime((uint32_t)lightStart).timestamp(DateTime::TIMESTAMP_TIME));
+                    getLogger()->logProcess(feedRes.get(), HStr_Log_PreDawnSpraying, HStr_Log_HasBegan);
+                    getLogger()->logMessage(logArg(HStr_Log_Field_Sprayer_Duration), logArg((float)getScheduler()->schedulerData()->preDawnSprayMins, 0), logArg("m"));
+                    getLogger()->logTimeOfDay(HStr_Log_Field_Time_Start, sprayStart);
+                    getLogger()->logTimeOfDay(HStr_Log_Field_Time_Finish, lightStart);
                 }
             }
         } break;
@@ -1267,10 +1504,10 @@ void HydroLighting::update()
                 stage = Light; stageStart = time;
                 setupStaging();
 
-                getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_LightingSequence), SFP(HStr_Log_HasBegan));
-                getLogger()->logMessage(SFP(HStr_Log_Field_Light_Duration), roundToString(lightHours), String('h'));
-                getLogger()->logMessage(SFP(HStr_Log_Field_Time_Start), DateTime((uint32_t)lightStart).timestamp(DateTime::TIMESTAMP_TIME));
-                getLogger()->logMessage(SFP(HStr_Log_Field_Time_Finish), DateTime((uint32_t)lightEnd).timestamp(DateTime::TIMESTAMP_TIME));
+                getLogger()->logProcess(feedRes.get(), HStr_Log_LightingSequence, HStr_Log_HasBegan);
+                getLogger()->logMessage(logArg(HStr_Log_Field_Light_Duration), logArg(lightHours, defaultDecimalPlaces()), logArg("h"));
+                getLogger()->logTimeOfDay(HStr_Log_Field_Time_Start, lightStart);
+                getLogger()->logTimeOfDay(HStr_Log_Field_Time_Finish, lightEnd);
             } else {
                 stage = Done; stageStart = time;
                 setupStaging();
@@ -1282,18 +1519,18 @@ void HydroLighting::update()
                 stage = Done; stageStart = time;
                 setupStaging();
 
-                getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_LightingSequence), SFP(HStr_Log_HasEnded));
-                getLogger()->logMessage(SFP(HStr_Log_Field_Time_Measured), timeSpanToString(TimeSpan((time - stageStart) + lightTimeOffset)));
+                getLogger()->logProcess(feedRes.get(), HStr_Log_LightingSequence, HStr_Log_HasEnded);
+                getLogger()->logTimeSpan(HStr_Log_Field_Time_Measured, (time - stageStart) + lightTimeOffset);
                 lightTimeOffset = 0;
             } else if (currTime >= augNatLightCease && currTime < augNatLightResume) {
                 lightTimeOffset = time - stageStart;
                 stage = NatLight; stageStart = time;
                 setupStaging();
 
-                getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_NatLightingSequence), SFP(HStr_Log_HasBegan));
-                getLogger()->logMessage(SFP(HStr_Log_Field_Light_Duration), roundToString((augNatLightResume - augNatLightCease) / (float)SECS_PER_HOUR), String('h'));
-                getLogger()->logMessage(SFP(HStr_Log_Field_Time_Start), DateTime((uint32_t)augNatLightCease).timestamp(DateTime::TIMESTAMP_TIME));
-                getLogger()->logMessage(SFP(HStr_Log_Field_Time_Finish), DateTime((uint32_t)augNatLightResume).timestamp(DateTime::TIMESTAMP_TIME));
+                getLogger()->logProcess(feedRes.get(), HStr_Log_NatLightingSequence, HStr_Log_HasBegan);
+                getLogger()->logMessage(logArg(HStr_Log_Field_Light_Duration), logArg((augNatLightResume - augNatLightCease) / (float)SECS_PER_HOUR, defaultDecimalPlaces()), logArg("h"));
+                getLogger()->logTimeOfDay(HStr_Log_Field_Time_Start, augNatLightCease);
+                getLogger()->logTimeOfDay(HStr_Log_Field_Time_Finish, augNatLightResume);
             }
         } break;
 
@@ -1302,8 +1539,8 @@ void HydroLighting::update()
                 stage = Light; stageStart = time;
                 setupStaging();
 
-                getLogger()->logProcess(feedRes.get(), SFP(HStr_Log_NatLightingSequence), SFP(HStr_Log_HasEnded));
-                getLogger()->logMessage(SFP(HStr_Log_Field_Time_Measured), timeSpanToString(TimeSpan(time - stageStart)));
+                getLogger()->logProcess(feedRes.get(), HStr_Log_NatLightingSequence, HStr_Log_HasEnded);
+                getLogger()->logTimeSpan(HStr_Log_Field_Time_Measured, time - stageStart);
             }
         } break;
 
@@ -1323,6 +1560,13 @@ void HydroLighting::update()
         }
     }
 
+    // Lighting is purely time driven, so sleep until the next planned transition (else until the date changes and lighting is replanned)
+    wakeTime = 0;
+    if ((stage == Init || stage == Light || stage == NatLight) && actuatorReqsActivated()) {
+        time_t nextTime = getScheduler()->getNextPlannedTime(feedRes->getKey(), time);
+        wakeTime = nextTime ? nextTime : getScheduler()->getNextDayStart();
+    }
+
     #ifdef HYDRO_USE_VERBOSE_OUTPUT
     {   static int8_t _stageLU2 = (int8_t)-1; if (_stageLU2 != (int8_t)stage) {
         Serial.print(F("Lighting::~update stage: ")); Serial.println((_stageLU2 = (int8_t)stage)); flushYield(); } }
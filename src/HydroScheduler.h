@@ -14,6 +14,7 @@ struct HydroFeeding;
 struct HydroLighting;
 
 #include "Hydruino.h"
+#include "HydroCoreLogic.h"
 
 // Scheduler
 // The Scheduler acts as the system's main scheduling attendant, who looks through all
@@ -33,6 +34,32 @@ public:
     inline bool needsScheduling() { return _needsScheduling; }
     inline bool inDaytimeMode() const { return _inDaytimeMode; }
 
+    // Time-keeping caches the next significant time boundary (local midnight, sunrise/sunset),
+    // so that date/daytime checks only occur once that boundary passes. Should be invalidated
+    // whenever the clock, time zone, or system location is changed.
+    inline void setNeedsTimeKeeping() { _timeKeepUntil = 0; }
+    inline time_t getNextDayStart() const { return _nextDayStart; }
+
+    // Feedings book their shared resources (pumps, and any reservoirs outside of their own
+    // feed reservoir, such as fresh water inlets and drains) before leaving their Init stage,
+    // so that feedings sharing resources are staggered in order of waiting rather than
+    // colliding. Max active feedings further limits how many feedings run at once (0 for
+    // unlimited), e.g. to keep simultaneous pumping within rail or plumbing capacity.
+    void setMaxActiveFeedings(uint8_t maxActiveFeedings);
+    inline uint8_t getMaxActiveFeedings() const { return _maxActiveFeedings; }
+    unsigned int getActiveFeedingsCount() const;
+
+    // The daily timeline is a look-ahead plan of the time-driven stage transitions of every
+    // process (feeding slots, spraying/lighting sequences), rebuilt whenever scheduling is
+    // performed (including upon date change). The run loop steps through it to wake processes
+    // exactly when their next transition comes due, and it can be inspected by UI/remotes.
+    // Only upcoming transitions are planned, and should they not all fit, the remainder is
+    // replanned once the run loop steps past the last one held.
+    inline const HydroPlanTimeline<HYDRO_SCH_TIMELINE_MAXSIZE> &getDailyTimeline() const { return _timeline; }
+    // Returns next planned transition time strictly after time for given feed reservoir's processes (or time timeline
+    // gets replanned at, if partial), else 0 if none.
+    time_t getNextPlannedTime(hkey_t feedResKey, time_t time) const;
+
     void setupWaterPHBalancer(HydroReservoir *reservoir, SharedPtr<HydroBalancer> waterPHBalancer);
     void setupWaterTDSBalancer(HydroReservoir *reservoir, SharedPtr<HydroBalancer> waterTDSBalancer);
     void setupWaterTemperatureBalancer(HydroReservoir *reservoir, SharedPtr<HydroBalancer> waterTempBalancer);
@@ -70,8 +97,15 @@ protected:
     bool _needsScheduling;                                  // Needs rescheduling tracking flag
     bool _inDaytimeMode;                                    // Daytime mode flag
     hposi_t _lastDay[3];                                    // Last day tracking for rescheduling (Y-2k,M,D)
+    time_t _timeKeepStart;                                  // Time time-keeping was last computed at (unix/UTC)
+    time_t _timeKeepUntil;                                  // Time of next significant time boundary (unix/UTC), else 0 for recompute
+    time_t _nextDayStart;                                   // Time of next local midnight (unix/UTC)
     Map<hkey_t, HydroFeeding *, HYDRO_SCH_PROCS_MAXSIZE> _feedings; // Feed reservoir feeding processes
     Map<hkey_t, HydroLighting *, HYDRO_SCH_PROCS_MAXSIZE> _lightings; // Feed reservoir lighting processes
+    HydroResourceBookings<hkey_t, HYDRO_SCH_BOOKINGS_MAXSIZE> _bookings; // Feeding shared resource bookings (resource key -> feed reservoir key)
+    uint8_t _maxActiveFeedings;                             // Maximum number of actively running feedings, else 0 for unlimited
+    HydroPlanTimeline<HYDRO_SCH_TIMELINE_MAXSIZE> _timeline; // Planned daily timeline of process stage transitions
+    uint8_t _timelineIndex;                                 // Index of next timeline entry to step to
 
     friend class Hydruino;
     friend struct HydroProcess;
@@ -82,8 +116,13 @@ protected:
     inline bool hasSchedulerData() const;
 
     void updateDayTracking();
+    void updateTimeKeeping(time_t time);
     void performScheduling();
+    void planTimeline(time_t planFrom);
     void broadcastDateChange();
+
+    bool tryBookFeeding(HydroFeeding *feeding);
+    void releaseFeeding(HydroFeeding *feeding);
 };
 
 
@@ -107,9 +146,15 @@ struct HydroProcess {
     Vector<HydroActuatorAttachment, HYDRO_SCH_REQACTS_MAXSIZE> actuatorReqs; // Actuators required for this stage (keep-enabled list)
 
     time_t stageStart;                                      // Stage start time
+    time_t wakeTime;                                        // Time process next needs updated by (unix/UTC), else 0 for every update
 
     HydroProcess(SharedPtr<HydroFeedReservoir> feedRes);
 
+    // Returns if process can skip its update, i.e. is idly waiting on a time boundary not yet reached.
+    inline bool canSkipUpdate(time_t time) const { return wakeTime && time < wakeTime; }
+    // Returns if all required actuators have active activations (safe to sleep on).
+    bool actuatorReqsActivated();
+
     void clearActuatorReqs();
     void setActuatorReqs(const Vector<HydroActuatorAttachment, HYDRO_SCH_REQACTS_MAXSIZE> &actuatorReqsIn);
 };
@@ -120,6 +165,8 @@ struct HydroFeeding : public HydroProcess {
 
     time_t canProcessAfter;                                 // Time next processing can occur (unix/UTC), else 0/disabled
     time_t lastAirReport;                                   // Last time an air report was generated (unix/UTC)
+    time_t bookingWaitStart;                                // Time feeding began waiting on shared resources (unix/UTC), else 0/not waiting
+    bool bookingsFull;                                      // If feeding was refused a booking for lack of booking space (logged once)
 
     float phSetpoint;                                       // Calculated pH setpoint for attached crops
     float tdsSetpoint;                                      // Calculated TDS setpoint for attached crops
@@ -134,6 +181,10 @@ struct HydroFeeding : public HydroProcess {
     void setupStaging();
     void update();
 
+    // Gathers keys of pumps used through feeding stages, along with any reservoirs they share outside of feed reservoir.
+    void getSharedResources(Vector<hkey_t, HYDRO_SCH_RESOURCES_MAXSIZE> &resourcesOut);
+    inline bool isActive() const { return stage > Init && stage < Done; }
+
 private:
     void logFeeding(HydroFeedingLogType logType, bool withSetpoints = true);
     void broadcastFeeding(HydroFeedingBroadcastType broadcastType);
@@ -6,23 +6,27 @@
 #include "Hydruino.h"
 
 HydroEEPROMStream::HydroEEPROMStream()
-    : Stream(), _eeprom(nullptr), _readAddress(0), _writeAddress(0), _endAddress(0)
+    : Stream(), _eeprom(getController() ? getController()->getEEPROM() : nullptr), _readAddress(0), _writeAddress(0), _endAddress(0),
+      _pageBuffer(_eeprom, _eeprom ? _eeprom->getDeviceSize() : 0, _eeprom ? _eeprom->getPageSize() : 0)
 {
-    if (getController() && (_eeprom = getController()->getEEPROM())) {
+    if (_eeprom) {
         _endAddress = _eeprom->getDeviceSize();
     }
     HYDRO_HARD_ASSERT(_eeprom, SFP(HStr_Err_UnsupportedOperation));
 }
 
 HydroEEPROMStream::HydroEEPROMStream(uint16_t dataAddress, size_t dataSize)
-      : Stream(), _eeprom(nullptr), _readAddress(dataAddress), _writeAddress(dataAddress), _endAddress(dataAddress + dataSize)
+      : Stream(), _eeprom(getController() ? getController()->getEEPROM() : nullptr), _readAddress(dataAddress), _writeAddress(dataAddress), _endAddress(dataAddress + dataSize),
+        _pageBuffer(_eeprom, _eeprom ? _eeprom->getDeviceSize() : 0, _eeprom ? _eeprom->getPageSize() : 0)
 {
-    if (getController()) {
-        _eeprom = getController()->getEEPROM();
-    }
     HYDRO_HARD_ASSERT(_eeprom, SFP(HStr_Err_UnsupportedOperation));
 }
 
+HydroEEPROMStream::~HydroEEPROMStream()
+{
+    flush();
+}
+
 int HydroEEPROMStream::available()
 {
     return _eeprom ? ((int)_endAddress - _readAddress) : 0;
@@ -31,13 +35,17 @@ int HydroEEPROMStream::available()
 int HydroEEPROMStream::read()
 {
     if (!_eeprom || _readAddress >= _endAddress) { return -1; }
-    return (int)_eeprom->readByte(_readAddress++);
+    int retVal = _pageBuffer.read(_readAddress);
+    if (retVal >= 0) { _readAddress++; }
+    return retVal;
 }
 
 size_t HydroEEPROMStream::readBytes(char *buffer, size_t length)
 {
     if (!_eeprom || _readAddress >= _endAddress) { return -1; }
-    size_t retVal = _eeprom->readBlock(_readAddress, (uint8_t *)buffer, length);
+    size_t remaining = _endAddress - _readAddress;
+    if (length > remaining) { length = remaining; }
+    size_t retVal = _pageBuffer.readBlock(_readAddress, (uint8_t *)buffer, length);
     _readAddress += retVal;
     return retVal;
 }
@@ -45,35 +53,43 @@ size_t HydroEEPROMStream::readBytes(char *buffer, size_t length)
 int HydroEEPROMStream::peek()
 {
     if (!_eeprom || _readAddress >= _endAddress) { return -1; }
-    return (int)_eeprom->readByte(_readAddress);
+    return _pageBuffer.read(_readAddress);
 }
 
 void HydroEEPROMStream::flush()
 {
-    //_eeprom->commit();
+    if (_eeprom && !_pageBuffer.flush()) {
+        setWriteError();
+        HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_OperationFailure));
+    }
 }
 
 size_t HydroEEPROMStream::write(const uint8_t *buffer, size_t size)
 {
-    if (!_eeprom || _writeAddress >= _endAddress) { return 0; }
-    size_t remaining = _endAddress - _writeAddress;
-    if (size > remaining) { size = remaining; }
-    if (_eeprom->updateBlockVerify(_writeAddress, buffer, size)) {
-        _writeAddress += size;
-        return size;
-    } else {
+    if (!_eeprom) { return 0; }
+    size_t remaining = _writeAddress < _endAddress ? _endAddress - _writeAddress : 0;
+    if (size > remaining) { // overflow, truncated data must not pass as written
+        setWriteError();
+        if (!(size = remaining)) { return 0; }
+    }
+    size_t retVal = _pageBuffer.writeBlock(_writeAddress, buffer, size);
+    _writeAddress += retVal;
+    if (retVal < size) {
+        setWriteError();
         HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_OperationFailure));
-        return 0;
     }
+    return retVal;
 }
 
 size_t HydroEEPROMStream::write(uint8_t data)
 {
-    if (!_eeprom || _writeAddress >= _endAddress) { return 0; }
-    if (_eeprom->updateByteVerify(_writeAddress, data)) {
+    if (!_eeprom) { return 0; }
+    if (_writeAddress >= _endAddress) { setWriteError(); return 0; } // overflow
+    if (_pageBuffer.write(_writeAddress, data)) {
         _writeAddress += 1;
         return 1;
     } else {
+        setWriteError();
         HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_OperationFailure));
         return 0;
     }
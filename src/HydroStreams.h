@@ -11,6 +11,7 @@ class HydroEEPROMStream;
 class HydroPROGMEMStream;
 
 #include "Hydruino.h"
+#include "HydroCoreLogic.h"
 
 #ifdef ARDUINO_ARCH_SAM // Stream doesn't have availableForWrite
 #define HYDRO_STREAM_AVAIL4WRT_OVERRIDE
@@ -19,11 +20,16 @@ class HydroPROGMEMStream;
 #endif
 
 // EEPROM Stream
-// Stream class for working with I2C_EEPROM data.
+// Stream class for working with I2C_EEPROM data. Reads are served from a page-aligned
+// read-ahead buffer and writes are combined into whole device pages, so that byte-wise
+// (de)serialization doesn't cost a bus transaction per byte. Pending writes are flushed
+// on flush() (setting write error on failure) or destruction. Writes past the end of the
+// stream's data region also set write error, so truncated data is never taken as saved.
 class HydroEEPROMStream : public Stream {
 public:
     HydroEEPROMStream();
     HydroEEPROMStream(uint16_t dataAddress, size_t dataSize);
+    virtual ~HydroEEPROMStream();
 
     virtual int available() override;
     virtual int read() override;
@@ -34,9 +40,14 @@ public:
     virtual size_t write(uint8_t data) override;
     virtual int availableForWrite() HYDRO_STREAM_AVAIL4WRT_OVERRIDE;
 
+    inline uint16_t getReadAddress() const { return _readAddress; }
+    inline uint16_t getWriteAddress() const { return _writeAddress; }
+    inline bool isWriteFull() const { return _writeAddress >= _endAddress; }
+
 protected:
     I2C_eeprom *_eeprom;
     uint16_t _readAddress, _writeAddress, _endAddress;
+    HydroEEPROMPageBuffer<I2C_eeprom, HYDRO_EEPROM_PAGEBUFFER_SIZE> _pageBuffer;
 };
 
 
@@ -8,16 +8,32 @@
 static char _blank = '\000';
 const char *HStr_Blank = &_blank;
 
+#if HYDRO_STRING_CACHE_ENTRIES
+static HydroStringCache<HYDRO_STRING_CACHE_ENTRIES, HYDRO_STRING_CACHE_ENTRYSIZE> _lookupCache; // LRU cache reduces a lot of lookup access
+#endif
+static Hydro_String _lookupStrNum = (Hydro_String)-1;       // Most recent lookup, for strings too long for cache
+static String _lookupCachedRes;
+static uint32_t _lookupHits = 0;                            // Most recent lookup hit counter
+static uint32_t _lookupMisses = 0;                          // Storage lookup counter (when not cached by LRU cache)
+
 static uint16_t _strDataAddress((uint16_t)-1);
 void beginStringsFromEEPROM(uint16_t dataAddress)
 {
     _strDataAddress = dataAddress;
+    #if HYDRO_STRING_CACHE_ENTRIES
+        _lookupCache.clear();
+    #endif
+    _lookupStrNum = (Hydro_String)-1;
 }
 
 static String _strDataFilePrefix;
 void beginStringsFromSDCard(String dataFilePrefix)
 {
     _strDataFilePrefix = dataFilePrefix;
+    #if HYDRO_STRING_CACHE_ENTRIES
+        _lookupCache.clear();
+    #endif
+    _lookupStrNum = (Hydro_String)-1;
 }
 
 inline String getStringsFilename()
@@ -38,12 +54,70 @@ inline String getStringsFilename()
     return filename;
 }
 
+uint32_t getStringsCacheHits()
+{
+    #if HYDRO_STRING_CACHE_ENTRIES
+        return _lookupCache.getHits() + _lookupHits;
+    #else
+        return _lookupHits;
+    #endif
+}
+
+uint32_t getStringsCacheMisses()
+{
+    return _lookupMisses;
+}
+
+static String lookupStringFromStorage(Hydro_String strNum);
+
+uint16_t getStringsCRC()
+{
+    static bool _stringsCRCValid = false;
+    static uint16_t _stringsCRC = 0xFFFF;
+
+    if (!_stringsCRCValid) {
+        for (int strNum = 0; strNum < (int)HStr_Count; ++strNum) {
+            #ifndef HYDRO_DISABLE_BUILTIN_DATA
+                const char *flashStr = pgmAddrForStr((Hydro_String)strNum);
+                uint8_t byte;
+                do {
+                    #ifdef ESP8266
+                        byte = pgm_read_byte((const void *)(flashStr++));
+                    #else
+                        byte = pgm_read_byte(flashStr++);
+                    #endif
+                    _stringsCRC = hydroCRC16(_stringsCRC, byte);
+                } while (byte);
+            #else
+                _stringsCRC = HydroLogFileHeader::crcString(_stringsCRC, lookupStringFromStorage((Hydro_String)strNum).c_str());
+            #endif
+        }
+        _stringsCRCValid = true;
+    }
+    return _stringsCRC;
+}
+
 String stringFromPGM(Hydro_String strNum)
-{    
-    static Hydro_String _lookupStrNum = (Hydro_String)-1; // Simple LRU cache reduces a lot of lookup access
-    static String _lookupCachedRes;
-    if (strNum == _lookupStrNum) { return _lookupCachedRes; }
-    else { _lookupStrNum = strNum; } // _lookupCachedRes set below
+{
+    if (strNum == _lookupStrNum) { ++_lookupHits; return _lookupCachedRes; }
+    #if HYDRO_STRING_CACHE_ENTRIES
+    {   const char *cachedStr = _lookupCache.lookup((int)strNum);
+        if (cachedStr) { return String(cachedStr); }
+    }
+    #endif
+    ++_lookupMisses;
+
+    String retVal = lookupStringFromStorage(strNum);
+    #if HYDRO_STRING_CACHE_ENTRIES
+        if (_lookupCache.store((int)strNum, retVal.c_str(), retVal.length())) { return retVal; }
+    #endif
+    _lookupStrNum = strNum;
+    _lookupCachedRes = retVal;
+    return retVal;
+}
+
+static String lookupStringFromStorage(Hydro_String strNum)
+{
 
     if (_strDataAddress != (uint16_t)-1) {
         auto eeprom = getController()->getEEPROM();
@@ -65,63 +139,47 @@ String stringFromPGM(Hydro_String strNum)
                 }
 
                 if (retVal.length()) {
-                    return (_lookupCachedRes = retVal);
+                    return retVal;
                 }
             }
         }
     }
 
     if (_strDataFilePrefix.length()) {
-        #if HYDRO_SYS_LEAVE_FILES_OPEN
-            static
-        #endif
-        auto sd = getController()->getSDCard();
+        auto file = getController()->getSDFile(getStringsFilename().c_str());
 
-        if (sd) {
+        if (file) {
             String retVal;
-            #if HYDRO_SYS_LEAVE_FILES_OPEN
-                static
+            uint16_t lookupOffset = 0;
+            file->seek(sizeof(uint16_t) * (int)strNum);
+            #if defined(ARDUINO_ARCH_RP2040) || defined(ESP_PLATFORM)
+                file->readBytes((char *)&lookupOffset, sizeof(lookupOffset));
+            #else
+                file->readBytes((uint8_t *)&lookupOffset, sizeof(lookupOffset));
             #endif
-            auto file = sd->open(getStringsFilename().c_str(), FILE_READ);
 
-            if (file) {
-                uint16_t lookupOffset = 0;
-                file.seek(sizeof(uint16_t) * (int)strNum);
-                #if defined(ARDUINO_ARCH_RP2040) || defined(ESP_PLATFORM)
-                    file.readBytes((char *)&lookupOffset, sizeof(lookupOffset));
-                #else
-                    file.readBytes((uint8_t *)&lookupOffset, sizeof(lookupOffset));
-                #endif
-
-                {   char buffer[HYDRO_STRING_BUFFER_SIZE];
-                    file.seek(lookupOffset);
-                    auto bytesRead = file.readBytesUntil('\000', buffer, HYDRO_STRING_BUFFER_SIZE);
-                    retVal.concat(charsToString(buffer, bytesRead));
+            {   char buffer[HYDRO_STRING_BUFFER_SIZE];
+                file->seek(lookupOffset);
+                auto bytesRead = file->readBytesUntil('\000', buffer, HYDRO_STRING_BUFFER_SIZE);
+                retVal.concat(charsToString(buffer, bytesRead));
 
-                    while (strnlen(buffer, HYDRO_STRING_BUFFER_SIZE) == HYDRO_STRING_BUFFER_SIZE) {
-                        bytesRead = file.readBytesUntil('\000', buffer, HYDRO_STRING_BUFFER_SIZE);
-                        if (bytesRead) { retVal.concat(charsToString(buffer, bytesRead)); }
-                    }
+                while (strnlen(buffer, HYDRO_STRING_BUFFER_SIZE) == HYDRO_STRING_BUFFER_SIZE) {
+                    bytesRead = file->readBytesUntil('\000', buffer, HYDRO_STRING_BUFFER_SIZE);
+                    if (bytesRead) { retVal.concat(charsToString(buffer, bytesRead)); }
                 }
-
-                #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                    file.close();
-                #endif
             }
 
-            #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                getController()->endSDCard(sd);
-            #endif
+            getController()->endSDFile(file);
             if (retVal.length()) {
-                return (_lookupCachedRes = retVal);
+                return retVal;
             }
         }
     }
 
     #ifndef HYDRO_DISABLE_BUILTIN_DATA
-        return (_lookupCachedRes = stringFromPGMAddr(pgmAddrForStr(strNum)));
+        return stringFromPGMAddr(pgmAddrForStr(strNum));
     #else
-        return (_lookupCachedRes = String());
+        return String();
     #endif
 }
 
@@ -1773,6 +1831,83 @@ const char *pgmAddrForStr(Hydro_String strNum)
             static const char flashStr_Unit_Undefined[] PROGMEM = {"[undef]"};
             return flashStr_Unit_Undefined;
         } break;
+
+        case HStr_tmp: {
+            static const char flashStr_tmp[] PROGMEM = {"tmp"};
+            return flashStr_tmp;
+        } break;
+        case HStr_Key_LogBinary: {
+            static const char flashStr_Key_LogBinary[] PROGMEM = {"logBinary"};
+            return flashStr_Key_LogBinary;
+        } break;
+        case HStr_Key_ActivationCount: {
+            static const char flashStr_Key_ActivationCount[] PROGMEM = {"activationCount"};
+            return flashStr_Key_ActivationCount;
+        } break;
+        case HStr_Key_ActuatorName: {
+            static const char flashStr_Key_ActuatorName[] PROGMEM = {"actuatorName"};
+            return flashStr_Key_ActuatorName;
+        } break;
+        case HStr_Key_Bucket: {
+            static const char flashStr_Key_Bucket[] PROGMEM = {"bucket"};
+            return flashStr_Key_Bucket;
+        } break;
+        case HStr_Key_Daily: {
+            static const char flashStr_Key_Daily[] PROGMEM = {"daily"};
+            return flashStr_Key_Daily;
+        } break;
+        case HStr_Key_EnergyUsageWh: {
+            static const char flashStr_Key_EnergyUsageWh[] PROGMEM = {"energyUsageWh"};
+            return flashStr_Key_EnergyUsageWh;
+        } break;
+        case HStr_Key_Hourly: {
+            static const char flashStr_Key_Hourly[] PROGMEM = {"hourly"};
+            return flashStr_Key_Hourly;
+        } break;
+        case HStr_Key_OnTimeMillis: {
+            static const char flashStr_Key_OnTimeMillis[] PROGMEM = {"onTimeMillis"};
+            return flashStr_Key_OnTimeMillis;
+        } break;
+        case HStr_Key_OnTimeSecs: {
+            static const char flashStr_Key_OnTimeSecs[] PROGMEM = {"onTimeSecs"};
+            return flashStr_Key_OnTimeSecs;
+        } break;
+        case HStr_Key_Previous: {
+            static const char flashStr_Key_Previous[] PROGMEM = {"previous"};
+            return flashStr_Key_Previous;
+        } break;
+        case HStr_Key_Weekly: {
+            static const char flashStr_Key_Weekly[] PROGMEM = {"weekly"};
+            return flashStr_Key_Weekly;
+        } break;
+        case HStr_Key_Deadband: {
+            static const char flashStr_Key_Deadband[] PROGMEM = {"deadband"};
+            return flashStr_Key_Deadband;
+        } break;
+        case HStr_Key_Deadbands: {
+            static const char flashStr_Key_Deadbands[] PROGMEM = {"deadbands"};
+            return flashStr_Key_Deadbands;
+        } break;
+        case HStr_Key_Heartbeat: {
+            static const char flashStr_Key_Heartbeat[] PROGMEM = {"heartbeat"};
+            return flashStr_Key_Heartbeat;
+        } break;
+        case HStr_Log_EEPROMSlotsReduced: {
+            static const char flashStr_Log_EEPROMSlotsReduced[] PROGMEM = {"System data overflowed EEPROM slot, slots reduced to: "};
+            return flashStr_Log_EEPROMSlotsReduced;
+        } break;
+        case HStr_bak: {
+            static const char flashStr_bak[] PROGMEM = {"bak"};
+            return flashStr_bak;
+        } break;
+        case HStr_Log_AutosaveSnapshotFailed: {
+            static const char flashStr_Log_AutosaveSnapshotFailed[] PROGMEM = {"Autosave snapshot failed, saving synchronously"};
+            return flashStr_Log_AutosaveSnapshotFailed;
+        } break;
+        case HStr_Log_ConfigFileFallback: {
+            static const char flashStr_Log_ConfigFileFallback[] PROGMEM = {"Config file unreadable, loaded from: "};
+            return flashStr_Log_ConfigFileFallback;
+        } break;
     }
     return nullptr;
 }
@@ -421,6 +421,28 @@ enum Hydro_String : unsigned short {
     HStr_Unit_PPM700,
     HStr_Unit_Undefined,
 
+    // Entries added since are appended below (in any category), rather than inserted above, so that
+    // string ids stored by existing firmware (e.g. in binary logs) keep referring to the same strings
+    HStr_tmp,
+    HStr_Key_LogBinary,
+    HStr_Key_ActivationCount,
+    HStr_Key_ActuatorName,
+    HStr_Key_Bucket,
+    HStr_Key_Daily,
+    HStr_Key_EnergyUsageWh,
+    HStr_Key_Hourly,
+    HStr_Key_OnTimeMillis,
+    HStr_Key_OnTimeSecs,
+    HStr_Key_Previous,
+    HStr_Key_Weekly,
+    HStr_Key_Deadband,
+    HStr_Key_Deadbands,
+    HStr_Key_Heartbeat,
+    HStr_Log_EEPROMSlotsReduced,
+    HStr_bak,
+    HStr_Log_AutosaveSnapshotFailed,
+    HStr_Log_ConfigFileFallback,
+
     HStr_Count
 };
 
@@ -440,6 +462,18 @@ extern void beginStringsFromEEPROM(uint16_t dataAddress);
 // Makes Strings lookup go through SD card strings file at file prefix.
 extern void beginStringsFromSDCard(String dataFilePrefix);
 
+// Returns string lookup cache hit/miss counts. Lookups are kept in a small LRU cache (when
+// HYDRO_STRING_CACHE_ENTRIES is non-zero, by default only with built-in data disabled), and
+// the most recent lookup is always kept, so that repeated lookups don't go back through
+// EEPROM/SD card string storage each time. Misses count lookups that went to storage.
+extern uint32_t getStringsCacheHits();
+extern uint32_t getStringsCacheMisses();
+
+// Returns CRC-16 of all string texts in string number order (each null terminated), as
+// identifies the string table in binary log file headers (see HydroLogFileHeader). Computed
+// on first call, then cached.
+extern uint16_t getStringsCRC();
+
 #ifndef HYDRO_DISABLE_BUILTIN_DATA
 // Returns string from given PROGMEM (Flash) string address.
 String stringFromPGMAddr(const char *flashStr);
@@ -61,7 +61,14 @@ void softAssert(bool cond, String msg, const char *file, const char *func, int l
 {
     if (!cond) {
         if (getLogger()) {
-            getLogger()->logWarning(SFP(HStr_Err_AssertionFailure), makeAssertMsg(file, func, line), msg);
+            // File, line, and message go as separate arguments, so that binary log records keep the
+            // message rather than have it crowded out by function name (debug output only)
+            String fileText = SFP(HStr_ColonSpace);
+            fileText.concat(fileFromFullPath(String(file)));
+            fileText.concat(':');
+            String msgText = SFP(HStr_ColonSpace);
+            msgText.concat(msg);
+            getLogger()->logWarning(logArg(HStr_Err_AssertionFailure), logArg(fileText.c_str()), logArg((float)line, 0), logArg(msgText.c_str()));
             getLogger()->flush();
         }
         #ifdef HYDRO_ENABLE_DEBUG_OUTPUT
@@ -136,6 +143,7 @@ void _setUnixTime(DateTime unixTime, bool isSigTime)
     } else {
         setTime(unixTime.unixtime());
     }
+    if (getScheduler()) { getScheduler()->setNeedsTimeKeeping(); }
 
     if (getController() && (isSigTime ||
         getLogger()->getSystemInit() <= SECS_YR_2000 ||
@@ -144,7 +152,7 @@ void _setUnixTime(DateTime unixTime, bool isSigTime)
     }
 }
 
-String getYYMMDDFilename(String prefix, String ext)
+String getYYMMDDFilename(const String &prefix, const String &ext)
 {
     DateTime currTime = localNow();
     uint8_t yy = currTime.year() % 100;
@@ -166,7 +174,7 @@ String getYYMMDDFilename(String prefix, String ext)
     return retVal;
 }
 
-String getNNFilename(String prefix, unsigned int value, String ext)
+String getNNFilename(const String &prefix, unsigned int value, const String &ext)
 {
     String retVal; retVal.reserve(prefix.length() + 6 + 1);
 
@@ -179,6 +187,19 @@ String getNNFilename(String prefix, unsigned int value, String ext)
     return retVal;
 }
 
+String getSiblingFilename(const String &filename, const String &ext)
+{
+    int extIndex = filename.lastIndexOf('.');
+    if (extIndex <= filename.lastIndexOf(HYDRO_FSPATH_SEPARATOR)) { extIndex = filename.length(); }
+    String retVal; retVal.reserve(extIndex + ext.length() + 1);
+
+    retVal.concat(filename.substring(0, extIndex));
+    retVal.concat('.');
+    retVal.concat(ext);
+
+    return retVal;
+}
+
 void createDirectoryFor(SDClass *sd, String filename)
 {
     auto slashIndex = filename.indexOf(HYDRO_FSPATH_SEPARATOR);
@@ -262,16 +283,9 @@ String timeSpanToString(const TimeSpan &span)
 
 extern String measurementToString(float value, Hydro_UnitsType units, unsigned int additionalDecPlaces)
 {
-    String retVal; retVal.reserve(15 + 1);
-    retVal.concat(roundToString(value, additionalDecPlaces));
-
-    String unitsSym = unitsTypeToSymbol(units, true); // also excludes dimensionless, e.g. pH
-    if (unitsSym.length()) {
-        retVal.concat(' ');
-        retVal.concat(unitsSym);
-    }
-
-    return retVal;
+    HydroFixedString<HYDRO_STRING_BUFFER_SIZE> retVal;
+    appendMeasurement(retVal, value, units, additionalDecPlaces);
+    return String(retVal.c_str());
 }
 
 template<>
@@ -1395,241 +1409,262 @@ String controlInputModeToString(Hydro_ControlInputMode controlInMode, bool exclu
     return !excludeSpecial ? SFP(HStr_Undefined) : String();
 }
 
-String actuatorTypeToString(Hydro_ActuatorType actuatorType, bool excludeSpecial)
+// Returns string of enum's string id, with special count/undefined strings left blank if excluded.
+static inline String enumStringIdToString(Hydro_String strNum, bool excludeSpecial)
+{
+    return !excludeSpecial || (strNum != HStr_Count && strNum != HStr_Undefined) ? SFP(strNum) : String();
+}
+
+Hydro_String actuatorTypeToStringId(Hydro_ActuatorType actuatorType)
 {
     switch (actuatorType) {
         case Hydro_ActuatorType_FanExhaust:
-            return SFP(HStr_Enum_FanExhaust);
+            return HStr_Enum_FanExhaust;
         case Hydro_ActuatorType_GrowLights:
-            return SFP(HStr_Enum_GrowLights);
+            return HStr_Enum_GrowLights;
         case Hydro_ActuatorType_PeristalticPump:
-            return SFP(HStr_Enum_PeristalticPump);
+            return HStr_Enum_PeristalticPump;
         case Hydro_ActuatorType_WaterAerator:
-            return SFP(HStr_Enum_WaterAerator);
+            return HStr_Enum_WaterAerator;
         case Hydro_ActuatorType_WaterHeater:
-            return SFP(HStr_Enum_WaterHeater);
+            return HStr_Enum_WaterHeater;
         case Hydro_ActuatorType_WaterPump:
-            return SFP(HStr_Enum_WaterPump);
+            return HStr_Enum_WaterPump;
         case Hydro_ActuatorType_WaterSprayer:
-            return SFP(HStr_Enum_WaterSprayer);
+            return HStr_Enum_WaterSprayer;
         case Hydro_ActuatorType_Count:
-            return !excludeSpecial ? SFP(HStr_Count) : String();
+            return HStr_Count;
         case Hydro_ActuatorType_Undefined:
             break;
     }
-    return !excludeSpecial ? SFP(HStr_Undefined) : String();
+    return HStr_Undefined;
 }
 
-String sensorTypeToString(Hydro_SensorType sensorType, bool excludeSpecial)
+String actuatorTypeToString(Hydro_ActuatorType actuatorType, bool excludeSpecial)
+{
+    return enumStringIdToString(actuatorTypeToStringId(actuatorType), excludeSpecial);
+}
+
+Hydro_String sensorTypeToStringId(Hydro_SensorType sensorType)
 {
     switch (sensorType) {
         case Hydro_SensorType_AirCarbonDioxide:
-            return SFP(HStr_Enum_AirCarbonDioxide);
+            return HStr_Enum_AirCarbonDioxide;
         case Hydro_SensorType_AirTempHumidity:
-            return SFP(HStr_Enum_AirTemperatureHumidity);
+            return HStr_Enum_AirTemperatureHumidity;
         case Hydro_SensorType_PotentialHydrogen:
-            return SFP(HStr_Enum_WaterPH);
+            return HStr_Enum_WaterPH;
         case Hydro_SensorType_PowerLevel:
-            return SFP(HStr_Enum_PowerLevel);
+            return HStr_Enum_PowerLevel;
         case Hydro_SensorType_PumpFlow:
-            return SFP(HStr_Enum_PumpFlow);
+            return HStr_Enum_PumpFlow;
         case Hydro_SensorType_SoilMoisture:
-            return SFP(HStr_Enum_SoilMoisture);
+            return HStr_Enum_SoilMoisture;
         case Hydro_SensorType_TotalDissolvedSolids:
-            return SFP(HStr_Enum_WaterTDS);
+            return HStr_Enum_WaterTDS;
         case Hydro_SensorType_WaterHeight:
-            return SFP(HStr_Enum_WaterHeight);
+            return HStr_Enum_WaterHeight;
         case Hydro_SensorType_WaterLevel:
-            return SFP(HStr_Enum_WaterLevel);
+            return HStr_Enum_WaterLevel;
         case Hydro_SensorType_WaterTemperature:
-            return SFP(HStr_Enum_WaterTemperature);
+            return HStr_Enum_WaterTemperature;
         case Hydro_SensorType_Count:
-            return !excludeSpecial ? SFP(HStr_Count) : String();
+            return HStr_Count;
         case Hydro_SensorType_Undefined:
             break;
     }
-    return !excludeSpecial ? SFP(HStr_Undefined) : String();
+    return HStr_Undefined;
 }
 
-String cropTypeToString(Hydro_CropType cropType, bool excludeSpecial)
+String sensorTypeToString(Hydro_SensorType sensorType, bool excludeSpecial)
+{
+    return enumStringIdToString(sensorTypeToStringId(sensorType), excludeSpecial);
+}
+
+Hydro_String cropTypeToStringId(Hydro_CropType cropType)
 {
     switch (cropType) {
         case Hydro_CropType_AloeVera:
-            return SFP(HStr_Enum_AloeVera);
+            return HStr_Enum_AloeVera;
         case Hydro_CropType_Anise:
-            return SFP(HStr_Enum_Anise);
+            return HStr_Enum_Anise;
         case Hydro_CropType_Artichoke:
-            return SFP(HStr_Enum_Artichoke);
+            return HStr_Enum_Artichoke;
         case Hydro_CropType_Arugula:
-            return SFP(HStr_Enum_Arugula);
+            return HStr_Enum_Arugula;
         case Hydro_CropType_Asparagus:
-            return SFP(HStr_Enum_Asparagus);
+            return HStr_Enum_Asparagus;
         case Hydro_CropType_Basil:
-            return SFP(HStr_Enum_Basil);
+            return HStr_Enum_Basil;
         case Hydro_CropType_Bean:
-            return SFP(HStr_Enum_Bean);
+            return HStr_Enum_Bean;
         case Hydro_CropType_BeanBroad:
-            return SFP(HStr_Enum_BeanBroad);
+            return HStr_Enum_BeanBroad;
         case Hydro_CropType_Beetroot:
-            return SFP(HStr_Enum_Beetroot);
+            return HStr_Enum_Beetroot;
         case Hydro_CropType_BlackCurrant:
-            return SFP(HStr_Enum_BlackCurrant);
+            return HStr_Enum_BlackCurrant;
         case Hydro_CropType_Blueberry:
-            return SFP(HStr_Enum_Blueberry);
+            return HStr_Enum_Blueberry;
         case Hydro_CropType_BokChoi:
-            return SFP(HStr_Enum_BokChoi);
+            return HStr_Enum_BokChoi;
         case Hydro_CropType_Broccoli:
-            return SFP(HStr_Enum_Broccoli);
+            return HStr_Enum_Broccoli;
         case Hydro_CropType_BrusselsSprout:
-            return SFP(HStr_Enum_BrusselsSprout);
+            return HStr_Enum_BrusselsSprout;
         case Hydro_CropType_Cabbage:
-            return SFP(HStr_Enum_Cabbage);
+            return HStr_Enum_Cabbage;
         case Hydro_CropType_Cannabis:
-            return SFP(HStr_Enum_Cannabis);
+            return HStr_Enum_Cannabis;
         case Hydro_CropType_Capsicum:
-            return SFP(HStr_Enum_Capsicum);
+            return HStr_Enum_Capsicum;
         case Hydro_CropType_Carrots:
-            return SFP(HStr_Enum_Carrots);
+            return HStr_Enum_Carrots;
         case Hydro_CropType_Catnip:
-            return SFP(HStr_Enum_Catnip);
+            return HStr_Enum_Catnip;
         case Hydro_CropType_Cauliflower:
-            return SFP(HStr_Enum_Cauliflower);
+            return HStr_Enum_Cauliflower;
         case Hydro_CropType_Celery:
-            return SFP(HStr_Enum_Celery);
+            return HStr_Enum_Celery;
         case Hydro_CropType_Chamomile:
-            return SFP(HStr_Enum_Chamomile);
+            return HStr_Enum_Chamomile;
         case Hydro_CropType_Chicory:
-            return SFP(HStr_Enum_Chicory);
+            return HStr_Enum_Chicory;
         case Hydro_CropType_Chives:
-            return SFP(HStr_Enum_Chives);
+            return HStr_Enum_Chives;
         case Hydro_CropType_Cilantro:
-            return SFP(HStr_Enum_Cilantro);
+            return HStr_Enum_Cilantro;
         case Hydro_CropType_Coriander:
-            return SFP(HStr_Enum_Coriander);
+            return HStr_Enum_Coriander;
         case Hydro_CropType_CornSweet:
-            return SFP(HStr_Enum_CornSweet);
+            return HStr_Enum_CornSweet;
         case Hydro_CropType_Cucumber:
-            return SFP(HStr_Enum_Cucumber);
+            return HStr_Enum_Cucumber;
         case Hydro_CropType_Dill:
-            return SFP(HStr_Enum_Dill);
+            return HStr_Enum_Dill;
         case Hydro_CropType_Eggplant:
-            return SFP(HStr_Enum_Eggplant);
+            return HStr_Enum_Eggplant;
         case Hydro_CropType_Endive:
-            return SFP(HStr_Enum_Endive);
+            return HStr_Enum_Endive;
         case Hydro_CropType_Fennel:
-            return SFP(HStr_Enum_Fennel);
+            return HStr_Enum_Fennel;
         case Hydro_CropType_Fodder:
-            return SFP(HStr_Enum_Fodder);
+            return HStr_Enum_Fodder;
         case Hydro_CropType_Flowers:
-            return SFP(HStr_Enum_Flowers);
+            return HStr_Enum_Flowers;
         case Hydro_CropType_Garlic:
-            return SFP(HStr_Enum_Garlic);
+            return HStr_Enum_Garlic;
         case Hydro_CropType_Ginger:
-            return SFP(HStr_Enum_Ginger);
+            return HStr_Enum_Ginger;
         case Hydro_CropType_Kale:
-            return SFP(HStr_Enum_Kale);
+            return HStr_Enum_Kale;
         case Hydro_CropType_Lavender:
-            return SFP(HStr_Enum_Lavender);
+            return HStr_Enum_Lavender;
         case Hydro_CropType_Leek:
-            return SFP(HStr_Enum_Leek);
+            return HStr_Enum_Leek;
         case Hydro_CropType_LemonBalm:
-            return SFP(HStr_Enum_LemonBalm);
+            return HStr_Enum_LemonBalm;
         case Hydro_CropType_Lettuce:
-            return SFP(HStr_Enum_Lettuce);
+            return HStr_Enum_Lettuce;
         case Hydro_CropType_Marrow:
-            return SFP(HStr_Enum_Marrow);
+            return HStr_Enum_Marrow;
         case Hydro_CropType_Melon:
-            return SFP(HStr_Enum_Melon);
+            return HStr_Enum_Melon;
         case Hydro_CropType_Mint:
-            return SFP(HStr_Enum_Mint);
+            return HStr_Enum_Mint;
         case Hydro_CropType_MustardCress:
-            return SFP(HStr_Enum_MustardCress);
+            return HStr_Enum_MustardCress;
         case Hydro_CropType_Okra:
-            return SFP(HStr_Enum_Okra);
+            return HStr_Enum_Okra;
         case Hydro_CropType_Onions:
-            return SFP(HStr_Enum_Onions);
+            return HStr_Enum_Onions;
         case Hydro_CropType_Oregano:
-            return SFP(HStr_Enum_Oregano);
+            return HStr_Enum_Oregano;
         case Hydro_CropType_PakChoi:
-            return SFP(HStr_Enum_PakChoi);
+            return HStr_Enum_PakChoi;
         case Hydro_CropType_Parsley:
-            return SFP(HStr_Enum_Parsley);
+            return HStr_Enum_Parsley;
         case Hydro_CropType_Parsnip:
-            return SFP(HStr_Enum_Parsnip);
+            return HStr_Enum_Parsnip;
         case Hydro_CropType_Pea:
-            return SFP(HStr_Enum_Pea);
+            return HStr_Enum_Pea;
         case Hydro_CropType_PeaSugar:
-            return SFP(HStr_Enum_PeaSugar);
+            return HStr_Enum_PeaSugar;
         case Hydro_CropType_Pepino:
-            return SFP(HStr_Enum_Pepino);
+            return HStr_Enum_Pepino;
         case Hydro_CropType_PeppersBell:
-            return SFP(HStr_Enum_PeppersBell);
+            return HStr_Enum_PeppersBell;
         case Hydro_CropType_PeppersHot:
-            return SFP(HStr_Enum_PeppersHot);
+            return HStr_Enum_PeppersHot;
         case Hydro_CropType_Potato:
-            return SFP(HStr_Enum_Potato);
+            return HStr_Enum_Potato;
         case Hydro_CropType_PotatoSweet:
-            return SFP(HStr_Enum_PotatoSweet);
+            return HStr_Enum_PotatoSweet;
         case Hydro_CropType_Pumpkin:
-            return SFP(HStr_Enum_Pumpkin);
+            return HStr_Enum_Pumpkin;
         case Hydro_CropType_Radish:
-            return SFP(HStr_Enum_Radish);
+            return HStr_Enum_Radish;
         case Hydro_CropType_Rhubarb:
-            return SFP(HStr_Enum_Rhubarb);
+            return HStr_Enum_Rhubarb;
         case Hydro_CropType_Rosemary:
-            return SFP(HStr_Enum_Rosemary);
+            return HStr_Enum_Rosemary;
         case Hydro_CropType_Sage:
-            return SFP(HStr_Enum_Sage);
+            return HStr_Enum_Sage;
         case Hydro_CropType_Silverbeet:
-            return SFP(HStr_Enum_Silverbeet);
+            return HStr_Enum_Silverbeet;
         case Hydro_CropType_Spinach:
-            return SFP(HStr_Enum_Spinach);
+            return HStr_Enum_Spinach;
         case Hydro_CropType_Squash:
-            return SFP(HStr_Enum_Squash);
+            return HStr_Enum_Squash;
         case Hydro_CropType_Sunflower:
-            return SFP(HStr_Enum_Sunflower);
+            return HStr_Enum_Sunflower;
         case Hydro_CropType_Strawberries:
-            return SFP(HStr_Enum_Strawberries);
+            return HStr_Enum_Strawberries;
         case Hydro_CropType_SwissChard:
-            return SFP(HStr_Enum_SwissChard);
+            return HStr_Enum_SwissChard;
         case Hydro_CropType_Taro:
-            return SFP(HStr_Enum_Taro);
+            return HStr_Enum_Taro;
         case Hydro_CropType_Tarragon:
-            return SFP(HStr_Enum_Tarragon);
+            return HStr_Enum_Tarragon;
         case Hydro_CropType_Thyme:
-            return SFP(HStr_Enum_Thyme);
+            return HStr_Enum_Thyme;
         case Hydro_CropType_Tomato:
-            return SFP(HStr_Enum_Tomato);
+            return HStr_Enum_Tomato;
         case Hydro_CropType_Turnip:
-            return SFP(HStr_Enum_Turnip);
+            return HStr_Enum_Turnip;
         case Hydro_CropType_Watercress:
-            return SFP(HStr_Enum_Watercress);
+            return HStr_Enum_Watercress;
         case Hydro_CropType_Watermelon:
-            return SFP(HStr_Enum_Watermelon);
+            return HStr_Enum_Watermelon;
         case Hydro_CropType_Zucchini:
-            return SFP(HStr_Enum_Zucchini);
+            return HStr_Enum_Zucchini;
         case Hydro_CropType_CustomCrop1:
-            return SFP(HStr_Enum_CustomCrop1);
+            return HStr_Enum_CustomCrop1;
         case Hydro_CropType_CustomCrop2:
-            return SFP(HStr_Enum_CustomCrop2);
+            return HStr_Enum_CustomCrop2;
         case Hydro_CropType_CustomCrop3:
-            return SFP(HStr_Enum_CustomCrop3);
+            return HStr_Enum_CustomCrop3;
         case Hydro_CropType_CustomCrop4:
-            return SFP(HStr_Enum_CustomCrop4);
+            return HStr_Enum_CustomCrop4;
         case Hydro_CropType_CustomCrop5:
-            return SFP(HStr_Enum_CustomCrop5);
+            return HStr_Enum_CustomCrop5;
         case Hydro_CropType_CustomCrop6:
-            return SFP(HStr_Enum_CustomCrop6);
+            return HStr_Enum_CustomCrop6;
         case Hydro_CropType_CustomCrop7:
-            return SFP(HStr_Enum_CustomCrop7);
+            return HStr_Enum_CustomCrop7;
         case Hydro_CropType_CustomCrop8:
-            return SFP(HStr_Enum_CustomCrop8);
+            return HStr_Enum_CustomCrop8;
         case Hydro_CropType_Count:
-            return !excludeSpecial ? SFP(HStr_Count) : String();
+            return HStr_Count;
         case Hydro_CropType_Undefined:
             break;
     }
-    return !excludeSpecial ? SFP(HStr_Undefined) : String();
+    return HStr_Undefined;
+}
+
+String cropTypeToString(Hydro_CropType cropType, bool excludeSpecial)
+{
+    return enumStringIdToString(cropTypeToStringId(cropType), excludeSpecial);
 }
 
 String substrateTypeToString(Hydro_SubstrateType substrateType, bool excludeSpecial)
@@ -1649,59 +1684,64 @@ String substrateTypeToString(Hydro_SubstrateType substrateType, bool excludeSpec
     return !excludeSpecial ? SFP(HStr_Undefined) : String();
 }
 
-String reservoirTypeToString(Hydro_ReservoirType reservoirType, bool excludeSpecial)
+Hydro_String reservoirTypeToStringId(Hydro_ReservoirType reservoirType)
 {
     switch (reservoirType) {
         case Hydro_ReservoirType_FeedWater:
-            return SFP(HStr_Enum_FeedWater);
+            return HStr_Enum_FeedWater;
         case Hydro_ReservoirType_DrainageWater:
-            return SFP(HStr_Enum_DrainageWater);
+            return HStr_Enum_DrainageWater;
         case Hydro_ReservoirType_NutrientPremix:
-            return SFP(HStr_Enum_NutrientPremix);
+            return HStr_Enum_NutrientPremix;
         case Hydro_ReservoirType_FreshWater:
-            return SFP(HStr_Enum_FreshWater);
+            return HStr_Enum_FreshWater;
         case Hydro_ReservoirType_PhUpSolution:
-            return SFP(HStr_Enum_PhUpSolution);
+            return HStr_Enum_PhUpSolution;
         case Hydro_ReservoirType_PhDownSolution:
-            return SFP(HStr_Enum_PhDownSolution);
+            return HStr_Enum_PhDownSolution;
         case Hydro_ReservoirType_CustomAdditive1:
-            return SFP(HStr_Enum_CustomAdditive1);
+            return HStr_Enum_CustomAdditive1;
         case Hydro_ReservoirType_CustomAdditive2:
-            return SFP(HStr_Enum_CustomAdditive2);
+            return HStr_Enum_CustomAdditive2;
         case Hydro_ReservoirType_CustomAdditive3:
-            return SFP(HStr_Enum_CustomAdditive3);
+            return HStr_Enum_CustomAdditive3;
         case Hydro_ReservoirType_CustomAdditive4:
-            return SFP(HStr_Enum_CustomAdditive4);
+            return HStr_Enum_CustomAdditive4;
         case Hydro_ReservoirType_CustomAdditive5:
-            return SFP(HStr_Enum_CustomAdditive5);
+            return HStr_Enum_CustomAdditive5;
         case Hydro_ReservoirType_CustomAdditive6:
-            return SFP(HStr_Enum_CustomAdditive6);
+            return HStr_Enum_CustomAdditive6;
         case Hydro_ReservoirType_CustomAdditive7:
-            return SFP(HStr_Enum_CustomAdditive7);
+            return HStr_Enum_CustomAdditive7;
         case Hydro_ReservoirType_CustomAdditive8:
-            return SFP(HStr_Enum_CustomAdditive8);
+            return HStr_Enum_CustomAdditive8;
         case Hydro_ReservoirType_CustomAdditive9:
-            return SFP(HStr_Enum_CustomAdditive9);
+            return HStr_Enum_CustomAdditive9;
         case Hydro_ReservoirType_CustomAdditive10:
-            return SFP(HStr_Enum_CustomAdditive10);
+            return HStr_Enum_CustomAdditive10;
         case Hydro_ReservoirType_CustomAdditive11:
-            return SFP(HStr_Enum_CustomAdditive11);
+            return HStr_Enum_CustomAdditive11;
         case Hydro_ReservoirType_CustomAdditive12:
-            return SFP(HStr_Enum_CustomAdditive12);
+            return HStr_Enum_CustomAdditive12;
         case Hydro_ReservoirType_CustomAdditive13:
-            return SFP(HStr_Enum_CustomAdditive13);
+            return HStr_Enum_CustomAdditive13;
         case Hydro_ReservoirType_CustomAdditive14:
-            return SFP(HStr_Enum_CustomAdditive14);
+            return HStr_Enum_CustomAdditive14;
         case Hydro_ReservoirType_CustomAdditive15:
-            return SFP(HStr_Enum_CustomAdditive15);
+            return HStr_Enum_CustomAdditive15;
         case Hydro_ReservoirType_CustomAdditive16:
-            return SFP(HStr_Enum_CustomAdditive16);
+            return HStr_Enum_CustomAdditive16;
         case Hydro_ReservoirType_Count:
-            return !excludeSpecial ? SFP(HStr_Count) : String();
+            return HStr_Count;
         case Hydro_ReservoirType_Undefined:
             break;
     }
-    return !excludeSpecial ? SFP(HStr_Undefined) : String();
+    return HStr_Undefined;
+}
+
+String reservoirTypeToString(Hydro_ReservoirType reservoirType, bool excludeSpecial)
+{
+    return enumStringIdToString(reservoirTypeToStringId(reservoirType), excludeSpecial);
 }
 
 float getRailVoltageFromType(Hydro_RailType railType)
@@ -1726,29 +1766,34 @@ float getRailVoltageFromType(Hydro_RailType railType)
     }
 }
 
-String railTypeToString(Hydro_RailType railType, bool excludeSpecial)
+Hydro_String railTypeToStringId(Hydro_RailType railType)
 {
     switch (railType) {
         case Hydro_RailType_AC110V:
-            return SFP(HStr_Enum_AC110V);
+            return HStr_Enum_AC110V;
         case Hydro_RailType_AC220V:
-            return SFP(HStr_Enum_AC220V);
+            return HStr_Enum_AC220V;
         case Hydro_RailType_DC3V3:
-            return SFP(HStr_Enum_DC3V3);
+            return HStr_Enum_DC3V3;
         case Hydro_RailType_DC5V:
-            return SFP(HStr_Enum_DC5V);
+            return HStr_Enum_DC5V;
         case Hydro_RailType_DC12V:
-            return SFP(HStr_Enum_DC12V);
+            return HStr_Enum_DC12V;
         case Hydro_RailType_DC24V:
-            return SFP(HStr_Enum_DC24V);
+            return HStr_Enum_DC24V;
         case Hydro_RailType_DC48V:
-            return SFP(HStr_Enum_DC48V);
+            return HStr_Enum_DC48V;
         case Hydro_RailType_Count:
-            return !excludeSpecial ? SFP(HStr_Count) : String();
+            return HStr_Count;
         case Hydro_RailType_Undefined:
             break;
     }
-    return !excludeSpecial ? SFP(HStr_Undefined) : String();
+    return HStr_Undefined;
+}
+
+String railTypeToString(Hydro_RailType railType, bool excludeSpecial)
+{
+    return enumStringIdToString(railTypeToStringId(railType), excludeSpecial);
 }
 
 String pinModeToString(Hydro_PinMode pinMode, bool excludeSpecial)
@@ -1807,121 +1852,47 @@ String enableModeToString(Hydro_EnableMode enableMode, bool excludeSpecial)
     return !excludeSpecial ? SFP(HStr_Undefined) : String();
 }
 
-String unitsCategoryToString(Hydro_UnitsCategory unitsCategory, bool excludeSpecial)
+Hydro_String unitsCategoryToStringId(Hydro_UnitsCategory unitsCategory)
 {
     switch (unitsCategory) {
         case Hydro_UnitsCategory_Alkalinity:
-            return SFP(HStr_Enum_Alkalinity);
+            return HStr_Enum_Alkalinity;
         case Hydro_UnitsCategory_Concentration:
-            return SFP(HStr_Enum_Concentration);
+            return HStr_Enum_Concentration;
         case Hydro_UnitsCategory_Distance:
-            return SFP(HStr_Enum_Distance);
+            return HStr_Enum_Distance;
         case Hydro_UnitsCategory_LiqDilution:
-            return SFP(HStr_Enum_LiqDilution);
+            return HStr_Enum_LiqDilution;
         case Hydro_UnitsCategory_LiqFlowRate:
-            return SFP(HStr_Enum_LiqFlowRate);
+            return HStr_Enum_LiqFlowRate;
         case Hydro_UnitsCategory_LiqVolume:
-            return SFP(HStr_Enum_LiqVolume);
+            return HStr_Enum_LiqVolume;
         case Hydro_UnitsCategory_Percentile:
-            return SFP(HStr_Enum_Percentile);
+            return HStr_Enum_Percentile;
         case Hydro_UnitsCategory_Power:
-            return SFP(HStr_Enum_Power);
+            return HStr_Enum_Power;
         case Hydro_UnitsCategory_Temperature:
-            return SFP(HStr_Enum_Temperature);
+            return HStr_Enum_Temperature;
         case Hydro_UnitsCategory_Weight:
-            return SFP(HStr_Enum_Weight);
+            return HStr_Enum_Weight;
         case Hydro_UnitsCategory_Count:
-            return !excludeSpecial ? SFP(HStr_Count) : String();
+            return HStr_Count;
         case Hydro_UnitsCategory_Undefined:
             break;
     }
-    return !excludeSpecial ? SFP(HStr_Undefined) : String();
+    return HStr_Undefined;
+}
+
+String unitsCategoryToString(Hydro_UnitsCategory unitsCategory, bool excludeSpecial)
+{
+    return enumStringIdToString(unitsCategoryToStringId(unitsCategory), excludeSpecial);
 }
 
 String unitsTypeToSymbol(Hydro_UnitsType unitsType, bool excludeSpecial)
 {
-    switch (unitsType) {
-        case Hydro_UnitsType_Raw_1:
-            return SFP(HStr_raw);
-        case Hydro_UnitsType_Percentile_100:
-            return String('%');
-        case Hydro_UnitsType_Alkalinity_pH_14:
-            return !excludeSpecial ? SFP(HStr_Unit_pH14) : String(); // technically unitless
-        case Hydro_UnitsType_Concentration_EC_5:
-            return SFP(HStr_Unit_EC5); // alt: mS/cm, TDS
-        case Hydro_UnitsType_Concentration_PPM_500:
-            return SFP(HStr_Unit_PPM500);
-        case Hydro_UnitsType_Concentration_PPM_640:
-            return SFP(HStr_Unit_PPM640);
-        case Hydro_UnitsType_Concentration_PPM_700:
-            return SFP(HStr_Unit_PPM700);
-        case Hydro_UnitsType_Distance_Feet:
-            return SFP(HStr_Unit_Feet);
-        case Hydro_UnitsType_Distance_Meters:
-            return String('m');
-        case Hydro_UnitsType_LiqDilution_MilliLiterPerGallon: {
-            String retVal(SFP(HStr_Unit_MilliLiterPer));
-            String concat(SFP(HStr_Unit_Gallons));
-            retVal.reserve(retVal.length() + concat.length() + 1);
-            retVal.concat(concat);
-            return retVal;
-        }
-        case Hydro_UnitsType_LiqDilution_MilliLiterPerLiter: {
-            String retVal(SFP(HStr_Unit_MilliLiterPer));
-            retVal.reserve(retVal.length() + 1 + 1);
-            retVal.concat('L');
-            return retVal;
-        }
-        case Hydro_UnitsType_LiqFlowRate_GallonsPerMin: {
-            String retVal(SFP(HStr_Unit_Gallons));
-            String concat(SFP(HStr_Unit_PerMinute));
-            retVal.reserve(retVal.length() + concat.length() + 1);
-            retVal.concat(concat);
-            return retVal;
-        }
-        case Hydro_UnitsType_LiqFlowRate_LitersPerMin: {
-            String retVal('L');
-            String concat(SFP(HStr_Unit_PerMinute));
-            retVal.reserve(retVal.length() + concat.length() + 1);
-            retVal.concat(concat);
-            return retVal;
-        }
-        case Hydro_UnitsType_LiqVolume_Gallons:
-            return SFP(HStr_Unit_Gallons);
-        case Hydro_UnitsType_LiqVolume_Liters:
-            return String('L');
-        case Hydro_UnitsType_Power_Amperage:
-            return String('A');
-        case Hydro_UnitsType_Power_Wattage:
-            return String('W'); // alt: J/s
-        case Hydro_UnitsType_Temperature_Celsius: {
-            String retVal(SFP(HStr_Unit_Degree));
-            retVal.reserve(retVal.length() + 1 + 1);
-            retVal.concat('C');
-            return retVal;
-        }
-        case Hydro_UnitsType_Temperature_Fahrenheit: {
-            String retVal(SFP(HStr_Unit_Degree));
-            retVal.reserve(retVal.length() + 1 + 1);
-            retVal.concat('F');
-            return retVal;
-        }
-        case Hydro_UnitsType_Temperature_Kelvin: {
-            String retVal(SFP(HStr_Unit_Degree));
-            retVal.reserve(retVal.length() + 1 + 1);
-            retVal.concat('K');
-            return retVal;
-        }
-        case Hydro_UnitsType_Weight_Kilograms:
-            return SFP(HStr_Unit_Kilograms);
-        case Hydro_UnitsType_Weight_Pounds:
-            return SFP(HStr_Unit_Pounds);
-        case Hydro_UnitsType_Count:
-            return !excludeSpecial ? SFP(HStr_Unit_Count) : String();
-        case Hydro_UnitsType_Undefined:
-            break;
-    }
-    return !excludeSpecial ? SFP(HStr_Unit_Undefined) : String();
+    HydroFixedString<HYDRO_STRING_BUFFER_SIZE> retVal;
+    appendUnitsTypeSymbol(retVal, unitsType, excludeSpecial);
+    return String(retVal.c_str());
 }
 
 String positionIndexToString(hposi_t positionIndex, bool excludeSpecial)
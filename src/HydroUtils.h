@@ -14,6 +14,7 @@ template<class ObjectType, typename ParameterType> class MethodSlotCallTask;
 
 #include "Hydruino.h"
 #include "HydroObject.h"
+#include "HydroCoreLogic.h"
 #ifdef HYDRO_USE_MULTITASKING
 #include "BasicInterruptAbstraction.h"
 #endif
@@ -76,9 +77,13 @@ template<class ObjectType> taskid_t scheduleObjectMethodCallWithTaskIdOnce(Share
 template<class ObjectType> taskid_t scheduleObjectMethodCallWithTaskIdOnce(ObjectType *object, void (ObjectType::*method)(taskid_t));
 
 
+// Stored parameter type, for holding a copy of reference-passed parameters until fired.
+template<typename T> struct HydroStoredParam { typedef T type; };
+template<typename T> struct HydroStoredParam<T &> { typedef T type; };
+
 // Signal Fire Task
 // This class holds onto the passed signal and parameter to pass it along to the signal's
-// fire method upon task execution.
+// fire method upon task execution. Reference parameters are held by copy until fired.
 template<typename ParameterType, int Slots>
 class SignalFireTask : public Executable {
 public:
@@ -91,7 +96,7 @@ public:
 private:
     SharedPtr<HydroObjInterface> _object;
     Signal<ParameterType, Slots> *_signal;
-    ParameterType _param;
+    typename HydroStoredParam<ParameterType>::type _param;
 };
 
 
@@ -166,9 +171,11 @@ inline void setUnixTime(time_t unixTime, bool isSigTime = false);
 inline void setLocalTime(DateTime localTime, bool isSigTime = false);
 
 // Returns a proper filename for a storage monitoring file (log, data, etc) that uses YYMMDD as filename.
-extern String getYYMMDDFilename(String prefix, String ext);
+extern String getYYMMDDFilename(const String &prefix, const String &ext);
 // Returns a proper filename for a storage library data file that uses ## as filename.
-extern String getNNFilename(String prefix, unsigned int value, String ext);
+extern String getNNFilename(const String &prefix, unsigned int value, const String &ext);
+// Returns filename with its extension replaced (or added), for files kept alongside it (e.g. config file's .tmp/.bak copies).
+extern String getSiblingFilename(const String &filename, const String &ext);
 
 // Creates intermediate folders given a filename. Currently only supports a single folder depth.
 extern void createDirectoryFor(SDClass *sd, String filename);
@@ -188,6 +195,10 @@ extern String timeSpanToString(const TimeSpan &span);
 extern String measurementToString(float value, Hydro_UnitsType units, unsigned int additionalDecPlaces = 0);
 // Returns a string formatted to value and unit for dealing with measurements.
 inline String measurementToString(const HydroSingleMeasurement &measurement, unsigned int additionalDecPlaces = 0) { return measurementToString(measurement.value, measurement.units, additionalDecPlaces); }
+// Appends value and unit (as measurementToString formats them) to fixed string without heap use.
+template<size_t N> void appendMeasurement(HydroFixedString<N> &out, float value, Hydro_UnitsType units, unsigned int additionalDecPlaces = 0);
+// Appends string from string number to fixed string, straight from PROGMEM (Flash) without heap use when built-in.
+template<size_t N> void appendStringFromPGM(HydroFixedString<N> &out, Hydro_String strNum);
 
 // Encodes a T-typed array to a comma-separated string.
 // Null array or invalid length will abort function before encoding occurs, returning "null".
@@ -377,16 +388,22 @@ inline bool getActuatorIsSerialFromMode(Hydro_EnableMode enableMode) { return en
 
 // Converts from actuator type enum to string, with optional exclude for special types (instead returning "").
 extern String actuatorTypeToString(Hydro_ActuatorType actuatorType, bool excludeSpecial = false);
+// Converts from actuator type enum to string table id (HStr_Count/HStr_Undefined for special types).
+extern Hydro_String actuatorTypeToStringId(Hydro_ActuatorType actuatorType);
 // Converts back to actuator type enum from string.
 extern Hydro_ActuatorType actuatorTypeFromString(String actuatorTypeStr);
 
 // Converts from sensor type enum to string, with optional exclude for special types (instead returning "").
 extern String sensorTypeToString(Hydro_SensorType sensorType, bool excludeSpecial = false);
+// Converts from sensor type enum to string table id (HStr_Count/HStr_Undefined for special types).
+extern Hydro_String sensorTypeToStringId(Hydro_SensorType sensorType);
 // Converts back to sensor type enum from string.
 extern Hydro_SensorType sensorTypeFromString(String sensorTypeStr);
 
 // Converts from crop type enum to string, with optional exclude for special types (instead returning "").
 extern String cropTypeToString(Hydro_CropType cropType, bool excludeSpecial = false);
+// Converts from crop type enum to string table id (HStr_Count/HStr_Undefined for special types).
+extern Hydro_String cropTypeToStringId(Hydro_CropType cropType);
 // Converts back to crop type enum from string.
 extern Hydro_CropType cropTypeFromString(String cropTypeStr);
 
@@ -397,6 +414,8 @@ extern Hydro_SubstrateType substrateTypeFromString(String substrateTypeStr);
 
 // Converts from fluid reservoir enum to string, with optional exclude for special types (instead returning "").
 extern String reservoirTypeToString(Hydro_ReservoirType reservoirType, bool excludeSpecial = false);
+// Converts from fluid reservoir enum to string table id (HStr_Count/HStr_Undefined for special types).
+extern Hydro_String reservoirTypeToStringId(Hydro_ReservoirType reservoirType);
 // Converts back to fluid reservoir enum from string.
 extern Hydro_ReservoirType reservoirTypeFromString(String reservoirTypeStr);
 
@@ -405,6 +424,8 @@ extern float getRailVoltageFromType(Hydro_RailType railType);
 
 // Converts from power rail enum to string, with optional exclude for special types (instead returning "").
 extern String railTypeToString(Hydro_RailType railType, bool excludeSpecial = false);
+// Converts from power rail enum to string table id (HStr_Count/HStr_Undefined for special types).
+extern Hydro_String railTypeToStringId(Hydro_RailType railType);
 // Converts back to power rail enum from string.
 extern Hydro_RailType railTypeFromString(String railTypeStr);
 
@@ -420,11 +441,15 @@ extern Hydro_EnableMode enableModeFromString(String enableModeStr);
 
 // Converts from units category enum to string, with optional exclude for special types (instead returning "").
 extern String unitsCategoryToString(Hydro_UnitsCategory unitsCategory, bool excludeSpecial = false);
+// Converts from units category enum to string table id (HStr_Count/HStr_Undefined for special types).
+extern Hydro_String unitsCategoryToStringId(Hydro_UnitsCategory unitsCategory);
 // Converts back to units category enum from string.
 extern Hydro_UnitsCategory unitsCategoryFromString(String unitsCategoryStr);
 
 // Converts from units type enum to symbol string, with optional exclude for special types (instead returning "").
 extern String unitsTypeToSymbol(Hydro_UnitsType unitsType, bool excludeSpecial = false);
+// Appends units type symbol to fixed string without heap use, with optional exclude for special types (instead appending nothing).
+template<size_t N> void appendUnitsTypeSymbol(HydroFixedString<N> &out, Hydro_UnitsType unitsType, bool excludeSpecial = false);
 // Converts back to units type enum from symbol.
 extern Hydro_UnitsType unitsTypeFromSymbol(String unitsSymbolStr);
 
@@ -170,6 +170,117 @@ inline bool convertUnits(const HydroSingleMeasurement *measureIn, HydroSingleMea
 }
 
 
+template<size_t N>
+void appendStringFromPGM(HydroFixedString<N> &out, Hydro_String strNum)
+{
+    #ifndef HYDRO_DISABLE_BUILTIN_DATA
+        const char *flashStr = CFP(strNum);
+        if (flashStr) {
+            for (char ch = pgm_read_byte(flashStr); ch; ch = pgm_read_byte(++flashStr)) { out.append(ch); }
+        }
+    #else
+        out.append(SFP(strNum).c_str());
+    #endif
+}
+
+template<size_t N>
+void appendMeasurement(HydroFixedString<N> &out, float value, Hydro_UnitsType units, unsigned int additionalDecPlaces)
+{
+    out.appendFloat(roundToDecimalPlaces(value, defaultDecimalPlaces() + additionalDecPlaces), defaultDecimalPlaces() + additionalDecPlaces);
+
+    size_t length = out.length();
+    out.append(' ');
+    appendUnitsTypeSymbol(out, units, true); // also excludes dimensionless, e.g. pH
+    if (out.length() == length + 1) { out.truncate(length); }
+}
+
+template<size_t N>
+void appendUnitsTypeSymbol(HydroFixedString<N> &out, Hydro_UnitsType unitsType, bool excludeSpecial)
+{
+    switch (unitsType) {
+        case Hydro_UnitsType_Raw_1:
+            appendStringFromPGM(out, HStr_raw);
+            break;
+        case Hydro_UnitsType_Percentile_100:
+            out.append('%');
+            break;
+        case Hydro_UnitsType_Alkalinity_pH_14:
+            if (!excludeSpecial) { appendStringFromPGM(out, HStr_Unit_pH14); } // technically unitless
+            break;
+        case Hydro_UnitsType_Concentration_EC_5:
+            appendStringFromPGM(out, HStr_Unit_EC5); // alt: mS/cm, TDS
+            break;
+        case Hydro_UnitsType_Concentration_PPM_500:
+            appendStringFromPGM(out, HStr_Unit_PPM500);
+            break;
+        case Hydro_UnitsType_Concentration_PPM_640:
+            appendStringFromPGM(out, HStr_Unit_PPM640);
+            break;
+        case Hydro_UnitsType_Concentration_PPM_700:
+            appendStringFromPGM(out, HStr_Unit_PPM700);
+            break;
+        case Hydro_UnitsType_Distance_Feet:
+            appendStringFromPGM(out, HStr_Unit_Feet);
+            break;
+        case Hydro_UnitsType_Distance_Meters:
+            out.append('m');
+            break;
+        case Hydro_UnitsType_LiqDilution_MilliLiterPerGallon:
+            appendStringFromPGM(out, HStr_Unit_MilliLiterPer);
+            appendStringFromPGM(out, HStr_Unit_Gallons);
+            break;
+        case Hydro_UnitsType_LiqDilution_MilliLiterPerLiter:
+            appendStringFromPGM(out, HStr_Unit_MilliLiterPer);
+            out.append('L');
+            break;
+        case Hydro_UnitsType_LiqFlowRate_GallonsPerMin:
+            appendStringFromPGM(out, HStr_Unit_Gallons);
+            appendStringFromPGM(out, HStr_Unit_PerMinute);
+            break;
+        case Hydro_UnitsType_LiqFlowRate_LitersPerMin:
+            out.append('L');
+            appendStringFromPGM(out, HStr_Unit_PerMinute);
+            break;
+        case Hydro_UnitsType_LiqVolume_Gallons:
+            appendStringFromPGM(out, HStr_Unit_Gallons);
+            break;
+        case Hydro_UnitsType_LiqVolume_Liters:
+            out.append('L');
+            break;
+        case Hydro_UnitsType_Power_Amperage:
+            out.append('A');
+            break;
+        case Hydro_UnitsType_Power_Wattage:
+            out.append('W'); // alt: J/s
+            break;
+        case Hydro_UnitsType_Temperature_Celsius:
+            appendStringFromPGM(out, HStr_Unit_Degree);
+            out.append('C');
+            break;
+        case Hydro_UnitsType_Temperature_Fahrenheit:
+            appendStringFromPGM(out, HStr_Unit_Degree);
+            out.append('F');
+            break;
+        case Hydro_UnitsType_Temperature_Kelvin:
+            appendStringFromPGM(out, HStr_Unit_Degree);
+            out.append('K');
+            break;
+        case Hydro_UnitsType_Weight_Kilograms:
+            appendStringFromPGM(out, HStr_Unit_Kilograms);
+            break;
+        case Hydro_UnitsType_Weight_Pounds:
+            appendStringFromPGM(out, HStr_Unit_Pounds);
+            break;
+        case Hydro_UnitsType_Count:
+            if (!excludeSpecial) { appendStringFromPGM(out, HStr_Unit_Count); }
+            break;
+        default:
+            if (!excludeSpecial) { appendStringFromPGM(out, HStr_Unit_Undefined); }
+            break;
+    }
+}
+
+
 template<size_t N = HYDRO_DEFAULT_MAXSIZE>
 Vector<HydroObject *, N> linksFilterActuators(Pair<uint8_t, Pair<HydroObject *, int8_t> *> links)
 {
@@ -60,7 +60,7 @@ Hydruino::Hydruino(pintype_t piezoBuzzerPin,
     : _piezoBuzzerPin(piezoBuzzerPin),
       _eepromType(eepromType), _eepromSetup(eepromSetup), _eeprom(nullptr), _eepromBegan(false),
       _rtcType(rtcType), _rtcSetup(rtcSetup), _rtc(nullptr), _rtcBegan(false), _rtcBattFail(false),
-      _sdSetup(sdSetup), _sd(nullptr), _sdBegan(false), _sdOut(0),
+      _sdSetup(sdSetup), _sd(nullptr), _sdBegan(false), _sdOut(0), _sdLastUse(0),
 #ifdef HYDRO_USE_NET
       _netSetup(netSetup), _netBegan(false),
 #endif
@@ -82,6 +82,7 @@ Hydruino::Hydruino(pintype_t piezoBuzzerPin,
 Hydruino::~Hydruino()
 {
     suspend();
+    _autosaveQueue.end();
 #ifdef HYDRO_USE_GUI
     if (_activeUIInstance) { delete _activeUIInstance; _activeUIInstance = nullptr; }
     if (_uiData) { delete _uiData; _uiData = nullptr; }
@@ -95,6 +96,9 @@ Hydruino::~Hydruino()
 #endif
     deallocateEEPROM();
     deallocateRTC();
+    for (int slot = 0; slot < HYDRO_SYS_SDSESSION_FILES; ++slot) {
+        if (_sdFiles.isOpen(slot)) { dropSDFile(slot); }
+    }
     deallocateSD();
 #ifdef HYDRO_USE_GPS
     deallocateGPS();
@@ -255,6 +259,15 @@ bool Hydruino::initFromEEPROM(bool jsonFormat)
         commonPreInit();
 
         if (getEEPROM() && _eepromBegan && _sysDataAddress != -1) {
+            HydroEEPROMGenerations<I2C_eeprom> generations(getEEPROM(), _sysDataAddress, getEEPROMSize() - _sysDataAddress, HYDRO_SYS_EEPROM_GENERATIONS);
+            HydroGenerationHeader header;
+            int slot = generations.findNewest(&header);
+            if (slot != -1) {
+                HydroEEPROMStream eepromStream(generations.getNewestPayloadAddress(slot), header.length);
+                return jsonFormat ? initFromJSONStream(&eepromStream) : initFromBinaryStream(&eepromStream);
+            }
+
+            // Falls back to legacy unversioned layout, kept until generations rotate back around to slot 0
             HydroEEPROMStream eepromStream(_sysDataAddress, getEEPROMSize() - _sysDataAddress);
             return jsonFormat ? initFromJSONStream(&eepromStream) : initFromBinaryStream(&eepromStream);
         }
@@ -266,11 +279,29 @@ bool Hydruino::initFromEEPROM(bool jsonFormat)
 bool Hydruino::saveToEEPROM(bool jsonFormat)
 {
     HYDRO_HARD_ASSERT(_systemData, SFP(HStr_Err_NotYetInitialized));
+    _autosaveQueue.end(); // superseded, unfinished autosave left uncommitted
 
     if (_systemData) {
         if (getEEPROM() && _eepromBegan && _sysDataAddress != -1) {
-            HydroEEPROMStream eepromStream(_sysDataAddress, getEEPROMSize() - _sysDataAddress);
-            return jsonFormat ? saveToJSONStream(&eepromStream) : saveToBinaryStream(&eepromStream);
+            // Payload goes into the slot after newest, and only once fully written is its header
+            // committed, so an interrupted save leaves the previous generation as the newest valid one
+            HydroEEPROMGenerations<I2C_eeprom> generations(getEEPROM(), _sysDataAddress, getEEPROMSize() - _sysDataAddress, HYDRO_SYS_EEPROM_GENERATIONS);
+            do {
+                uint32_t sequence;
+                int slot = generations.nextSlot(&sequence);
+                uint16_t payloadAddress = generations.getPayloadAddress(slot);
+                uint16_t length = 0;
+                {   HydroEEPROMStream eepromStream(payloadAddress, generations.getPayloadCapacity());
+                    bool retVal = jsonFormat ? saveToJSONStream(&eepromStream) : saveToBinaryStream(&eepromStream);
+                    eepromStream.flush();
+                    if (!retVal || eepromStream.getWriteError()) {
+                        if (eepromStream.isWriteFull()) { continue; } // overflowed slot, retried in fewer/larger slots
+                        return false;
+                    }
+                    length = eepromStream.getWriteAddress() - payloadAddress;
+                }
+                return generations.commit(slot, sequence, length);
+            } while (fallBackEEPROMGenerations(generations));
         }
     }
 
@@ -287,12 +318,22 @@ bool Hydruino::initFromSDCard(bool jsonFormat)
 
         if (sd) {
             bool retVal = false;
-            auto configFile = sd->open(_sysConfigFilename.c_str(), FILE_READ);
 
-            if (configFile) {
-                retVal = jsonFormat ? initFromJSONStream(&configFile) : initFromBinaryStream(&configFile);
+            // Falls back to autosave's staged (.tmp) then backup (.bak) copies, in case config file
+            // was left missing or partially written by an interrupted autosave replacing it
+            for (int fileIndex = 0; !retVal && fileIndex < 3; ++fileIndex) {
+                String configFilename = fileIndex == 0 ? _sysConfigFilename : getSiblingFilename(_sysConfigFilename, SFP(fileIndex == 1 ? HStr_tmp : HStr_bak));
+                auto configFile = sd->open(configFilename.c_str(), FILE_READ);
 
-                configFile.close();
+                if (configFile) {
+                    retVal = jsonFormat ? initFromJSONStream(&configFile) : initFromBinaryStream(&configFile);
+
+                    configFile.close();
+
+                    if (retVal && fileIndex) {
+                        logger.logWarning(logArg(HStr_Log_ConfigFileFallback), logArg(configFilename.c_str()));
+                    }
+                }
             }
 
             endSDCard(sd);
@@ -306,13 +347,18 @@ bool Hydruino::initFromSDCard(bool jsonFormat)
 bool Hydruino::saveToSDCard(bool jsonFormat)
 {
     HYDRO_HARD_ASSERT(_systemData, SFP(HStr_Err_NotYetInitialized));
+    _autosaveQueue.end(); // superseded, unfinished autosave's staged file discarded
 
-    if (!_systemData) {
+    if (_systemData) {
+        closeSDFile(_sysConfigFilename.c_str());
         auto sd = getSDCard();
 
         if (sd) {
             bool retVal = false;
-            auto configFile = sd->open(_sysConfigFilename.c_str(), FILE_READ);
+            if (sd->exists(_sysConfigFilename.c_str())) {
+                sd->remove(_sysConfigFilename.c_str());
+            }
+            auto configFile = sd->open(_sysConfigFilename.c_str(), FILE_WRITE);
 
             if (configFile) {
                 retVal = jsonFormat ? saveToJSONStream(&configFile, false) : saveToBinaryStream(&configFile);
@@ -354,6 +400,7 @@ bool Hydruino::initFromWiFiStorage(bool jsonFormat)
 bool Hydruino::saveToWiFiStorage(bool jsonFormat)
 {
     HYDRO_HARD_ASSERT(_systemData, SFP(HStr_Err_NotYetInitialized));
+    _autosaveQueue.end(); // superseded, unfinished autosave's staged file discarded
 
     if (_systemData) {
         if (WiFiStorage.exists(_sysConfigFilename.c_str())) {
@@ -363,10 +410,11 @@ bool Hydruino::saveToWiFiStorage(bool jsonFormat)
 
         if (configFile) {
             auto configFileStream = HydroWiFiStorageFileStream(configFile);
-            return jsonFormat ? saveToJSONStream(&configFileStream, false) : saveToBinaryStream(&configFileStream);
+            bool retVal = jsonFormat ? saveToJSONStream(&configFileStream, false) : saveToBinaryStream(&configFileStream);
 
             configFileStream.flush();
             configFile.close();
+            return retVal;
         }
     }
 
@@ -414,6 +462,11 @@ bool Hydruino::initFromJSONStream(Stream *streamIn)
                     } else if (data->isUIData()) {
                         if (_uiData) { delete _uiData; }
                         _uiData = (HydroUIData *)data; data = nullptr;
+                    } else if (data->isJournalData()) {
+                        auto iter = _objects.find(stringHash(((HydroActivationJournalData *)data)->ownerName));
+                        if (iter != _objects.end() && iter->second->isActuatorType()) {
+                            static_pointer_cast<HydroActuator>(iter->second)->setActivationJournal(((HydroActivationJournalData *)data)->journal);
+                        }
                     }
                     if (data) { delete data; data = nullptr; }
                 } else if (data && data->isObjectData()) {
@@ -538,6 +591,27 @@ bool Hydruino::saveToJSONStream(Stream *streamOut, bool compact)
                     return false;
                 }
             }
+
+            // Activation journals are saved after objects so that they load onto existing actuators
+            for (auto iter = _objects.begin(); iter != _objects.end(); ++iter) {
+                if (iter->second->isActuatorType()) {
+                    auto actuator = static_pointer_cast<HydroActuator>(iter->second);
+
+                    if (actuator->getActivationJournal().lastTime) {
+                        StaticJsonDocument<HYDRO_JSON_DOC_DEFSIZE> doc;
+                        HydroActivationJournalData journalData(actuator->getId());
+                        journalData.journal = actuator->getActivationJournal();
+
+                        JsonObject journalDataObj = doc.to<JsonObject>();
+                        journalData.toJSONObject(journalDataObj);
+
+                        if (!(compact ? serializeJson(doc, *streamOut) : serializeJsonPretty(doc, *streamOut))) {
+                            HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_ExportFailure));
+                            return false;
+                        }
+                    }
+                }
+            }
         }
 
         commonPostSave();
@@ -580,6 +654,11 @@ bool Hydruino::initFromBinaryStream(Stream *streamIn)
                     } else if (data->isUIData()) {
                         if (_uiData) { delete _uiData; }
                         _uiData = (HydroUIData *)data; data = nullptr;
+                    } else if (data->isJournalData()) {
+                        auto iter = _objects.find(stringHash(((HydroActivationJournalData *)data)->ownerName));
+                        if (iter != _objects.end() && iter->second->isActuatorType()) {
+                            static_pointer_cast<HydroActuator>(iter->second)->setActivationJournal(((HydroActivationJournalData *)data)->journal);
+                        }
                     }
                     if (data) { delete data; data = nullptr; }
                 } else if (data && data->isObjectData()) {
@@ -680,6 +759,22 @@ bool Hydruino::saveToBinaryStream(Stream *streamOut)
                     return false;
                 }
             }
+
+            // Activation journals are saved after objects so that they load onto existing actuators
+            for (auto iter = _objects.begin(); iter != _objects.end(); ++iter) {
+                if (iter->second->isActuatorType()) {
+                    auto actuator = static_pointer_cast<HydroActuator>(iter->second);
+
+                    if (actuator->getActivationJournal().lastTime) {
+                        HydroActivationJournalData journalData(actuator->getId());
+                        journalData.journal = actuator->getActivationJournal();
+                        size_t bytesWritten = serializeDataToBinaryStream(&journalData, streamOut);
+
+                        HYDRO_SOFT_ASSERT(bytesWritten, SFP(HStr_Err_ExportFailure));
+                        if (!bytesWritten) { return false; }
+                    }
+                }
+            }
         }
 
         commonPostSave();
@@ -896,11 +991,87 @@ void Hydruino::commonPostSave()
     }
 }
 
+bool Hydruino::fallBackEEPROMGenerations(HydroEEPROMGenerations<I2C_eeprom> &generations)
+{
+    if (generations.fallBack()) {
+        logger.logWarning(logArg(HStr_Log_EEPROMSlotsReduced), logArg(generations.getSlotCount(), 0));
+        return true;
+    }
+    return false;
+}
+
+HydroData **Hydruino::newSaveSnapshot(uint16_t &countOut)
+{
+    HYDRO_HARD_ASSERT(_systemData, SFP(HStr_Err_NotYetInitialized));
+    countOut = 0;
+    if (!_systemData) { return nullptr; }
+
+    // Same record order as saveToBinaryStream, with object count doubled for activation journals
+    HydroData **records = new HydroData*[2 + _calibrationData.size() + hydroCropsLib._cropsData.size() + _additives.size() + _objects.size() * 2];
+    HYDRO_SOFT_ASSERT(records, SFP(HStr_Err_AllocationFailure));
+    if (!records) { return nullptr; }
+
+    records[countOut++] = newDataCopy(_systemData);
+
+    for (auto iter = _calibrationData.begin(); iter != _calibrationData.end(); ++iter) {
+        records[countOut++] = newDataCopy(iter->second);
+    }
+
+    for (auto iter = hydroCropsLib._cropsData.begin(); iter != hydroCropsLib._cropsData.end(); ++iter) {
+        if (iter->second->userSet) {
+            records[countOut++] = newDataCopy(&(iter->second->data));
+        }
+    }
+
+    for (auto iter = _additives.begin(); iter != _additives.end(); ++iter) {
+        records[countOut++] = newDataCopy(iter->second);
+    }
+
+    #ifdef HYDRO_USE_GUI
+        if (_uiData) {
+            records[countOut++] = newDataCopy(_uiData);
+        }
+    #endif
+
+    for (auto iter = _objects.begin(); iter != _objects.end(); ++iter) {
+        records[countOut++] = iter->second->newSaveData();
+    }
+
+    for (auto iter = _objects.begin(); iter != _objects.end(); ++iter) {
+        if (iter->second->isActuatorType()) {
+            auto actuator = static_pointer_cast<HydroActuator>(iter->second);
+
+            if (actuator->getActivationJournal().lastTime) {
+                auto journalData = new HydroActivationJournalData(actuator->getId());
+                if (journalData) { journalData->journal = actuator->getActivationJournal(); }
+                records[countOut++] = journalData;
+            }
+        }
+    }
+
+    for (uint16_t recordIndex = 0; recordIndex < countOut; ++recordIndex) {
+        if (!records[recordIndex]) {
+            HYDRO_SOFT_ASSERT(false, SFP(HStr_Err_AllocationFailure));
+            for (recordIndex = 0; recordIndex < countOut; ++recordIndex) {
+                if (records[recordIndex]) { delete records[recordIndex]; }
+            }
+            delete [] records;
+            countOut = 0;
+            return nullptr;
+        }
+    }
+
+    return records;
+}
+
 // Runloops
 
 // Tight updates (buzzer/etc) that need to be ran often
 inline void tightUpdates()
 {
+    #ifndef HYDRO_USE_MULTITASKING
+        activationTimers.update(); // otherwise ran from its own one-shot task
+    #endif
     // TODO: put in link to buzzer update here. #5 in Hydruino.
 }
 
@@ -911,7 +1082,7 @@ inline void looseUpdates()
         if (Hydruino::_activeInstance->_gps) { while(Hydruino::_activeInstance->_gps->available()) { Hydruino::_activeInstance->_gps->read(); } }
     #endif
     #ifdef HYDRO_USE_MQTT
-        if (publisher._mqttClient) { publisher._mqttClient->loop(); }
+        if (Hydruino::_activeInstance->publisher.getMQTTSink()) { Hydruino::_activeInstance->publisher.getMQTTSink()->getClient().loop(); }
     #endif
 }
 
@@ -1003,8 +1174,20 @@ void miscLoop()
 
         yieldIfNeeded(lastYield);
 
+        Hydruino::_activeInstance->updateSDSession();
+
+        yieldIfNeeded(lastYield);
+
         Hydruino::_activeInstance->checkAutosave();
 
+        // Autosave snapshot is written a record at a time, giving control back once past time budget
+        {   millis_t saveStart = millis();
+            while (Hydruino::_activeInstance->_autosaveQueue.writeNext()) {
+                yieldIfNeeded(lastYield);
+                if (millis() - saveStart >= HYDRO_SYS_AUTOSAVE_WRITEMILLIS) { break; }
+            }
+        }
+
         yieldIfNeeded(lastYield);
 
         Hydruino::_activeInstance->publisher.update();
@@ -1110,6 +1293,7 @@ void Hydruino::setTimeZoneOffset(int8_t hoursOffset, int8_t minsOffset)
     if (_systemData && _systemData->timeZoneOffset != timeZoneOffset) {
         _systemData->timeZoneOffset = timeZoneOffset;
 
+        scheduler.setNeedsTimeKeeping();
         setNeedsRedraw();
         _systemData->bumpRevisionIfNeeded();
     }
@@ -1290,7 +1474,7 @@ HydroRTCInterface *Hydruino::getRTC(bool begin)
             bool rtcBattFailBefore = _rtcBattFail;
             _rtcBattFail = _rtc->lostPower();
             if (_rtcBattFail && !rtcBattFailBefore) {
-                logger.logWarning(SFP(HStr_Log_RTCBatteryFailure));
+                logger.logWarning(logArg(HStr_Log_RTCBatteryFailure));
             }
         } else { deallocateRTC(); }
     }
@@ -1323,11 +1507,102 @@ SDClass *Hydruino::getSDCard(bool begin)
 
 void Hydruino::endSDCard(SDClass *sd)
 {
-    #if defined(CORE_TEENSY)
-        --_sdOut; // no delayed write on teensy's SD impl
-    #else
-        if (--_sdOut == 0 && _sd) {
+    --_sdOut; // card ended by updateSDSession once idle
+    _sdLastUse = millis();
+}
+
+// Pooled write handles are reopened after going idle, so they must append rather than truncate
+#ifdef FILE_APPEND // FILE_WRITE truncates on these cores
+#define HYDRO_SDFILE_WRITEMODE FILE_APPEND
+#else
+#define HYDRO_SDFILE_WRITEMODE FILE_WRITE
+#endif
+
+File *Hydruino::getSDFile(const char *filename, bool forWrite)
+{
+    uint32_t now = millis();
+    int slot = _sdFiles.acquire(filename, forWrite, now);
+
+    if (slot != -1) {
+        if (!forWrite) { _sdFiles[slot].seek(0); }
+        return &_sdFiles[slot];
+    }
+
+    bool evict = false;
+    slot = _sdFiles.claim(filename, forWrite, now, &evict);
+
+    if (slot != -1) {
+        if (evict) { _sdFiles[slot].close(); } // evicted handle's card instance carries over
+        auto sd = evict ? _sd : getSDCard();
+
+        if (sd) {
+            if (forWrite) { createDirectoryFor(sd, filename); }
+            _sdFiles[slot] = sd->open(filename, forWrite ? HYDRO_SDFILE_WRITEMODE : FILE_READ);
+
+            if (_sdFiles[slot]) {
+                return &_sdFiles[slot];
+            }
+
+            endSDCard(sd);
+        }
+
+        _sdFiles.drop(slot);
+    }
+
+    return nullptr;
+}
+
+void Hydruino::endSDFile(File *file)
+{
+    int slot = _sdFiles.indexOf(file);
+    HYDRO_SOFT_ASSERT(slot != -1, SFP(HStr_Err_InvalidParameter));
+
+    if (slot != -1) {
+        #if !HYDRO_SYS_LEAVE_FILES_OPEN
+            if (_sdFiles.isWrite(slot)) { file->flush(); }
+        #endif
+        _sdFiles.release(slot, millis());
+    }
+}
+
+bool Hydruino::closeSDFile(const char *filename)
+{
+    int slot;
+    while ((slot = _sdFiles.find(filename)) != -1) {
+        if (_sdFiles.getRefCount(slot)) { return false; }
+        dropSDFile(slot);
+    }
+    return true;
+}
+
+void Hydruino::flushSDFiles()
+{
+    for (int slot = 0; slot < HYDRO_SYS_SDSESSION_FILES; ++slot) {
+        if (_sdFiles.isWrite(slot)) { _sdFiles[slot].flush(); }
+    }
+}
+
+void Hydruino::dropSDFile(int slot)
+{
+    if (_sdFiles.isWrite(slot)) { _sdFiles[slot].flush(); }
+    _sdFiles[slot].close();
+    _sdFiles.drop(slot);
+    endSDCard(_sd);
+}
+
+void Hydruino::updateSDSession()
+{
+    uint32_t now = millis();
+    int slot;
+
+    while ((slot = _sdFiles.nextExpired(now, HYDRO_SYS_SDSESSION_IDLEMILLIS)) != -1) {
+        dropSDFile(slot);
+    }
+
+    #if !defined(CORE_TEENSY) // no delayed write on teensy's SD impl
+        if (_sd && _sdBegan && _sdOut <= 0 && hydroHasElapsed(now, _sdLastUse, HYDRO_SYS_SDSESSION_IDLEMILLIS)) {
             _sd->end();
+            _sdBegan = false;
         }
     #endif
 }
@@ -1548,7 +1823,7 @@ void Hydruino::checkFreeSpace()
 
 void Hydruino::checkAutosave()
 {
-    if (isAutosaveEnabled() && unixNow() >= _lastAutosave + (_systemData->autosaveInterval * SECS_PER_MIN)) {
+    if (isAutosaveEnabled() && !_autosaveQueue.isPending() && unixNow() >= _lastAutosave + (_systemData->autosaveInterval * SECS_PER_MIN)) {
         performAutosave();
     }
 }
@@ -50,6 +50,9 @@
 // Uncomment or -D this define to enable usage of the Arduino MQTT library, which enables IoT data publishing capabilities.
 //#define HYDRO_ENABLE_MQTT                       // https://github.com/256dpi/arduino-mqtt
 
+// Uncomment or -D this define to enable 1-minute, 15-minute, and hourly rollup tiers of data published to SD card (adds RAM usage and SD card writes).
+//#define HYDRO_ENABLE_DATA_ROLLUPS
+
 // Uncomment or -D this define to enable usage of the Adafruit GPS library, which enables GPS capabilities.
 //#define HYDRO_ENABLE_GPS                        // https://github.com/adafruit/Adafruit_GPS
 
@@ -152,6 +155,10 @@ typedef uint8_t pintype_t;
 #define HYDRO_HARD_ASSERT(cond,msg)     ((void)0)
 #endif
 
+#ifdef HYDRO_ENABLE_DATA_ROLLUPS
+#define HYDRO_USE_DATA_ROLLUPS
+#endif
+
 #ifdef HYDRO_ENABLE_GPS
 #include "Adafruit_GPS.h"               // GPS library
 #define HYDRO_USE_GPS
@@ -229,7 +236,9 @@ extern void miscLoop();
 #include "HydroModules.h"
 #include "HydroScheduler.h"
 #include "HydroLogger.h"
+#include "HydroDataStore.h"
 #include "HydroPublisher.h"
+#include "HydroAutosave.h"
 #include "HydroFactory.h"
 
 
@@ -262,7 +271,7 @@ public:
               Hydro_DisplayOutputMode dispOutMode = Hydro_DisplayOutputMode_Disabled,   // What display output mode should be used
               Hydro_ControlInputMode ctrlInMode = Hydro_ControlInputMode_Disabled);     // What control input mode should be used
 
-    // Initializes system from EEPROM save, returning success flag
+    // Initializes system from newest valid EEPROM save generation, returning success flag
     // Set system data address with setSystemEEPROMAddress
     bool initFromEEPROM(bool jsonFormat = false);
     // Initializes system from SD card file save, returning success flag
@@ -278,8 +287,8 @@ public:
     // Initializes system from custom binary stream, returning success flag
     bool initFromBinaryStream(Stream *streamIn);
 
-    // Saves current system setup to EEPROM save, returning success flag
-    // Set system data address with setSystemEEPROMAddress
+    // Saves current system setup to next EEPROM save generation slot, returning success flag
+    // Set system data address with setSystemEEPROMAddress (region to end of EEPROM is wear-leveled)
     bool saveToEEPROM(bool jsonFormat = false);
     // Saves current system setup to SD card file save, returning success flag
     // Set config file name with setSystemConfigFilename
@@ -325,7 +334,7 @@ public:
 #endif
 #ifdef HYDRO_USE_MQTT
     // Enables data publishing to MQTT broker. Client is expected to be began/connected (with proper broker address/net client) *before* calling this method. Returns success flag.
-    inline bool enableDataPublishingToMQTTClient(MQTTClient &client) { return publisher.beginPublishingToMQTTClient(client); }
+    inline bool enableDataPublishingToMQTTClient(MQTTClient &client, bool batchFrames = false, int qos = 0) { return publisher.beginPublishingToMQTTClient(client, batchFrames, qos); }
 #endif
 
     // User Interface.
@@ -414,7 +423,16 @@ public:
     // SD card instance (user code *must* call endSDCard(inst) to return interface, possibly lazily instantiated, nullptr return -> failure/no device)
     SDClass *getSDCard(bool begin = true);
     // Ends SD card transaction with proper regards to platform once all instances returned (note: some instancing may be expected to never return)
+    // Card session is kept begun until idle for HYDRO_SYS_SDSESSION_IDLEMILLIS, avoiding card re-init on every access
     void endSDCard(SDClass *sd = nullptr);
+    // Opens SD card file from shared SD session file pool, reusing already open handle (read handles rewound, write handles appended to) if available (user code *must* call endSDFile(file) to return handle, nullptr return -> failure)
+    File *getSDFile(const char *filename, bool forWrite = false);
+    // Returns SD card file handle to pool, where it is left open for reuse until idle
+    void endSDFile(File *file);
+    // Closes any idle pooled handles to filename (e.g. before removal), returning false if still in use
+    bool closeSDFile(const char *filename);
+    // Flushes pending writes of pooled SD card file handles
+    void flushSDFiles();
 #ifdef HYDRO_USE_WIFI
     // WiFi instance (nullptr return -> failure/no device, note: this method may block for up to a minute)
     inline WiFiClass *getWiFi(bool begin = true);
@@ -506,6 +524,8 @@ protected:
     HydroRTCInterface *_rtc;                                // Real time clock instance (owned, lazy)
     SDClass *_sd;                                           // SD card instance (owned/strong, lazy/supplied, default: SD)
     int8_t _sdOut;                                          // Number of SD card instances out
+    uint32_t _sdLastUse;                                    // Last time SD card instance was returned (millis)
+    HydroHandlePool<File, HYDRO_SYS_SDSESSION_FILES> _sdFiles; // Shared SD session file handle pool
 #ifdef HYDRO_USE_GPS
     GPSClass *_gps;                                         // GPS instance (owned, lazy)
 #endif
@@ -530,6 +550,7 @@ protected:
     hframe_t _pollingFrame;                                 // Current data polling frame # (index 0 reserved for disabled/undef, advanced by publisher)
     time_t _lastSpaceCheck;                                 // Last date storage media free space was checked, if able (UTC)
     time_t _lastAutosave;                                   // Last date autosave was performed, if able (UTC)
+    HydroAutosaveQueue _autosaveQueue;                      // Autosave snapshot write queue
     String _sysConfigFilename;                              // System config filename used in serialization (default: "hydruino.cfg")
     uint16_t _sysDataAddress;                               // EEPROM system data address used in serialization (default: -1/disabled)
 
@@ -539,6 +560,8 @@ protected:
     void deallocateRTC();
     void allocateSD();
     void deallocateSD();
+    void dropSDFile(int slot);
+    void updateSDSession();
 #ifdef HYDRO_USE_GPS
     void allocateGPS();
     void deallocateGPS();
@@ -547,6 +570,8 @@ protected:
     void commonPreInit();
     void commonPostInit();
     void commonPostSave();
+    HydroData **newSaveSnapshot(uint16_t &countOut);
+    bool fallBackEEPROMGenerations(HydroEEPROMGenerations<I2C_eeprom> &generations);
 
     friend void handleInterrupt(pintype_t pin);
     friend SharedPtr<HydroObjInterface> HydroDLinkObject::resolveObject();
@@ -560,11 +585,13 @@ protected:
     friend HydroPublisher *::getPublisher();
 #ifdef HYDRO_USE_GUI
     friend HydroUIInterface *::getUI();
+    friend class HydroOverview;
 #endif
     friend class HydroCropsLibrary;
     friend class HydroScheduler;
     friend class HydroLogger;
     friend class HydroPublisher;
+    friend class HydroAutosaveQueue;
 
 public: // consider protected
     void checkFreeMemory();
@@ -52,34 +52,40 @@ inline EthernetClass *Hydruino::getEthernet(bool begin)
 
 inline void Hydruino::performAutosave()
 {
-    for (int autosave = 0; autosave < 2; ++autosave) {
-        switch (autosave == 0 ? _systemData->autosaveEnabled : _systemData->autosaveFallback) {
-            case Hydro_Autosave_EnabledToSDCardJson:
-                saveToSDCard(JSON);
-                break;
-            case Hydro_Autosave_EnabledToSDCardRaw:
-                saveToSDCard(RAW);
-                break;
-            case Hydro_Autosave_EnabledToEEPROMJson:
-                saveToEEPROM(JSON);
-                break;
-            case Hydro_Autosave_EnabledToEEPROMRaw:
-                saveToEEPROM(RAW);
-                break;
-            case Hydro_Autosave_EnabledToWiFiStorageJson:
-                #ifdef HYDRO_USE_WIFI_STORAGE
-                    saveToWiFiStorage(JSON);
-                #endif
-                break;
-            case Hydro_Autosave_EnabledToWiFiStorageRaw:
-                #ifdef HYDRO_USE_WIFI_STORAGE
-                    saveToWiFiStorage(RAW);
-                #endif
-            case Hydro_Autosave_Disabled:
-                break;
+    // Snapshot is written out from misc loop, across as many runs as needed, else if snapshot can't
+    // be taken (e.g. not enough free memory for the copies), saved synchronously instead
+    if (!_autosaveQueue.begin(_systemData->autosaveEnabled, _systemData->autosaveFallback)) {
+        logger.logWarning(logArg(HStr_Log_AutosaveSnapshotFailed));
+
+        for (int autosave = 0; autosave < 2; ++autosave) {
+            switch (autosave == 0 ? _systemData->autosaveEnabled : _systemData->autosaveFallback) {
+                case Hydro_Autosave_EnabledToSDCardJson:
+                    saveToSDCard(JSON);
+                    break;
+                case Hydro_Autosave_EnabledToSDCardRaw:
+                    saveToSDCard(RAW);
+                    break;
+                case Hydro_Autosave_EnabledToEEPROMJson:
+                    saveToEEPROM(JSON);
+                    break;
+                case Hydro_Autosave_EnabledToEEPROMRaw:
+                    saveToEEPROM(RAW);
+                    break;
+                case Hydro_Autosave_EnabledToWiFiStorageJson:
+                    #ifdef HYDRO_USE_WIFI_STORAGE
+                        saveToWiFiStorage(JSON);
+                    #endif
+                    break;
+                case Hydro_Autosave_EnabledToWiFiStorageRaw:
+                    #ifdef HYDRO_USE_WIFI_STORAGE
+                        saveToWiFiStorage(RAW);
+                    #endif
+                    break;
+                case Hydro_Autosave_Disabled:
+                    break;
+            }
         }
     }
-
     _lastAutosave = unixNow();
 }
 
@@ -121,6 +127,7 @@ inline void Hydruino::notifySignificantTime(time_t time)
 
 inline void Hydruino::notifySignificantLocation(Location loc)
 {
+    scheduler.updateDayTracking(); // recalculates twilight
     if (_systemData) { _systemData->bumpRevisionIfNeeded(); }
 }
 
@@ -151,12 +158,12 @@ inline bool HydroLogger::isLoggingToWiFiStorage() const
 
 inline void HydroLogger::logActivation(const HydroActuator *actuator)
 {
-    if (actuator) { logMessage(actuator->getId().getDisplayString(), SFP(HStr_Log_HasEnabled)); }
+    if (actuator) { logMessage(logArg(actuator->getId()), logArg(HStr_Log_HasEnabled)); }
 }
 
 inline void HydroLogger::logDeactivation(const HydroActuator *actuator)
 {
-    if (actuator) { logMessage(actuator->getId().getDisplayString(), SFP(HStr_Log_HasDisabled)); }
+    if (actuator) { logMessage(logArg(actuator->getId()), logArg(HStr_Log_HasDisabled)); }
 }
 
 inline void HydroLogger::logProcess(const HydroObjInterface *obj, const String &processString, const String &statusString)
@@ -164,16 +171,36 @@ inline void HydroLogger::logProcess(const HydroObjInterface *obj, const String &
     if (obj) { logMessage(obj->getId().getDisplayString(), processString, statusString); }
 }
 
+inline void HydroLogger::logProcess(const HydroObjInterface *obj, Hydro_String processStr, Hydro_String statusStr)
+{
+    if (obj) { logMessage(logArg(obj->getId()), logArg(processStr), statusStr != HStr_Count ? logArg(statusStr) : HydroLogArg()); }
+}
+
 inline void HydroLogger::logStatus(const HydroObjInterface *obj, const String &statusString)
 {
     if (obj) { logMessage(obj->getId().getDisplayString(), statusString); }
 }
 
+inline void HydroLogger::logStatus(const HydroObjInterface *obj, Hydro_String statusStr)
+{
+    if (obj) { logMessage(logArg(obj->getId()), logArg(statusStr)); }
+}
+
+inline void HydroLogger::logMeasurement(Hydro_String fieldStr, const HydroSingleMeasurement &measurement, unsigned int additionalDecPlaces)
+{
+    logMeasurement(fieldStr, measurement.value, measurement.units, additionalDecPlaces);
+}
+
 inline Hydro_LogLevel HydroLogger::getLogLevel() const
 {
     return hasLoggerData() ? loggerData()->logLevel : Hydro_LogLevel_None;
 }
 
+inline bool HydroLogger::isLoggingBinary() const
+{
+    return hasLoggerData() && Hydruino::_activeInstance->_systemData->logBinary;
+}
+
 inline bool HydroLogger::isLoggingEnabled() const
 {
     return hasLoggerData() && loggerData()->logLevel != Hydro_LogLevel_None && (loggerData()->logToSDCard || loggerData()->logToWiFiStorage);
@@ -207,7 +234,7 @@ inline bool HydroPublisher::isPublishingToWiFiStorage() const
 
 inline bool HydroPublisher::isPublishingToMQTTClient() const
 {
-    return hasPublisherData() && _mqttClient;
+    return hasPublisherData() && _mqttSink;
 }
 
 #endif
@@ -216,7 +243,7 @@ inline bool HydroPublisher::isPublishingEnabled() const
 {
     return hasPublisherData() && (publisherData()->pubToSDCard || publisherData()->pubToWiFiStorage
         #ifdef HYDRO_USE_MQTT
-            || _mqttClient
+            || _mqttSink
         #endif
         );
 }
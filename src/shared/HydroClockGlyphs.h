@@ -0,0 +1,42 @@
+/*  Hydruino: Simple automation controller for hydroponic grow systems.
+    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>
+    Hydruino Packed Glyphs
+*/
+
+// Generated by tests/font_pack.py from tcMenu_Font_AdafruitGFXArial14.h, glyphs "0123456789:-" - do not edit.
+
+#ifndef HydroClockGlyphs_H
+#define HydroClockGlyphs_H
+
+#include "HydroCoreLogic.h"
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#define HYDRO_CLOCKGLYPHS_COUNT         12                  // Number of packed glyphs
+#define HYDRO_CLOCKGLYPHS_ASCENT        11                  // Pixels above baseline
+#define HYDRO_CLOCKGLYPHS_HEIGHT        11                  // Pixel height, ascent and descent
+
+const uint8_t hydroClockGlyphsData[] PROGMEM = {
+0x7a,0x18,0x61,0x86,0x18,0x61,0x85,0xe0,0x2e,0x92,0x49,0x24,0x7a,0x18,0x41,0x04,0x21,0x08,0x43,0xf0,
+0x7a,0x18,0x41,0x38,0x10,0x61,0x85,0xe0,0x04,0x18,0x51,0x22,0x48,0xa1,0x7f,0x04,0x08,0x7d,0x08,0x3e,
+0x84,0x10,0x61,0x89,0xe0,0x39,0x18,0x20,0xbb,0x18,0x61,0x85,0xe0,0xfc,0x10,0x82,0x10,0x41,0x08,0x20,
+0x80,0x7a,0x18,0x61,0x7a,0x18,0x61,0x85,0xe0,0x7a,0x18,0x61,0x8d,0xd0,0x41,0x89,0xc0,0x81,0xf0,
+};
+
+const HydroPackedGlyph hydroClockGlyphs[] PROGMEM = {
+    { '0', 6, 10, 8, 1, -11, 0, 0 },
+    { '1', 3, 10, 8, 2, -11, 0, 8 },
+    { '2', 6, 10, 8, 1, -11, 0, 12 },
+    { '3', 6, 10, 8, 1, -11, 0, 20 },
+    { '4', 7, 10, 8, 0, -11, 0, 28 },
+    { '5', 6, 10, 8, 1, -11, 0, 37 },
+    { '6', 6, 10, 8, 1, -11, 0, 45 },
+    { '7', 6, 10, 8, 1, -11, 0, 53 },
+    { '8', 6, 10, 8, 1, -11, 0, 61 },
+    { '9', 6, 10, 8, 1, -11, 0, 69 },
+    { ':', 1, 8, 4, 1, -9, 0, 77 },
+    { '-', 4, 1, 5, 0, -5, 0, 78 },
+};
+
+#endif // /ifndef HydroClockGlyphs_H
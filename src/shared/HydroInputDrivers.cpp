@@ -35,8 +35,180 @@ IoAbstractionRef HydroInputDriver::getIoAbstraction() const
 }
 
 
+static HydroInputEventQueue *_isrQueues[HYDRO_UI_INPUTEVENTS_MAXPINS] = {nullptr}; // Attached queue per ISR slot
+static uint8_t _isrRoles[HYDRO_UI_INPUTEVENTS_MAXPINS] = {0}; // Attached pin role per ISR slot
+static pintype_t _isrPins[HYDRO_UI_INPUTEVENTS_MAXPINS] = {0}; // Attached pin per ISR slot
+
+template<uint8_t Slot>
+static HYDRO_UI_ISR_ATTR void inputEventISR()
+{
+    if (_isrQueues[Slot]) { _isrQueues[Slot]->handleISR(_isrRoles[Slot]); }
+}
+
+static void (*const _isrTrampolines[HYDRO_UI_INPUTEVENTS_MAXPINS])() = {
+    &inputEventISR<0>, &inputEventISR<1>, &inputEventISR<2>, &inputEventISR<3>,
+    &inputEventISR<4>, &inputEventISR<5>, &inputEventISR<6>, &inputEventISR<7>
+};
+
+HydroInputEventQueue::HydroInputEventQueue(HydroInputEventListener *listener, uint16_t debounceMillis)
+    : _listener(listener), _debounceMillis(debounceMillis), _rowPins{hpin_none,hpin_none,hpin_none,hpin_none}, _colPins{hpin_none,hpin_none,hpin_none,hpin_none},
+      _rows(0), _cols(0), _rowKeys{-1,-1,-1,-1}, _encoderPins{hpin_none,hpin_none}, _repeatDelay(0), _repeatInterval(0),
+      _heldKey(-1), _heldTime(0), _heldRepeating(false), _drainTaskId(TASKMGR_INVALIDID)
+{ ; }
+
+HydroInputEventQueue::~HydroInputEventQueue()
+{
+    detachAll();
+}
+
+bool HydroInputEventQueue::isNativeInterruptPin(pintype_t pin)
+{
+    return isValidPin(pin) && pin < hpin_virtual && !(getController() && getController()->getPinMuxer(pin)) &&
+           isValidPin(digitalPinToInterrupt(pin));
+}
+
+bool HydroInputEventQueue::attachPin(pintype_t pin, uint8_t role)
+{
+    for (uint8_t slot = 0; slot < HYDRO_UI_INPUTEVENTS_MAXPINS; ++slot) {
+        if (!_isrQueues[slot]) {
+            _isrRoles[slot] = role;
+            _isrPins[slot] = pin;
+            _isrQueues[slot] = this;
+            attachInterrupt(digitalPinToInterrupt(pin), _isrTrampolines[slot], CHANGE);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool HydroInputEventQueue::attachMatrix(const pintype_t *rowPins, uint8_t rows, const pintype_t *colPins, uint8_t cols, millis_t repeatDelay, millis_t repeatInterval)
+{
+    HYDRO_SOFT_ASSERT(rows <= 4 && cols <= 4, SFP(HStr_Err_InvalidParameter));
+    if (_rows || !rows || rows > 4 || !cols || cols > 4) { return false; }
+    for (uint8_t row = 0; row < rows; ++row) {
+        if (!isNativeInterruptPin(rowPins[row])) { return false; }
+    }
+    for (uint8_t col = 0; col < cols; ++col) {
+        if (!isValidPin(colPins[col]) || colPins[col] >= hpin_virtual) { return false; }
+    }
+
+    for (uint8_t col = 0; col < cols; ++col) {
+        _colPins[col] = colPins[col];
+        pinMode(_colPins[col], OUTPUT);
+        digitalWrite(_colPins[col], LOW);
+    }
+    _cols = cols;
+    _repeatDelay = repeatDelay;
+    _repeatInterval = repeatInterval;
+    for (uint8_t row = 0; row < rows; ++row) {
+        _rowPins[row] = rowPins[row];
+        pinMode(_rowPins[row], INPUT_PULLUP);
+        if (!attachPin(_rowPins[row], row)) { detachAll(); return false; }
+        _rows = row + 1;
+    }
+
+    scheduleDrain();
+    return true;
+}
+
+bool HydroInputEventQueue::attachEncoder(pintype_t pinA, pintype_t pinB, Hydro_EncoderSpeed encoderSpeed)
+{
+    if (isValidPin(_encoderPins[0]) || !isNativeInterruptPin(pinA) || !isNativeInterruptPin(pinB)) { return false; }
+
+    _encoderPins[0] = pinA;
+    _encoderPins[1] = pinB;
+    pinMode(pinA, INPUT_PULLUP);
+    pinMode(pinB, INPUT_PULLUP);
+    _decoder = HydroQuadratureDecoder(encoderSpeed == Hydro_EncoderSpeed_FullCycle ? 4 : encoderSpeed == Hydro_EncoderSpeed_HalfCycle ? 2 : 1);
+    _decoder.reset((digitalRead(pinA) == HIGH ? 2 : 0) | (digitalRead(pinB) == HIGH ? 1 : 0));
+    if (!attachPin(pinA, 4) || !attachPin(pinB, 5)) { detachAll(); return false; }
+
+    scheduleDrain();
+    return true;
+}
+
+void HydroInputEventQueue::detachAll()
+{
+    for (uint8_t slot = 0; slot < HYDRO_UI_INPUTEVENTS_MAXPINS; ++slot) {
+        if (_isrQueues[slot] == this) {
+            detachInterrupt(digitalPinToInterrupt(_isrPins[slot]));
+            _isrQueues[slot] = nullptr;
+        }
+    }
+    if (_drainTaskId != TASKMGR_INVALIDID) { taskManager.cancelTask(_drainTaskId); _drainTaskId = TASKMGR_INVALIDID; }
+    _rows = _cols = 0;
+    _encoderPins[0] = _encoderPins[1] = hpin_none;
+}
+
+void HydroInputEventQueue::scheduleDrain()
+{
+    if (_drainTaskId == TASKMGR_INVALIDID) {
+        _drainTaskId = taskManager.scheduleFixedRate(HYDRO_UI_INPUTEVENTS_DRAINRATE, this);
+    }
+}
+
+HYDRO_UI_ISR_ATTR int8_t HydroInputEventQueue::scanRow(uint8_t row)
+{
+    int8_t key = -1;
+    for (uint8_t col = 0; col < _cols && key < 0; ++col) {
+        for (uint8_t driveCol = 0; driveCol < _cols; ++driveCol) { digitalWrite(_colPins[driveCol], driveCol == col ? LOW : HIGH); }
+        delayMicroseconds(2); // line settle
+        if (digitalRead(_rowPins[row]) == LOW) { key = (int8_t)(row * _cols + col); }
+    }
+    for (uint8_t col = 0; col < _cols; ++col) { digitalWrite(_colPins[col], LOW); }
+    return key;
+}
+
+HYDRO_UI_ISR_ATTR void HydroInputEventQueue::handleISR(uint8_t role)
+{
+    uint32_t now = millis();
+    if (role < 4) { // matrix row
+        bool pressed = digitalRead(_rowPins[role]) == LOW;
+        if (_rowDebouncer.accept(role, pressed, now, _debounceMillis)) {
+            if (pressed) {
+                _rowKeys[role] = scanRow(role);
+                if (_rowKeys[role] >= 0) { _events.push(HydroInputEvent{(uint8_t)_rowKeys[role], 1, now}); }
+            } else if (_rowKeys[role] >= 0) {
+                _events.push(HydroInputEvent{(uint8_t)_rowKeys[role], 0, now});
+                _rowKeys[role] = -1;
+            }
+        }
+    } else { // encoder A/B
+        int8_t detent = _decoder.update((digitalRead(_encoderPins[0]) == HIGH ? 2 : 0) | (digitalRead(_encoderPins[1]) == HIGH ? 1 : 0));
+        if (detent) { _events.push(HydroInputEvent{EncoderSource, detent, now}); }
+    }
+}
+
+void HydroInputEventQueue::exec()
+{
+    // recover settled trailing edges that were swallowed as bounce
+    for (uint8_t row = 0; row < _rows; ++row) {
+        if (_rowDebouncer.getState(row) != (digitalRead(_rowPins[row]) == LOW)) {
+            noInterrupts();
+            handleISR(row);
+            interrupts();
+        }
+    }
+
+    HydroInputEvent event;
+    while (_events.pop(event)) {
+        if (event.source != EncoderSource) {
+            if (event.value) { _heldKey = (int8_t)event.source; _heldTime = event.time; _heldRepeating = false; }
+            else if (_heldKey == (int8_t)event.source) { _heldKey = -1; }
+        }
+        if (_listener) { _listener->inputEvent(event); }
+    }
+
+    if (_heldKey >= 0 && _repeatInterval && hydroHasElapsed(millis(), _heldTime, _heldRepeating ? _repeatInterval : _repeatDelay)) {
+        _heldTime = millis();
+        _heldRepeating = true;
+        if (_listener) { _listener->inputEvent(HydroInputEvent{(uint8_t)_heldKey, 2, _heldTime}); }
+    }
+}
+
+
 HydroInputRotary::HydroInputRotary(Pair<uint8_t, const pintype_t *> controlPins, Hydro_EncoderSpeed encoderSpeed)
-    : HydroInputDriver(controlPins), _encoderSpeed(encoderSpeed)
+    : HydroInputDriver(controlPins), _encoderSpeed(encoderSpeed), _eventQueue(nullptr)
 {
     HYDRO_SOFT_ASSERT(_pins.first >= 1 && isValidPin(_pins.second[0]), HStr_Err_InvalidParameter);
     HYDRO_SOFT_ASSERT(_pins.first >= 2 && isValidPin(_pins.second[1]), HStr_Err_InvalidParameter);
@@ -50,13 +222,39 @@ void HydroInputRotary::begin(HydroDisplayDriver *displayDriver, MenuItem *initia
                   getBaseUI() ? getBaseUI()->getISRMode() : SWITCHES_POLL_EVERYTHING,
                   !getBaseUI() || getBaseUI()->isActiveLow());
  
-    menuMgr.initForEncoder(displayDriver ? displayDriver->getBaseRenderer() : nullptr, initialItem,
-                           pinChannelOrPinNumber(_pins.second[0]), pinChannelOrPinNumber(_pins.second[1]), pinChannelOrPinNumber(_pins.second[2]),
-                           _encoderSpeed == Hydro_EncoderSpeed_FullCycle ? FULL_CYCLE : _encoderSpeed == Hydro_EncoderSpeed_HalfCycle ? HALF_CYCLE : QUARTER_CYCLE);
+    if ((!getBaseUI() || getBaseUI()->allowingISR()) && !_eventQueue) {
+        _eventQueue = new HydroInputEventQueue(this);
+        HYDRO_SOFT_ASSERT(_eventQueue, SFP(HStr_Err_AllocationFailure));
+        if (_eventQueue && !_eventQueue->attachEncoder(_pins.second[0], _pins.second[1], _encoderSpeed)) {
+            delete _eventQueue; _eventQueue = nullptr;
+        }
+    }
+
+    if (_eventQueue) { // encoder detents fed from ISR input event queue, select button still by switches
+        menuMgr.initWithoutInput(displayDriver ? displayDriver->getBaseRenderer() : nullptr, initialItem);
+        switches.setEncoder(0, new RotaryEncoder([](int value) { menuMgr.valueChanged(value); }));
+        switches.addSwitch(pinChannelOrPinNumber(_pins.second[2]), [](pinid_t, bool held) { menuMgr.onMenuSelect(held); }, NO_REPEAT);
+    } else {
+        menuMgr.initForEncoder(displayDriver ? displayDriver->getBaseRenderer() : nullptr, initialItem,
+                               pinChannelOrPinNumber(_pins.second[0]), pinChannelOrPinNumber(_pins.second[1]), pinChannelOrPinNumber(_pins.second[2]),
+                               _encoderSpeed == Hydro_EncoderSpeed_FullCycle ? FULL_CYCLE : _encoderSpeed == Hydro_EncoderSpeed_HalfCycle ? HALF_CYCLE : QUARTER_CYCLE);
+    }
     if (_pins.first > 3 && isValidPin(_pins.second[3])) { menuMgr.setBackButton(pinChannelOrPinNumber(_pins.second[3])); }
     if (_pins.first > 4 && isValidPin(_pins.second[4])) { menuMgr.setNextButton(pinChannelOrPinNumber(_pins.second[4])); }
 }
 
+HydroInputRotary::~HydroInputRotary()
+{
+    if (_eventQueue) { delete _eventQueue; }
+}
+
+void HydroInputRotary::inputEvent(const HydroInputEvent &event)
+{
+    if (event.source == HydroInputEventQueue::EncoderSource && switches.getEncoder()) {
+        switches.getEncoder()->increment(event.value);
+    }
+}
+
 
 HydroInputUpDownButtons::HydroInputUpDownButtons(Pair<uint8_t, const pintype_t *> controlPins, uint16_t keyRepeatSpeed)
     : HydroInputDriver(controlPins), _keySpeed(keyRepeatSpeed), _dfRobotIORef(nullptr)
@@ -265,7 +463,7 @@ HydroInputMatrix3x4::HydroInputMatrix3x4(Pair<uint8_t, const pintype_t *> contro
       _keyboard(),
       _keyboardLayout(4, 3, _matrix3x4Keys),
       _tcMenuKeyListener(SFP(HUIStr_Keys_MatrixActions)[0], SFP(HUIStr_Keys_MatrixActions)[1], SFP(HUIStr_Keys_MatrixActions)[2], SFP(HUIStr_Keys_MatrixActions)[3]),
-      _rotaryEncoder(nullptr)
+      _rotaryEncoder(nullptr), _repeatDelay(repeatDelay), _repeatInterval(repeatInterval), _eventQueue(nullptr)
 {
     HYDRO_SOFT_ASSERT(_pins.first >= 1 && isValidPin(_pins.second[0]), HStr_Err_InvalidParameter);
     HYDRO_SOFT_ASSERT(_pins.first >= 2 && isValidPin(_pins.second[1]), HStr_Err_InvalidParameter);
@@ -291,15 +489,26 @@ HydroInputMatrix3x4::HydroInputMatrix3x4(Pair<uint8_t, const pintype_t *> contro
 
 HydroInputMatrix3x4::~HydroInputMatrix3x4()
 {
+    if (_eventQueue) { delete _eventQueue; }
     if (_rotaryEncoder) { delete _rotaryEncoder; }
 }
 
 void HydroInputMatrix3x4::begin(HydroDisplayDriver *displayDriver, MenuItem *initialItem)
 {
-    auto expander = getController() && _pins.first >= 1 && isValidPin(_pins.second[0]) && _pins.second[0] >= hpin_virtual ? getController()->getPinExpander(expanderPosForPinNumber(_pins.second[0])) : nullptr;
-    _keyboard.initialise(expander && expander->getIoAbstraction() ? expander->getIoAbstraction() : (getIoAbstraction() ?: internalDigitalIo()),
-                         &_keyboardLayout, &_tcMenuKeyListener,
-                         (!getBaseUI() || getBaseUI()->allowingISR()) && areRowPinsInterruptable());
+    if ((!getBaseUI() || getBaseUI()->allowingISR()) && !_eventQueue) {
+        _eventQueue = new HydroInputEventQueue(this);
+        HYDRO_SOFT_ASSERT(_eventQueue, SFP(HStr_Err_AllocationFailure));
+        if (_eventQueue && !_eventQueue->attachMatrix(&_pins.second[0], 4, &_pins.second[4], 3, _repeatDelay, _repeatInterval)) {
+            delete _eventQueue; _eventQueue = nullptr;
+        }
+    }
+
+    if (!_eventQueue) { // keyboard polled/interrupted through tcMenu
+        auto expander = getController() && _pins.first >= 1 && isValidPin(_pins.second[0]) && _pins.second[0] >= hpin_virtual ? getController()->getPinExpander(expanderPosForPinNumber(_pins.second[0])) : nullptr;
+        _keyboard.initialise(expander && expander->getIoAbstraction() ? expander->getIoAbstraction() : (getIoAbstraction() ?: internalDigitalIo()),
+                             &_keyboardLayout, &_tcMenuKeyListener,
+                             (!getBaseUI() || getBaseUI()->allowingISR()) && areRowPinsInterruptable());
+    }
 
     if (_rotaryEncoder) { _rotaryEncoder->begin(displayDriver, initialItem); }
     else { menuMgr.initWithoutInput(displayDriver ? displayDriver->getBaseRenderer() : nullptr, initialItem); }
@@ -319,13 +528,22 @@ bool HydroInputMatrix3x4::areMainPinsInterruptable() const
     return areRowPinsInterruptable() && (!_rotaryEncoder || _rotaryEncoder->areMainPinsInterruptable());
 }
 
+void HydroInputMatrix3x4::inputEvent(const HydroInputEvent &event)
+{
+    if (event.source < 12) {
+        char key = _keyboardLayout.keyFor(event.source / 3, event.source % 3);
+        if (event.value) { _tcMenuKeyListener.keyPressed(key, event.value > 1); }
+        else { _tcMenuKeyListener.keyReleased(key); }
+    }
+}
+
 
 HydroInputMatrix4x4::HydroInputMatrix4x4(Pair<uint8_t, const pintype_t *> controlPins, millis_t repeatDelay, millis_t repeatInterval, Hydro_EncoderSpeed encoderSpeed)
     : HydroInputDriver(controlPins),
       _keyboard(),
       _keyboardLayout(4, 4, _matrix4x4Keys),
       _tcMenuKeyListener(SFP(HUIStr_Keys_MatrixActions)[0], SFP(HUIStr_Keys_MatrixActions)[1], SFP(HUIStr_Keys_MatrixActions)[2], SFP(HUIStr_Keys_MatrixActions)[3]),
-      _rotaryEncoder(nullptr)
+      _rotaryEncoder(nullptr), _repeatDelay(repeatDelay), _repeatInterval(repeatInterval), _eventQueue(nullptr)
 {
     HYDRO_SOFT_ASSERT(_pins.first >= 1 && isValidPin(_pins.second[0]), HStr_Err_InvalidParameter);
     HYDRO_SOFT_ASSERT(_pins.first >= 2 && isValidPin(_pins.second[1]), HStr_Err_InvalidParameter);
@@ -353,16 +571,27 @@ HydroInputMatrix4x4::HydroInputMatrix4x4(Pair<uint8_t, const pintype_t *> contro
 
 HydroInputMatrix4x4::~HydroInputMatrix4x4()
 {
+    if (_eventQueue) { delete _eventQueue; }
     if (_rotaryEncoder) { delete _rotaryEncoder; }
 }
 
 void HydroInputMatrix4x4::begin(HydroDisplayDriver *displayDriver, MenuItem *initialItem)
 {
-    auto expander = getController() && _pins.first >= 1 && isValidPin(_pins.second[0]) && _pins.second[0] >= hpin_virtual ? getController()->getPinExpander(expanderPosForPinNumber(_pins.second[0])) : nullptr;
-    _keyboard.initialise(expander && expander->getIoAbstraction() ? expander->getIoAbstraction() : (getIoAbstraction() ?: internalDigitalIo()),
-                         &_keyboardLayout, &_tcMenuKeyListener,
-                         (!getBaseUI() || getBaseUI()->allowingISR()) && areRowPinsInterruptable());
- 
+    if ((!getBaseUI() || getBaseUI()->allowingISR()) && !_eventQueue) {
+        _eventQueue = new HydroInputEventQueue(this);
+        HYDRO_SOFT_ASSERT(_eventQueue, SFP(HStr_Err_AllocationFailure));
+        if (_eventQueue && !_eventQueue->attachMatrix(&_pins.second[0], 4, &_pins.second[4], 4, _repeatDelay, _repeatInterval)) {
+            delete _eventQueue; _eventQueue = nullptr;
+        }
+    }
+
+    if (!_eventQueue) { // keyboard polled/interrupted through tcMenu
+        auto expander = getController() && _pins.first >= 1 && isValidPin(_pins.second[0]) && _pins.second[0] >= hpin_virtual ? getController()->getPinExpander(expanderPosForPinNumber(_pins.second[0])) : nullptr;
+        _keyboard.initialise(expander && expander->getIoAbstraction() ? expander->getIoAbstraction() : (getIoAbstraction() ?: internalDigitalIo()),
+                             &_keyboardLayout, &_tcMenuKeyListener,
+                             (!getBaseUI() || getBaseUI()->allowingISR()) && areRowPinsInterruptable());
+    }
+
     if (_rotaryEncoder) { _rotaryEncoder->begin(displayDriver, initialItem); }
     else { menuMgr.initWithoutInput(displayDriver ? displayDriver->getBaseRenderer() : nullptr, initialItem); }
 }
@@ -381,6 +610,15 @@ bool HydroInputMatrix4x4::areMainPinsInterruptable() const
     return areRowPinsInterruptable() && (!_rotaryEncoder || _rotaryEncoder->areMainPinsInterruptable());
 }
 
+void HydroInputMatrix4x4::inputEvent(const HydroInputEvent &event)
+{
+    if (event.source < 16) {
+        char key = _keyboardLayout.keyFor(event.source / 4, event.source % 4);
+        if (event.value) { _tcMenuKeyListener.keyPressed(key, event.value > 1); }
+        else { _tcMenuKeyListener.keyReleased(key); }
+    }
+}
+
 
 HydroInputResistiveTouch::HydroInputResistiveTouch(Pair<uint8_t, const pintype_t *> controlPins, HydroDisplayDriver *displayDriver, Hydro_DisplayRotation displayRotation, Hydro_TouchscreenOrientation touchOrient)
     : HydroInputDriver(controlPins),
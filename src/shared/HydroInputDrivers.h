@@ -9,6 +9,8 @@
 #define HydroInputDrivers_H
 
 class HydroInputDriver;
+class HydroInputEventListener;
+class HydroInputEventQueue;
 class HydroInputRotary;
 class HydroInputUpDownButtons;
 class HydroInputESP32TouchKeys;
@@ -61,24 +63,96 @@ protected:
 };
 
 
+// Input Event Listener
+// Receives input events drained from an input event queue, on the UI task.
+class HydroInputEventListener {
+public:
+    // Key events: source = key index (row * cols + col), value = pressed (1), released (0),
+    // or held repeat (2). Encoder events: source = HydroInputEventQueue::EncoderSource,
+    // value = detent step (-1/+1).
+    virtual void inputEvent(const HydroInputEvent &event) = 0;
+};
+
+// Input Event Queue
+// ISR-fed input event queue for matrix keypads and rotary encoders on native interruptable
+// pins. Pin-change interrupts debounce key edges (scanning columns to resolve the key) or
+// decode encoder quadrature right in the ISR, pushing timestamped events into a lock-free
+// ring that the UI task drains at a fixed rate. Presses and detents are thus captured as
+// they happen, rather than being missed between switch polls while the control loop is
+// holding up the scheduler.
+class HydroInputEventQueue : public Executable {
+public:
+    enum : uint8_t { EncoderSource = 0x80 };
+
+    HydroInputEventQueue(HydroInputEventListener *listener, uint16_t debounceMillis = HYDRO_UI_INPUTEVENTS_DEBOUNCE);
+    virtual ~HydroInputEventQueue();
+
+    // Attaches matrix keypad, with row pins as pulled-up pin-change inputs and column pins
+    // driven low at rest. Key repeats begin after repeatDelay, every repeatInterval. Returns
+    // success, else pins are not all native pins (or rows interruptable).
+    bool attachMatrix(const pintype_t *rowPins, uint8_t rows, const pintype_t *colPins, uint8_t cols, millis_t repeatDelay, millis_t repeatInterval);
+    // Attaches quadrature rotary encoder. Returns success, else pins not native interruptable.
+    bool attachEncoder(pintype_t pinA, pintype_t pinB, Hydro_EncoderSpeed encoderSpeed);
+    // Detaches all interrupts, stopping drain.
+    void detachAll();
+
+    // Drains queued events to listener (and generates key repeats), on UI task.
+    virtual void exec() override;
+
+    // Handles pin-change interrupt for given attached pin role (rows, then encoder A/B).
+    void handleISR(uint8_t role);
+
+    // Returns if pin is a native pin with its own interrupt (not expanded/muxed).
+    static bool isNativeInterruptPin(pintype_t pin);
+
+    inline uint16_t getDroppedCount() const { return _events.getDroppedCount(); }
+
+protected:
+    HydroInputEventListener *_listener;                     // Event listener (strong)
+    HydroInputEventRing<HYDRO_UI_INPUTEVENTS_SIZE> _events; // Event ring (ISR to UI task)
+    HydroEdgeDebouncer<4> _rowDebouncer;                    // Row edge debouncer (ISR)
+    HydroQuadratureDecoder _decoder;                        // Encoder decoder (ISR)
+    const uint16_t _debounceMillis;                         // Key debounce time, in millis
+    pintype_t _rowPins[4];                                  // Matrix row pins
+    pintype_t _colPins[4];                                  // Matrix column pins
+    uint8_t _rows, _cols;                                   // Matrix rows and columns
+    volatile int8_t _rowKeys[4];                            // Pressed key per row, else -1 (ISR)
+    pintype_t _encoderPins[2];                              // Encoder A/B pins, else hpin_none
+    millis_t _repeatDelay, _repeatInterval;                 // Key repeat delay and interval, in millis
+    int8_t _heldKey;                                        // Held key, else -1 (UI task)
+    uint32_t _heldTime;                                     // Held key press or last repeat time, in millis
+    bool _heldRepeating;                                    // If held key has started repeating
+    taskid_t _drainTaskId;                                  // Drain task
+
+    bool attachPin(pintype_t pin, uint8_t role);
+    int8_t scanRow(uint8_t row);
+    void scheduleDrain();
+};
+
+
 // Rotary Encoder Input Driver
 // Rotary encoder that uses a twisting motion, along with momentary push-down.
 // Control input mode pin array:
 // - RotaryEncoderOk: {eA,eB,Ok},
 // - RotaryEncoderOkLR: {eA,eB,Ok,Bk,Nx}
 // Note: CLK,DT,SW designated pins same as eA,eB,Ok pins.
-class HydroInputRotary : public HydroInputDriver {
+class HydroInputRotary : public HydroInputDriver, public HydroInputEventListener {
 public:
     HydroInputRotary(Pair<uint8_t, const pintype_t *> controlPins, Hydro_EncoderSpeed encoderSpeed);
-    virtual ~HydroInputRotary() = default;
+    virtual ~HydroInputRotary();
 
     virtual void begin(HydroDisplayDriver *displayDriver, MenuItem *initialItem) override;
 
+    virtual void inputEvent(const HydroInputEvent &event) override;
+
     // Encoder detent speed accessor
     inline Hydro_EncoderSpeed getEncoderSpeed() const { return _encoderSpeed; }
+    // ISR input event queue accessor, else nullptr if polling
+    inline HydroInputEventQueue *getEventQueue() { return _eventQueue; }
 
 protected:
     const Hydro_EncoderSpeed _encoderSpeed;                 // Encoder detent speed setting
+    HydroInputEventQueue *_eventQueue;                      // ISR input event queue (owned), else nullptr if polling
 };
 
 
@@ -206,7 +280,7 @@ protected:
 // - Matrix3x4Keyboard_OptRotEncOk: {r0,r1,r2,r3,c0,c1,c2,eA,eB,Ok}
 // - Matrix3x4Keyboard_OptRotEncOkLR: {r0,r1,r2,r3,c0,c1,c2,eA,eB,Ok,Bk,Nx}
 // Note: Left/right designated pins same as row/column pins.
-class HydroInputMatrix3x4 : public HydroInputDriver {
+class HydroInputMatrix3x4 : public HydroInputDriver, public HydroInputEventListener {
 public:
     HydroInputMatrix3x4(Pair<uint8_t, const pintype_t *> controlPins, millis_t repeatDelay, millis_t repeatInterval, Hydro_EncoderSpeed encoderSpeed);
     virtual ~HydroInputMatrix3x4();
@@ -218,16 +292,23 @@ public:
     bool areRowPinsInterruptable() const;
     virtual bool areMainPinsInterruptable() const override;
 
+    virtual void inputEvent(const HydroInputEvent &event) override;
+
     // Matrix keyboard accessor
     inline MatrixKeyboardManager &getKeyboard() { return _keyboard; }
     // Optional rotary encoder accessor
     inline HydroInputRotary *getRotaryEncoder() { return _rotaryEncoder; }
+    // ISR input event queue accessor, else nullptr if polling
+    inline HydroInputEventQueue *getEventQueue() { return _eventQueue; }
 
 protected:
     MatrixKeyboardManager _keyboard;                        // Matrix keyboard
     KeyboardLayout _keyboardLayout;                         // Matrix keyboard layout
     MenuEditingKeyListener _tcMenuKeyListener;              // Matrix key listener
     HydroInputRotary *_rotaryEncoder;                       // Optional rotary encoder, else nullptr
+    const millis_t _repeatDelay;                            // Key repeat delay, in millis
+    const millis_t _repeatInterval;                         // Key repeat interval, in millis
+    HydroInputEventQueue *_eventQueue;                      // ISR input event queue (owned), else nullptr if polling
 };
 
 
@@ -239,7 +320,7 @@ protected:
 // - Matrix4x4Keyboard_OptRotEncOk: {r0,r1,r2,r3,c0,c1,c2,c3,eA,eB,Ok}
 // - Matrix4x4Keyboard_OptRotEncOkLR: {r0,r1,r2,r3,c0,c1,c2,c3,eA,eB,Ok,Bk,Nx}
 // Note: Left/right designated pins same as row/column pins.
-class HydroInputMatrix4x4 : public HydroInputDriver {
+class HydroInputMatrix4x4 : public HydroInputDriver, public HydroInputEventListener {
 public:
     HydroInputMatrix4x4(Pair<uint8_t, const pintype_t *> controlPins, millis_t repeatDelay, millis_t repeatInterval, Hydro_EncoderSpeed encoderSpeed = Hydro_EncoderSpeed_HalfCycle);
     virtual ~HydroInputMatrix4x4();
@@ -251,16 +332,23 @@ public:
     bool areRowPinsInterruptable() const;
     virtual bool areMainPinsInterruptable() const override;
 
+    virtual void inputEvent(const HydroInputEvent &event) override;
+
     // Matrix keyboard accessor
     inline MatrixKeyboardManager &getKeyboard() { return _keyboard; }
     // Optional rotary encoder accessor
     inline HydroInputRotary *getRotaryEncoder() { return _rotaryEncoder; }
+    // ISR input event queue accessor, else nullptr if polling
+    inline HydroInputEventQueue *getEventQueue() { return _eventQueue; }
 
 protected:
     MatrixKeyboardManager _keyboard;                        // Matrix keyboard
     KeyboardLayout _keyboardLayout;                         // Matrix keyboard layout
     MenuEditingKeyListener _tcMenuKeyListener;              // Matrix key listener
     HydroInputRotary *_rotaryEncoder;                       // Optional rotary encoder, else nullptr
+    const millis_t _repeatDelay;                            // Key repeat delay, in millis
+    const millis_t _repeatInterval;                         // Key repeat interval, in millis
+    HydroInputEventQueue *_eventQueue;                      // ISR input event queue (owned), else nullptr if polling
 };
 
 
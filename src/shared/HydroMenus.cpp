@@ -6,4 +6,69 @@
 #include "HydruinoUI.h"
 #ifdef HYDRO_USE_GUI
 
+void HydroMenuItemPool::acquire(HydroMenu *owner)
+{
+    if (_owner != owner) {
+        recycle();
+        _owner = owner;
+    }
+}
+
+void HydroMenuItemPool::recycle()
+{
+    if (_owner) {
+        HydroMenu *owner = _owner;
+        _owner = nullptr;
+        owner->unloadMenu();
+    }
+    while (_count) {
+        --_count;
+        _items[_count].destroy(_items[_count].item);
+    }
+    _arena.reset();
+}
+
+
+HydroPooledMenu::~HydroPooledMenu()
+{
+    unloadMenu();
+}
+
+void HydroPooledMenu::loadMenu(MenuItem *addFrom)
+{
+    if (!_loaded && getBaseUI()) {
+        HydroMenuItemPool &pool = getBaseUI()->getMenuPool();
+        pool.acquire(this);
+
+        _rootItem = materializeItems(pool);
+        HYDRO_SOFT_ASSERT(_rootItem, SFP(HStr_Err_AllocationFailure));
+
+        if (_rootItem) {
+            _loaded = true;
+            if ((_addFrom = addFrom)) { // linked directly, as addMenuAfter() would cut off the rest of the item list
+                _addFrom->setNext(_rootItem);
+                menuMgr.notifyStructureChanged();
+            }
+        } else {
+            pool.recycle();
+        }
+    }
+}
+
+void HydroPooledMenu::unloadMenu()
+{
+    if (_loaded) {
+        _loaded = false;
+        if (_addFrom) {
+            _addFrom->setNext(nullptr);
+            menuMgr.notifyStructureChanged();
+        }
+        _addFrom = _rootItem = nullptr;
+
+        if (getBaseUI() && getBaseUI()->getMenuPool().getOwner() == this) {
+            getBaseUI()->getMenuPool().recycle();
+        }
+    }
+}
+
 #endif
@@ -9,10 +9,17 @@
 #define HydroMenus_H
 
 class HydroMenu;
+class HydroPooledMenu;
+class HydroMenuItemPool;
 
 #include "HydruinoUI.h"
 #include "RemoteMenuItem.h"
 #include "EditableLargeNumberMenuItem.h"
+#ifdef ARDUINO_ARCH_AVR
+#include <new.h>
+#else
+#include <new>
+#endif
 
 // Menu Screen Base
 class HydroMenu
@@ -22,6 +29,7 @@ public:
     virtual ~HydroMenu() = default;
 
     virtual void loadMenu(MenuItem *addFrom = nullptr) = 0; // should call menuMgr.addMenuAfter()
+    virtual void unloadMenu() { ; }
     virtual MenuItem *getRootItem() = 0;
 
     inline bool isLoaded() const { return _loaded; }
@@ -30,6 +38,70 @@ protected:
     bool _loaded;
 };
 
+// Menu Item Pool
+// Fixed-size arena that a visible submenu's items are materialized into on demand, which
+// is recycled as a whole once another submenu acquires it (or the menu times out).
+class HydroMenuItemPool
+{
+public:
+    inline HydroMenuItemPool() : _count(0), _owner(nullptr) { ; }
+    inline ~HydroMenuItemPool() { recycle(); }
+
+    // Makes menu the pool's owner, first unloading any previous owner's items.
+    void acquire(HydroMenu *owner);
+    // Unloads current owner's menu, destroying all pooled items.
+    void recycle();
+
+    // Constructs a menu item in the pool, else returns nullptr if pool is full.
+    template<class ItemType, typename... Args>
+    ItemType *allocate(Args... args) {
+        void *itemMem = _count < HYDRO_UI_MENUITEMS_MAXSIZE ? _arena.allocate(sizeof(ItemType), alignof(ItemType)) : nullptr;
+        if (!itemMem) { return nullptr; }
+        _items[_count].item = itemMem;
+        _items[_count].destroy = &destroyItem<ItemType>;
+        _count++;
+        return new (itemMem) ItemType(args...);
+    }
+
+    inline HydroMenu *getOwner() const { return _owner; }
+    inline uint8_t getItemCount() const { return _count; }
+    inline size_t getHighWater() const { return _arena.getHighWater(); }
+
+protected:
+    struct PooledItem {
+        void *item;                                         // Item memory (in arena)
+        void (*destroy)(void *);                            // Item destructor thunk
+    };
+    HydroArena<HYDRO_UI_MENUITEMS_POOLSIZE> _arena;         // Item storage arena
+    PooledItem _items[HYDRO_UI_MENUITEMS_MAXSIZE];          // Pooled items, in allocation order
+    uint8_t _count;                                         // Number of pooled items
+    HydroMenu *_owner;                                      // Owning menu (strong), else nullptr
+
+    template<class ItemType> static void destroyItem(void *item) { ((ItemType *)item)->~ItemType(); }
+};
+
+// Pooled Menu Screen Base
+// Submenu screen whose items are materialized on demand from flash-based item info (see
+// InfoPtrForItem) into the UI's shared menu item pool, only once the submenu is entered.
+class HydroPooledMenu : public HydroMenu
+{
+public:
+    inline HydroPooledMenu() : HydroMenu(), _addFrom(nullptr), _rootItem(nullptr) { ; }
+    virtual ~HydroPooledMenu();
+
+    // Materializes items, linking them in after addFrom (e.g. the submenu's back item).
+    virtual void loadMenu(MenuItem *addFrom = nullptr) override;
+    virtual void unloadMenu() override;
+    virtual MenuItem *getRootItem() override { return _rootItem; }
+
+protected:
+    MenuItem *_addFrom;                                     // Item loaded after (strong), else nullptr
+    MenuItem *_rootItem;                                    // First pooled item (strong), else nullptr
+
+    // Allocates this menu's items from pool, returning first item of linked list, else nullptr.
+    virtual MenuItem *materializeItems(HydroMenuItemPool &pool) = 0;
+};
+
 // Initializes an AnyMenuInfo structure
 #define InitAnyMenuInfo(varName,strNum,itemId,eepromPosition,valMaximum,fnCallback)\
     safeProgCpy(varName.name, CFP(strNum), NAME_SIZE_T);\
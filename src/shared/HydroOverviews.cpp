@@ -6,4 +6,84 @@
 #include "HydruinoUI.h"
 #ifdef HYDRO_USE_GUI
 
+// Appends object type name and position, e.g. "WaterTemp #1: ".
+static void appendDetailName(HydroFixedString<HYDRO_UI_DETAILTEXT_MAXSIZE> &textOut, Hydro_String typeStr, hposi_t posIndex)
+{
+    if (typeStr != HStr_Count && typeStr != HStr_Undefined) { appendStringFromPGM(textOut, typeStr); }
+    textOut.append(" #").appendInt(posIndex + HYDRO_POS_EXPORT_BEGFROM);
+    appendStringFromPGM(textOut, HStr_ColonSpace);
+}
+
+void HydroOverview::bindDetailRows()
+{
+    _detailBindings.unbindAll();
+    _detailCount = 0;
+
+    for (int pass = 0; pass < 3 && _detailCount < HYDRO_UI_DETAILROWS_MAXSIZE; ++pass) {
+        for (auto iter = Hydruino::_activeInstance->_objects.begin(); iter != Hydruino::_activeInstance->_objects.end() && _detailCount < HYDRO_UI_DETAILROWS_MAXSIZE; ++iter) {
+            auto object = iter->second.get();
+            int fieldIndex = -1;
+
+            if (pass == 0 && object->isSensorType()) { fieldIndex = _detailBindings.bindSensor(object->getId()); }
+            else if (pass == 1 && object->isActuatorType()) { fieldIndex = _detailBindings.bindActuator(object->getId()); }
+            else if (pass == 2 && object->isReservoirType()) { fieldIndex = _detailBindings.bindReservoir(object->getId()); }
+            else { continue; }
+
+            if (fieldIndex != _detailCount) { // out of binding slots
+                if (fieldIndex >= 0) { _detailBindings.unbind(fieldIndex); }
+                return;
+            }
+            _detailTexts[_detailCount++].clear();
+        }
+    }
+}
+
+uint32_t HydroOverview::updateDetailRows(bool fullRedraw)
+{
+    if (!_detailCount && Hydruino::_activeInstance->_objects.size()) {
+        bindDetailRows();
+        fullRedraw = true;
+    }
+    if (fullRedraw) { _detailBindings.invalidateAll(); }
+
+    uint32_t invalidRows = _detailBindings.takeInvalidations();
+    uint32_t changedRows = 0;
+
+    for (int row = 0; invalidRows && row < _detailCount; ++row) {
+        if (!(invalidRows & ((uint32_t)1 << row))) { continue; }
+        invalidRows &= ~((uint32_t)1 << row);
+
+        HydroFixedString<HYDRO_UI_DETAILTEXT_MAXSIZE> text;
+        auto object = static_cast<HydroObject *>(_detailBindings.getObject(row));
+        if (object && object->isSensorType()) {
+            auto sensor = static_cast<HydroSensor *>(object);
+            appendDetailName(text, sensorTypeToStringId(sensor->getSensorType()), sensor->getSensorIndex());
+            auto measurement = sensor->getMeasurement();
+            if (measurement && measurement->frame) {
+                auto single = getAsSingleMeasurement(measurement);
+                appendMeasurement(text, single.value, single.units);
+            } else {
+                text.append('-');
+            }
+        } else if (object && object->isActuatorType()) {
+            auto actuator = static_cast<HydroActuator *>(object);
+            appendDetailName(text, actuatorTypeToStringId(actuator->getActuatorType()), actuator->getActuatorIndex());
+            text.appendInt((int32_t)roundf(actuator->getDriveIntensity() * 100.0f)).append('%');
+        } else if (object && object->isReservoirType()) {
+            auto reservoir = static_cast<HydroReservoir *>(object);
+            appendDetailName(text, reservoirTypeToStringId(reservoir->getReservoirType()), reservoir->getReservoirIndex());
+            text.append(reservoir->isFilled() ? "full" : reservoir->isEmpty() ? "empty" : "-");
+        }
+        text.markTruncation();
+
+        if (fullRedraw || strcmp(text.c_str(), _detailTexts[row].c_str())) {
+            _detailTexts[row].clear();
+            _detailTexts[row].append(text.c_str());
+            changedRows |= (uint32_t)1 << row;
+        }
+    }
+
+    return changedRows;
+}
+
 #endif
@@ -19,9 +19,11 @@ class HydroOverviewTFT;
 // Overview Screen Base
 // Overview screen class that manages the default at-a-glance system overview.
 // Meant to be able to be deleted on a moments notice to transition back into menu.
+// Detail rows below the clock are bound to object signals (see HydroUIBindings), so that
+// each row is redrawn only once its object reports a change.
 class HydroOverview {
 public:
-    inline HydroOverview(HydroDisplayDriver *display) : _display(display), _needsFullRedraw(true) { ; }
+    inline HydroOverview(HydroDisplayDriver *display) : _display(display), _needsFullRedraw(true), _detailCount(0) { ; }
     virtual ~HydroOverview() = default;
 
     // Renders overview screen given current display orientation.
@@ -32,6 +34,16 @@ public:
 protected:
     HydroDisplayDriver *_display;                           // Display (strong)
     bool _needsFullRedraw;                                  // Needs full redraw flag
+    HydroUIBindings _detailBindings;                        // Detail row signal bindings, field index being row index
+    HydroFixedString<HYDRO_UI_DETAILTEXT_MAXSIZE> _detailTexts[HYDRO_UI_DETAILROWS_MAXSIZE]; // Detail row texts, as last drawn
+    uint8_t _detailCount;                                   // Number of bound detail rows
+
+    // Binds detail rows to the first sensors, then actuators, then reservoirs found. Walks
+    // the object registry once, on the first render that finds any such objects.
+    void bindDetailRows();
+    // Takes detail row invalidations (once per UI tick, all rows if full redraw), refreshing
+    // their texts. Returns mask of detail rows whose text changed and so need redrawn.
+    uint32_t updateDetailRows(bool fullRedraw);
 };
 
 #include "screens/HydroOverviewGFX.h"
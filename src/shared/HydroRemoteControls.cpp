@@ -6,6 +6,34 @@
 #include "HydruinoUI.h"
 #ifdef HYDRO_USE_GUI
 
+bool HydroRemoteControl::queueChange(MenuItem *item)
+{
+    TagValueRemoteServerConnection *connection = getTagValueConnection();
+    if (item && connection && _deltaBatch.add(item->getId())) {
+        item->setSendRemoteNeeded(connection->connector()->getRemoteNo(), false);
+        return true;
+    }
+    return false;
+}
+
+void HydroRemoteControl::syncChanges()
+{
+    TagValueRemoteServerConnection *connection = getTagValueConnection();
+    if (!connection || _deltaBatch.isEmpty()) { return; }
+    if (!connection->connector()->isConnected()) { _deltaBatch.clear(); return; } // bootstrap on connect sends all values
+
+    uint32_t now = millis();
+    if (!_deltaBatch.isDue(now, _syncInterval)) { return; }
+
+    uint8_t remoteNo = connection->connector()->getRemoteNo();
+    for (size_t entry = 0; entry < _deltaBatch.size(); ++entry) {
+        MenuItem *item = getMenuItemById(_deltaBatch[entry]);
+        if (item) { item->setSendRemoteNeeded(remoteNo, true); }
+    }
+    _deltaBatch.consume(_deltaBatch.size(), now);
+}
+
+
 HydroRemoteSerialControl::HydroRemoteSerialControl(UARTDeviceSetup serialSetup)
     : _serialTransport(serialSetup.serial), _serialInitializer(), _serialConnection(_serialTransport, _serialInitializer)
 { ; }
@@ -21,13 +21,34 @@ class HydroRemoteEthernetControl;
 #include "HydruinoUI.h"
 
 // Remote Control Base
-// Base remote control class.
+// Base remote control class. Tag-value connections may hold back frequently changing items,
+// coalescing repeat changes and releasing them at most once per sync interval to tcMenu's own
+// per-item send, which keeps slow serial links from flooding as live values update.
 class HydroRemoteControl {
 public:
+    inline HydroRemoteControl() : _syncInterval(HYDRO_UI_REMOTESYNC_INTERVAL) { ; }
     virtual ~HydroRemoteControl() = default;
 
     // Connection accessor
     virtual BaseRemoteServerConnection *getConnection() = 0;
+
+    // Queues a changed menu item for the next sync, holding back its pending send on this
+    // connection. Returns false if not able to (connection doesn't support it, or batch full),
+    // for tcMenu to send it right away.
+    bool queueChange(MenuItem *item);
+    // Releases pending changes to tcMenu's standard per-item send, once the sync interval has elapsed.
+    void syncChanges();
+
+    // Sets minimum interval between syncs on this connection, in milliseconds.
+    inline void setSyncInterval(uint16_t syncInterval) { _syncInterval = syncInterval; }
+    inline uint16_t getSyncInterval() const { return _syncInterval; }
+
+protected:
+    HydroDeltaBatch<HYDRO_UI_REMOTESYNC_MAXSIZE> _deltaBatch; // Pending changed item ids
+    uint16_t _syncInterval;                                 // Min interval between syncs, in millis
+
+    // Tag-value connection accessor, else nullptr if connection doesn't support held back sync
+    virtual TagValueRemoteServerConnection *getTagValueConnection() { return nullptr; }
 };
 
 
@@ -44,6 +65,8 @@ protected:
     SerialTagValueTransport _serialTransport;
     NoInitialisationNeeded _serialInitializer;
     TagValueRemoteServerConnection _serialConnection;
+
+    virtual TagValueRemoteServerConnection *getTagValueConnection() override { return &_serialConnection; }
 };
 
 
@@ -78,6 +101,8 @@ protected:
     WiFiInitialisation _netInitialisation;
     WiFiTagValTransport _netTransport;
     TagValueRemoteServerConnection _netConnection;
+
+    virtual TagValueRemoteServerConnection *getTagValueConnection() override { return &_netConnection; }
 };
 #endif
 
@@ -99,6 +124,8 @@ protected:
     EthernetInitialisation _netInitialisation;
     EthernetTagValTransport _netTransport;
     TagValueRemoteServerConnection _netConnection;
+
+    virtual TagValueRemoteServerConnection *getTagValueConnection() override { return &_netConnection; }
 };
 #endif
 
@@ -0,0 +1,119 @@
+/*  Hydruino: Simple automation controller for hydroponic grow systems.
+    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>
+    Hydruino UI Data Bindings
+*/
+
+#include "HydruinoUI.h"
+#ifdef HYDRO_USE_GUI
+
+void HydroUIBindingField::invalidate()
+{
+    _bindings->invalidate(_fieldIndex);
+}
+
+
+HydroUIBindings::HydroUIBindings()
+    : _fields{nullptr}, _boundFields(0)
+{ ; }
+
+HydroUIBindings::~HydroUIBindings()
+{
+    unbindAll();
+}
+
+int HydroUIBindings::allocateFieldIndex()
+{
+    for (int fieldIndex = 0; fieldIndex < 32; ++fieldIndex) {
+        if (!(_boundFields & ((uint32_t)1 << fieldIndex))) { return fieldIndex; }
+    }
+    return -1;
+}
+
+bool HydroUIBindings::addField(HydroUIBindingField *field)
+{
+    HYDRO_SOFT_ASSERT(field, SFP(HStr_Err_AllocationFailure));
+    if (field) {
+        for (int slotIndex = 0; slotIndex < HYDRO_UI_BINDINGS_MAXSIZE; ++slotIndex) {
+            if (!_fields[slotIndex]) {
+                _fields[slotIndex] = field;
+                _boundFields |= (uint32_t)1 << field->getFieldIndex();
+                return true;
+            }
+        }
+        delete field;
+    }
+    return false;
+}
+
+int HydroUIBindings::bindSensor(HydroIdentity sensorId)
+{
+    int fieldIndex = allocateFieldIndex();
+    if (fieldIndex >= 0 && addField(new HydroUISignalField<const HydroMeasurement *, HYDRO_SENSOR_SIGNAL_SLOTS>(this, fieldIndex, sensorId, &HydroSensor::getMeasurementSignal))) {
+        return fieldIndex;
+    }
+    return -1;
+}
+
+int HydroUIBindings::bindActuator(HydroIdentity actuatorId)
+{
+    int fieldIndex = allocateFieldIndex();
+    if (fieldIndex >= 0 && addField(new HydroUISignalField<HydroActuator *, HYDRO_ACTUATOR_SIGNAL_SLOTS>(this, fieldIndex, actuatorId, &HydroActuator::getActivationSignal))) {
+        return fieldIndex;
+    }
+    return -1;
+}
+
+int HydroUIBindings::bindReservoir(HydroIdentity reservoirId)
+{
+    int fieldIndex = allocateFieldIndex();
+    if (fieldIndex >= 0 && addField(new HydroUISignalField<HydroReservoir *, HYDRO_RESERVOIR_SIGNAL_SLOTS>(this, fieldIndex, reservoirId, &HydroReservoir::getFilledSignal))) {
+        if (addField(new HydroUISignalField<HydroReservoir *, HYDRO_RESERVOIR_SIGNAL_SLOTS>(this, fieldIndex, reservoirId, &HydroReservoir::getEmptySignal))) {
+            return fieldIndex;
+        }
+        unbind(fieldIndex);
+    }
+    return -1;
+}
+
+void HydroUIBindings::unbind(int fieldIndex)
+{
+    for (int slotIndex = 0; slotIndex < HYDRO_UI_BINDINGS_MAXSIZE; ++slotIndex) {
+        if (_fields[slotIndex] && _fields[slotIndex]->getFieldIndex() == fieldIndex) {
+            delete _fields[slotIndex]; _fields[slotIndex] = nullptr;
+        }
+    }
+    if (fieldIndex >= 0 && fieldIndex < 32) { _boundFields &= ~((uint32_t)1 << fieldIndex); }
+}
+
+void HydroUIBindings::unbindAll()
+{
+    for (int slotIndex = 0; slotIndex < HYDRO_UI_BINDINGS_MAXSIZE; ++slotIndex) {
+        if (_fields[slotIndex]) { delete _fields[slotIndex]; _fields[slotIndex] = nullptr; }
+    }
+    _boundFields = 0;
+    _invalidations.take();
+}
+
+HydroObjInterface *HydroUIBindings::getObject(int fieldIndex)
+{
+    for (int slotIndex = 0; slotIndex < HYDRO_UI_BINDINGS_MAXSIZE; ++slotIndex) {
+        if (_fields[slotIndex] && _fields[slotIndex]->getFieldIndex() == fieldIndex) {
+            return _fields[slotIndex]->getObject();
+        }
+    }
+    return nullptr;
+}
+
+uint32_t HydroUIBindings::takeInvalidations()
+{
+    if (_boundFields) {
+        for (int slotIndex = 0; slotIndex < HYDRO_UI_BINDINGS_MAXSIZE; ++slotIndex) {
+            if (_fields[slotIndex] && !_fields[slotIndex]->isResolved() && _fields[slotIndex]->resolve()) {
+                _invalidations.invalidate(_fields[slotIndex]->getFieldIndex()); // newly resolved, needs first draw
+            }
+        }
+    }
+    return _invalidations.take();
+}
+
+#endif
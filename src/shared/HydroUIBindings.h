@@ -0,0 +1,107 @@
+/*  Hydruino: Simple automation controller for hydroponic grow systems.
+    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>
+    Hydruino UI Data Bindings
+*/
+
+#include <Hydruino.h>
+#ifdef HYDRO_USE_GUI
+#ifndef HydroUIBindings_H
+#define HydroUIBindings_H
+
+class HydroUIBindings;
+class HydroUIBindingField;
+template<class ParameterType, int Slots> class HydroUISignalField;
+
+#include "HydruinoUI.h"
+
+// UI Binding Field Base
+// A single signal subscription for a bound UI field, which invalidates its field when fired.
+class HydroUIBindingField {
+public:
+    inline HydroUIBindingField(HydroUIBindings *bindings, uint8_t fieldIndex) : _bindings(bindings), _fieldIndex(fieldIndex) { ; }
+    virtual ~HydroUIBindingField() = default;
+
+    // Resolves the linked object, attaching to its signal. Returns if resolved.
+    virtual bool resolve() = 0;
+    virtual bool isResolved() const = 0;
+    // Linked object, else nullptr if not yet resolved.
+    virtual HydroObjInterface *getObject() = 0;
+
+    inline uint8_t getFieldIndex() const { return _fieldIndex; }
+
+protected:
+    HydroUIBindings *_bindings;                             // Parent bindings (strong)
+    uint8_t _fieldIndex;                                    // Field index
+
+    void invalidate();
+};
+
+// UI Signal Binding Field
+// Binding field that subscribes to a signal of the linked object.
+template<class ParameterType, int Slots>
+class HydroUISignalField : public HydroUIBindingField {
+public:
+    template<class U> HydroUISignalField(HydroUIBindings *bindings, uint8_t fieldIndex, HydroIdentity objectId, Signal<ParameterType,Slots> &(U::*signalGetter)(void))
+        : HydroUIBindingField(bindings, fieldIndex), _signal(nullptr, signalGetter)
+    {
+        _signal.setHandleMethod(&HydroUISignalField<ParameterType,Slots>::handleSignal, this);
+        _signal.initObject(objectId);
+        _signal.resolve();
+    }
+    virtual ~HydroUISignalField() = default;
+
+    virtual bool resolve() override { return _signal.resolve(); }
+    virtual bool isResolved() const override { return _signal.isResolved(); }
+    virtual HydroObjInterface *getObject() override { return _signal.resolve() ? _signal.get() : nullptr; }
+
+protected:
+    HydroSignalAttachment<ParameterType,Slots> _signal;     // Signal attachment
+
+    inline void handleSignal(ParameterType) { invalidate(); }
+};
+
+// UI Data Bindings
+// Binds UI fields to the signals of the objects that they display, such that each field is
+// invalidated individually as its source data changes. Field invalidations coalesce until
+// taken once per UI tick, which then redraws only what changed instead of polling every
+// object on every redraw.
+class HydroUIBindings {
+public:
+    HydroUIBindings();
+    ~HydroUIBindings();
+
+    // Binds a field to a sensor's measurement signal. Returns field index, else -1 if full.
+    int bindSensor(HydroIdentity sensorId);
+    // Binds a field to an actuator's activation signal. Returns field index, else -1 if full.
+    int bindActuator(HydroIdentity actuatorId);
+    // Binds a field to a reservoir's filled and empty signals. Returns field index, else -1 if full.
+    int bindReservoir(HydroIdentity reservoirId);
+    // Unbinds all subscriptions of a field, freeing its field index.
+    void unbind(int fieldIndex);
+    // Unbinds all fields.
+    void unbindAll();
+
+    // Linked object of a bound field, else nullptr if unbound or not yet resolved.
+    HydroObjInterface *getObject(int fieldIndex);
+    inline uint32_t getBoundFields() const { return _boundFields; }
+
+    // Invalidates a field, to be redrawn on next UI tick.
+    inline void invalidate(int fieldIndex) { if (fieldIndex >= 0 && fieldIndex < 32) { _invalidations.invalidate(fieldIndex); } }
+    // Invalidates all bound fields, e.g. on full redraws.
+    inline void invalidateAll() { _invalidations.invalidateMask(_boundFields); }
+    // Takes field invalidations mask since last call, clearing them. Called once per UI tick,
+    // which also retries attaching to any bound objects not yet loaded.
+    uint32_t takeInvalidations();
+    inline bool hasInvalidations() const { return _invalidations.hasInvalidations(); }
+
+protected:
+    HydroUIBindingField *_fields[HYDRO_UI_BINDINGS_MAXSIZE]; // Field signal subscriptions (owned)
+    uint32_t _boundFields;                                  // Bound field indicies bitmask
+    HydroFieldInvalidations _invalidations;                 // Pending field invalidations
+
+    int allocateFieldIndex();
+    bool addField(HydroUIBindingField *field);
+};
+
+#endif // /ifndef HydroUIBindings_H
+#endif
@@ -16,13 +16,37 @@
 #define HYDRO_UI_UPDATE_SPEED           2
 #endif
 
+#ifndef HAS_TFT_DMA                                         // Resolve for TFT_eSPI DMA push availability
+#if defined(ESP32) || defined(ARDUINO_ARCH_RP2040)
+#define HAS_TFT_DMA                     true                // TFT_eSPI DMA image pushes available
+#else
+#define HAS_TFT_DMA                     false               // TFT_eSPI DMA image pushes unavailable (blocking pushes only)
+#endif
+#endif
+
 // The following sizes apply to all architectures
 #define HYDRO_UI_RENDERER_BUFFERSIZE    32                  // Buffer size for display renderers
 #define HYDRO_UI_STARFIELD_MAXSIZE      16                  // Starfield map maxsize
+#define HYDRO_UI_DIRTYRECTS_MAXSIZE     4                   // Dirty screen regions maxsize, for partial redraws
+#define HYDRO_UI_BINDINGS_MAXSIZE       8                   // Maximum number of UI binding field signal subscriptions (reservoirs take two)
+#define HYDRO_UI_DETAILROWS_MAXSIZE     4                   // Maximum number of overview detail rows (each bound to an object)
+#define HYDRO_UI_DETAILTEXT_MAXSIZE     28                  // Overview detail row text maxsize
+#define HYDRO_UI_MENUITEMS_POOLSIZE     256                 // Menu item pool arena size, in bytes (pooled submenu items in use at once)
+#define HYDRO_UI_MENUITEMS_MAXSIZE      8                   // Maximum number of pooled menu items in use at once
+#define HYDRO_UI_REMOTESYNC_MAXSIZE     16                  // Maximum changed items pending per remote's rate-limited sync
+#define HYDRO_UI_INPUTEVENTS_SIZE       16                  // ISR input event ring size (power of 2, holds size-1 events)
+#define HYDRO_UI_INPUTEVENTS_MAXPINS    8                   // Maximum native pins attached to ISR input event queues at once
 #define HYDRO_UI_SPRITE_MAXYSIZE        16                  // Sprite max Y (pixel height) - aka # rows for VRAM buffer, when enabled
 // The following sizes only apply to architectures that do not have STL support (AVR/SAM)
 #define HYDRO_UI_REMOTECONTROLS_MAXSIZE 2                   // Maximum array size for remote controls list (max # of remote controls)
 
+// Input event ISR attribute, for ISR code placement in IRAM where needed
+#if defined(ESP32) || defined(ESP8266)
+#define HYDRO_UI_ISR_ATTR               IRAM_ATTR
+#else
+#define HYDRO_UI_ISR_ATTR
+#endif
+
 // CustomOLED U8g2 device string
 #ifndef HYDRO_UI_CUSTOM_OLED_I2C
 #define HYDRO_UI_CUSTOM_OLED_I2C        U8G2_SSD1309_128X64_NONAME0_F_HW_I2C    // Custom OLED for i2c setup (must be _HW_I2C variant /w 2 init params: rotation, resetPin - Wire# not assertion checked since baked into define)
@@ -38,7 +62,10 @@
 #define HYDRO_UI_DEALLOC_AFTER_USE      !HAS_LARGE_SRAM     // If menu data should be unloaded after use (true = lower memory usage, less responsive transitions), or stay memory-resident (false = higher memory usage, more responsive transitions)
 
 #define HYDRO_UI_KEYREPEAT_SPEED        20                  // Default key press repeat speed, in ticks (lower = faster)
+#define HYDRO_UI_INPUTEVENTS_DEBOUNCE   20                  // ISR input event key debounce time, in milliseconds
+#define HYDRO_UI_INPUTEVENTS_DRAINRATE  10                  // ISR input event queue drain interval on UI task, in milliseconds
 #define HYDRO_UI_REMOTESERVER_PORT      3333                // Default remote control server's listening port
+#define HYDRO_UI_REMOTESYNC_INTERVAL    500                 // Default minimum interval between batched delta syncs per remote connection, in milliseconds
 #define HYDRO_UI_2X2MATRIX_KEYS         "#BA*"              // 2x2 matrix keyboard keys (R/S1,D/S2,U/S3,L/S4), forced PROGMEM chars
 #define HYDRO_UI_3X4MATRIX_KEYS         "123456789*0#"      // 3x4 matrix keyboard keys (123,456,789,*0#), forced PROGMEM chars
 #define HYDRO_UI_4X4MATRIX_KEYS         "123A456B789C*0#D"  // 4x4 matrix keyboard keys (123A,456B,789C,*0#D), forced PROGMEM chars
@@ -70,46 +70,30 @@ String stringFromPGM(HydroUI_String strNum)
     }
 
     if (_uiStrDataFilePrefix.length()) {
-        #if HYDRO_SYS_LEAVE_FILES_OPEN
-            static
-        #endif
-        auto sd = getController()->getSDCard();
+        auto file = getController()->getSDFile(getUIStringsFilename().c_str());
 
-        if (sd) {
+        if (file) {
             String retVal;
-            #if HYDRO_SYS_LEAVE_FILES_OPEN
-                static
+            uint16_t lookupOffset = 0;
+            file->seek(sizeof(uint16_t) * (int)strNum);
+            #if defined(ARDUINO_ARCH_RP2040) || defined(ESP_PLATFORM)
+                file->readBytes((char *)&lookupOffset, sizeof(lookupOffset));
+            #else
+                file->readBytes((uint8_t *)&lookupOffset, sizeof(lookupOffset));
             #endif
-            auto file = sd->open(getUIStringsFilename().c_str(), FILE_READ);
-
-            if (file) {
-                uint16_t lookupOffset = 0;
-                file.seek(sizeof(uint16_t) * (int)strNum);
-                #if defined(ARDUINO_ARCH_RP2040) || defined(ESP_PLATFORM)
-                    file.readBytes((char *)&lookupOffset, sizeof(lookupOffset));
-                #else
-                    file.readBytes((uint8_t *)&lookupOffset, sizeof(lookupOffset));
-                #endif
 
-                {   char buffer[HYDRO_STRING_BUFFER_SIZE];
-                    file.seek(lookupOffset);
-                    auto bytesRead = file.readBytesUntil('\000', buffer, HYDRO_STRING_BUFFER_SIZE);
-                    retVal.concat(charsToString(buffer, bytesRead));
+            {   char buffer[HYDRO_STRING_BUFFER_SIZE];
+                file->seek(lookupOffset);
+                auto bytesRead = file->readBytesUntil('\000', buffer, HYDRO_STRING_BUFFER_SIZE);
+                retVal.concat(charsToString(buffer, bytesRead));
 
-                    while (strnlen(buffer, HYDRO_STRING_BUFFER_SIZE) == HYDRO_STRING_BUFFER_SIZE) {
-                        bytesRead = file.readBytesUntil('\000', buffer, HYDRO_STRING_BUFFER_SIZE);
-                        if (bytesRead) { retVal.concat(charsToString(buffer, bytesRead)); }
-                    }
+                while (strnlen(buffer, HYDRO_STRING_BUFFER_SIZE) == HYDRO_STRING_BUFFER_SIZE) {
+                    bytesRead = file->readBytesUntil('\000', buffer, HYDRO_STRING_BUFFER_SIZE);
+                    if (bytesRead) { retVal.concat(charsToString(buffer, bytesRead)); }
                 }
-
-                #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                    file.close();
-                #endif
             }
 
-            #if !HYDRO_SYS_LEAVE_FILES_OPEN
-                getController()->endSDCard(sd);
-            #endif
+            getController()->endSDFile(file);
             if (retVal.length()) {
                 return (_lookupCachedRes = retVal);
             }
@@ -230,7 +214,7 @@ const char *pgmAddrForStr(HydroUI_String strNum)
             return flashUIStr_Item_Date;
         } break;
         case HUIStr_Item_Debug: {
-            static const PROGMEM SubMenuInfo flashUIStr_Item_Debug = { "Debug", 6, NO_ADDRESS, 0, NO_CALLBACK };
+            static const PROGMEM SubMenuInfo flashUIStr_Item_Debug = { "Debug", 6, NO_ADDRESS, 0, debugAction };
             return (const char *)&flashUIStr_Item_Debug;
         } break;
         case HUIStr_Item_DisplayMode: {
@@ -282,7 +266,7 @@ const char *pgmAddrForStr(HydroUI_String strNum)
             return flashUIStr_Item_LatDegrees;
         } break;
         case HUIStr_Item_Library: {
-            static const PROGMEM SubMenuInfo flashUIStr_Item_Library = { "Library", 4, NO_ADDRESS, 0, NO_CALLBACK };
+            static const PROGMEM SubMenuInfo flashUIStr_Item_Library = { "Library", 4, NO_ADDRESS, 0, gotoScreen };
             return (const char *)&flashUIStr_Item_Library;
         } break;
         case HUIStr_Item_LocalTime: {
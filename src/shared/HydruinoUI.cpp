@@ -9,7 +9,7 @@
 HydruinoBaseUI::HydruinoBaseUI(String deviceUUID, UIControlSetup uiControlSetup, UIDisplaySetup uiDisplaySetup, bool isActiveLowIO, bool allowInterruptableIO, bool enableTcUnicodeFonts, bool enableBufferedVRAM)
     : _appInfo{0}, _uiCtrlSetup(uiControlSetup), _uiDispSetup(uiDisplaySetup),
       _isActiveLow(isActiveLowIO), _allowISR(allowInterruptableIO), _isTcUnicodeFonts(enableTcUnicodeFonts), _isBufferedVRAM(enableBufferedVRAM),
-      _uiData(nullptr), _input(nullptr), _display(nullptr), _remoteServer(nullptr), _backlight(nullptr), _blTimeout(0),
+      _uiData(nullptr), _input(nullptr), _display(nullptr), _remoteServer(nullptr), _remoteSyncTaskId(TASKMGR_INVALIDID), _backlight(nullptr), _blTimeout(0),
       _overview(nullptr), _homeMenu(nullptr), _clockFont(nullptr), _detailFont(nullptr), _itemFont(nullptr), _titleFont(nullptr)
 {
     if (getController()) { strncpy(_appInfo.name, getController()->getSystemNameChars(), 30); }
@@ -42,6 +42,8 @@ HydruinoBaseUI::HydruinoBaseUI(String deviceUUID, UIControlSetup uiControlSetup,
 
 HydruinoBaseUI::~HydruinoBaseUI()
 {
+    if (_remoteSyncTaskId != TASKMGR_INVALIDID) { taskManager.cancelTask(_remoteSyncTaskId); }
+    _menuPool.recycle();
     if (_overview) { delete _overview; }
     while (_remotes.size()) {
         delete (*_remotes.begin());
@@ -128,6 +130,29 @@ void HydruinoBaseUI::setNeedsRedraw()
     if (_homeMenu) { menuMgr.notifyStructureChanged(); }
 }
 
+void HydruinoBaseUI::queueRemoteChange(MenuItem *item)
+{
+    if (!item) { return; }
+    item->setSendRemoteNeededAll();
+
+    bool queued = false;
+    for (auto remoteIter = _remotes.begin(); remoteIter != _remotes.end(); ++remoteIter) {
+        queued = (*remoteIter)->queueChange(item) || queued;
+    }
+
+    if (queued && _remoteSyncTaskId == TASKMGR_INVALIDID) {
+        _remoteSyncTaskId = taskManager.scheduleFixedRate(1000 / (_uiData && _uiData->updatesPerSec ? _uiData->updatesPerSec : HYDRO_UI_UPDATE_SPEED),
+                                                          []{ if (getBaseUI()) { getBaseUI()->syncRemotes(); } });
+    }
+}
+
+void HydruinoBaseUI::syncRemotes()
+{
+    for (auto remoteIter = _remotes.begin(); remoteIter != _remotes.end(); ++remoteIter) {
+        (*remoteIter)->syncChanges();
+    }
+}
+
 SwitchInterruptMode HydruinoBaseUI::getISRMode() const
 {
     SwitchInterruptMode isrMode(SWITCHES_POLL_EVERYTHING);
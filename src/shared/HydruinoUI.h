@@ -58,6 +58,7 @@
 #include "HydroDisplayDrivers.h"
 #include "HydroInputDrivers.h"
 #include "HydroRemoteControls.h"
+#include "HydroUIBindings.h"
 #include "HydroMenus.h"
 #include "HydroOverviews.h"
 
@@ -109,6 +110,12 @@ public:
     // Sets redraw needed flag for full UI screen redraw.
     virtual void setNeedsRedraw() override;
 
+    // Flags a changed menu item for remote send, held back and coalesced on tag-value remote
+    // connections until their next sync (see HydroRemoteControl), else sent right away.
+    void queueRemoteChange(MenuItem *item);
+    // Releases any due held back changes, on each UI tick. Scheduled upon first queued change.
+    void syncRemotes();
+
     // Determines the ISR mode to use for switches/keys, based on allowed ISR setting
     // and control input pins specified. If input controller does not allow main pins
     // to be interruptable then it will not check for all pins being interruptable.
@@ -154,6 +161,8 @@ public:
     inline HydroOverview *getOverview() { return _overview; }
     // Home menu accessor
     inline HydroHomeMenu *getHomeMenu() { return _homeMenu; }
+    // Pooled submenu items accessor
+    inline HydroMenuItemPool &getMenuPool() { return _menuPool; }
 
 protected:
     ConnectorLocalInfo _appInfo;                            // Application info for remote connections
@@ -169,10 +178,12 @@ protected:
     HydroDisplayDriver *_display;                           // Display driver (owned)
     TcMenuRemoteServer *_remoteServer;                      // Remote control server (owned)
     Vector<HydroRemoteControl *, HYDRO_UI_REMOTECONTROLS_MAXSIZE> _remotes; // Remote controls list (owned)
+    taskid_t _remoteSyncTaskId;                             // Remote sync task, else TASKMGR_INVALIDID until first queued change
     HydroPin *_backlight;                                   // Backlight control (owned)
     time_t _blTimeout;                                      // Backlight timeout (UTC)
     HydroOverview *_overview;                               // Overview screen (owned)
     HydroHomeMenu *_homeMenu;                               // Home menu screen (owned)
+    HydroMenuItemPool _menuPool;                            // Pooled submenu items
     const void *_clockFont;                                 // Overview clock font (strong), when gfx display
     const void *_detailFont;                                // Overview detail font (strong), when gfx display
     const void *_itemFont;                                  // Menu item font (strong), when gfx display
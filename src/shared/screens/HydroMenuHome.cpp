@@ -17,6 +17,9 @@ void CALLBACK_FUNCTION gotoScreen(int id)
         case 5: // Information
             // todo
             break;
+        case 4: // Library
+            if (getBaseUI() && getBaseUI()->getHomeMenu()) { getBaseUI()->getHomeMenu()->loadSubMenu(id); }
+            break;
         case 42: // Calibrations
             // todo
             break;
@@ -77,6 +80,9 @@ void CALLBACK_FUNCTION debugAction(int id)
         case 61: // TriggerAutosave
             if (getController()) { getController()->performAutosave(); }
             break;
+        case 6: // Debug
+            if (getBaseUI() && getBaseUI()->getHomeMenu()) { getBaseUI()->getHomeMenu()->loadSubMenu(id); }
+            break;
         default: break;
     }
 }
@@ -111,9 +117,74 @@ MenuItem *HydroHomeMenu::getRootItem()
     return _loaded && _items ? &_items->menuAlerts : nullptr;
 }
 
+void HydroHomeMenu::loadSubMenu(int id)
+{
+    if (!_items) { return; }
+    switch (id) {
+        #ifdef HYDRO_UI_ENABLE_DEBUG_MENU
+            case 6: // Debug
+                _debugMenu.loadMenu(&_items->menuBackDebug);
+                break;
+        #endif
+        case 4: // Library
+            _libraryMenu.loadMenu(&_items->menuBackLibrary);
+            break;
+        default: break;
+    }
+}
+
 void HydroHomeMenu::unloadSubMenus()
 {
-    // todo
+    if (getBaseUI()) { getBaseUI()->getMenuPool().recycle(); }
+}
+
+#ifdef HYDRO_UI_ENABLE_DEBUG_MENU
+
+MenuItem *HydroHomeDebugMenu::materializeItems(HydroMenuItemPool &pool)
+{
+    #ifdef HYDRO_DISABLE_BUILTIN_DATA
+        HydroHomeMenuInfo &init = getBaseUI()->getHomeMenu()->getItems().init;
+    #endif
+    auto menuTriggerSigLocation = pool.allocate<ActionMenuItem>(InfoPtrForItem(TriggerSigLocation, AnyMenuInfo), nullptr, InfoLocation);
+    if (!menuTriggerSigLocation) { return nullptr; }
+    auto menuTriggerSigTime = pool.allocate<ActionMenuItem>(InfoPtrForItem(TriggerSigTime, AnyMenuInfo), menuTriggerSigLocation, InfoLocation);
+    if (!menuTriggerSigTime) { return nullptr; }
+    auto menuTriggerSDCleanup = pool.allocate<ActionMenuItem>(InfoPtrForItem(TriggerSDCleanup, AnyMenuInfo), menuTriggerSigTime, InfoLocation);
+    if (!menuTriggerSDCleanup) { return nullptr; }
+    auto menuTriggerLowMem = pool.allocate<ActionMenuItem>(InfoPtrForItem(TriggerLowMem, AnyMenuInfo), menuTriggerSDCleanup, InfoLocation);
+    if (!menuTriggerLowMem) { return nullptr; }
+    auto menuTriggerAutosave = pool.allocate<ActionMenuItem>(InfoPtrForItem(TriggerAutosave, AnyMenuInfo), menuTriggerLowMem, InfoLocation);
+    if (!menuTriggerAutosave) { return nullptr; }
+    auto menuSimhubConnected = pool.allocate<BooleanMenuItem>(InfoPtrForItem(SimhubConnected, BooleanMenuInfo), false, menuTriggerAutosave, InfoLocation);
+    if (!menuSimhubConnected) { return nullptr; }
+
+    menuTriggerSigLocation->setReadOnly(true);
+    menuTriggerSigTime->setReadOnly(true);
+    menuTriggerSDCleanup->setReadOnly(true);
+    menuTriggerLowMem->setReadOnly(true);
+    menuTriggerAutosave->setReadOnly(true);
+    menuSimhubConnected->setReadOnly(true);
+    return menuSimhubConnected;
+}
+
+#endif // /ifdef HYDRO_UI_ENABLE_DEBUG_MENU
+
+MenuItem *HydroHomeLibraryMenu::materializeItems(HydroMenuItemPool &pool)
+{
+    #ifdef HYDRO_DISABLE_BUILTIN_DATA
+        HydroHomeMenuInfo &init = getBaseUI()->getHomeMenu()->getItems().init;
+    #endif
+    auto menuCalibrations = pool.allocate<ActionMenuItem>(InfoPtrForItem(Calibrations, AnyMenuInfo), nullptr, InfoLocation);
+    if (!menuCalibrations) { return nullptr; }
+    auto menuAdditives = pool.allocate<ActionMenuItem>(InfoPtrForItem(Additives, AnyMenuInfo), menuCalibrations, InfoLocation);
+    if (!menuAdditives) { return nullptr; }
+    auto menuCropsLib = pool.allocate<ActionMenuItem>(InfoPtrForItem(CropsLib, AnyMenuInfo), menuAdditives, InfoLocation);
+    if (!menuCropsLib) { return nullptr; }
+
+    menuCalibrations->setReadOnly(true);
+    menuAdditives->setReadOnly(true);
+    menuCropsLib->setReadOnly(true);
+    return menuCropsLib;
 }
 
 #ifdef HYDRO_DISABLE_BUILTIN_DATA
@@ -134,7 +205,7 @@ HydroHomeMenuInfo::HydroHomeMenuInfo()
     InitAnyMenuInfo(minfoCalibrations, HUIStr_Item_Calibrations, 42, NO_ADDRESS, 0, gotoScreen);
     InitAnyMenuInfo(minfoAdditives, HUIStr_Item_Additives, 41, NO_ADDRESS, 0, gotoScreen);
     InitAnyMenuInfo(minfoCropsLib, HUIStr_Item_CropsLib, 40, NO_ADDRESS, 0, gotoScreen);
-    InitSubMenuInfo(minfoLibrary, HUIStr_Item_Library, 4, NO_ADDRESS, 0, NO_CALLBACK);
+    InitSubMenuInfo(minfoLibrary, HUIStr_Item_Library, 4, NO_ADDRESS, 0, gotoScreen);
     InitAnyMenuInfo(minfoSettings, HUIStr_Item_Settings, 3, NO_ADDRESS, 0, gotoScreen);
     InitAnyMenuInfo(minfoScheduling, HUIStr_Item_Scheduling, 25, NO_ADDRESS, 0, gotoScreen);
     InitAnyMenuInfo(minfoPowerRails, HUIStr_Item_PowerRails, 24, NO_ADDRESS, 0, gotoScreen);
@@ -154,22 +225,13 @@ HydroHomeMenuItems::HydroHomeMenuItems() :
     #endif
     menuBackToOverview(InfoPtrForItem(BackToOverview, AnyMenuInfo), nullptr, InfoLocation),
     #ifdef HYDRO_UI_ENABLE_DEBUG_MENU
-        menuTriggerSigLocation(InfoPtrForItem(TriggerSigLocation, AnyMenuInfo), nullptr, InfoLocation),
-        menuTriggerSigTime(InfoPtrForItem(TriggerSigTime, AnyMenuInfo), &menuTriggerSigLocation, InfoLocation),
-        menuTriggerSDCleanup(InfoPtrForItem(TriggerSDCleanup, AnyMenuInfo), &menuTriggerSigTime, InfoLocation),
-        menuTriggerLowMem(InfoPtrForItem(TriggerLowMem, AnyMenuInfo), &menuTriggerSDCleanup, InfoLocation),
-        menuTriggerAutosave(InfoPtrForItem(TriggerAutosave, AnyMenuInfo), &menuTriggerLowMem, InfoLocation),
-        menuSimhubConnected(InfoPtrForItem(SimhubConnected, BooleanMenuInfo), false, &menuTriggerAutosave, InfoLocation),
-        menuBackDebug(InfoPtrForItem(Debug, SubMenuInfo), &menuSimhubConnected, InfoLocation),
+        menuBackDebug(InfoPtrForItem(Debug, SubMenuInfo), nullptr, InfoLocation),
         menuDebug(InfoPtrForItem(Debug, SubMenuInfo), &menuBackDebug, &menuBackToOverview, InfoLocation),
         menuInformation(InfoPtrForItem(Information, AnyMenuInfo), &menuDebug, InfoLocation),
     #else
         menuInformation(InfoPtrForItem(Information, AnyMenuInfo), &menuBackToOverview, InfoLocation),
     #endif
-    menuCalibrations(InfoPtrForItem(Calibrations, AnyMenuInfo), nullptr, InfoLocation),
-    menuAdditives(InfoPtrForItem(Additives, AnyMenuInfo), &menuCalibrations, InfoLocation),
-    menuCropsLib(InfoPtrForItem(CropsLib, AnyMenuInfo), &menuAdditives, InfoLocation),
-    menuBackLibrary(InfoPtrForItem(Library, SubMenuInfo), &menuCropsLib, InfoLocation),
+    menuBackLibrary(InfoPtrForItem(Library, SubMenuInfo), nullptr, InfoLocation),
     menuLibrary(InfoPtrForItem(Library, SubMenuInfo), &menuBackLibrary, &menuInformation, InfoLocation),
     menuSettings(InfoPtrForItem(Settings, AnyMenuInfo), &menuLibrary, InfoLocation),
     menuScheduling(InfoPtrForItem(Scheduling, AnyMenuInfo), nullptr, InfoLocation),
@@ -183,18 +245,7 @@ HydroHomeMenuItems::HydroHomeMenuItems() :
     menuAlerts(InfoPtrForItem(Alerts, AnyMenuInfo), &menuSystem, InfoLocation)
 {
     menuBackToOverview.setReadOnly(true);
-    #ifdef HYDRO_UI_ENABLE_DEBUG_MENU
-        menuTriggerSigLocation.setReadOnly(true);
-        menuTriggerSigTime.setReadOnly(true);
-        menuTriggerSDCleanup.setReadOnly(true);
-        menuTriggerLowMem.setReadOnly(true);
-        menuTriggerAutosave.setReadOnly(true);
-        menuSimhubConnected.setReadOnly(true);
-    #endif
     menuInformation.setReadOnly(true);
-    menuCalibrations.setReadOnly(true);
-    menuAdditives.setReadOnly(true);
-    menuCropsLib.setReadOnly(true);
     menuSettings.setReadOnly(true);
     menuScheduling.setReadOnly(true);
     menuPowerRails.setReadOnly(true);
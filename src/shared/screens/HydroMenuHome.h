@@ -9,6 +9,8 @@
 #define HydroMenuHome_H
 
 class HydroHomeMenu;
+class HydroHomeDebugMenu;
+class HydroHomeLibraryMenu;
 #ifdef HYDRO_DISABLE_BUILTIN_DATA
 struct HydroHomeMenuInfo;
 #endif
@@ -16,6 +18,22 @@ struct HydroHomeMenuItems;
 
 #include "../HydruinoUI.h"
 
+#ifdef HYDRO_UI_ENABLE_DEBUG_MENU
+// Debug submenu, with its trigger items pooled while entered.
+class HydroHomeDebugMenu : public HydroPooledMenu
+{
+protected:
+    virtual MenuItem *materializeItems(HydroMenuItemPool &pool) override;
+};
+#endif // /ifdef HYDRO_UI_ENABLE_DEBUG_MENU
+
+// Library submenu, with its screen items pooled while entered.
+class HydroHomeLibraryMenu : public HydroPooledMenu
+{
+protected:
+    virtual MenuItem *materializeItems(HydroMenuItemPool &pool) override;
+};
+
 class HydroHomeMenu : public HydroMenu
 {
 public:
@@ -25,12 +43,18 @@ public:
     virtual void loadMenu(MenuItem *addFrom = nullptr) override;
     virtual MenuItem *getRootItem() override;
 
+    // Loads submenu's pooled items upon entering it, by submenu item id.
+    void loadSubMenu(int id);
     void unloadSubMenus();
 
     inline HydroHomeMenuItems &getItems() { return *_items; }
 
 protected:
     HydroHomeMenuItems *_items;
+#ifdef HYDRO_UI_ENABLE_DEBUG_MENU
+    HydroHomeDebugMenu _debugMenu;
+#endif
+    HydroHomeLibraryMenu _libraryMenu;
 };
 
 #ifdef HYDRO_DISABLE_BUILTIN_DATA
@@ -73,20 +97,11 @@ struct HydroHomeMenuItems {
 
     ActionMenuItem menuBackToOverview;
 #ifdef HYDRO_UI_ENABLE_DEBUG_MENU
-    ActionMenuItem menuTriggerSigLocation;
-    ActionMenuItem menuTriggerSigTime;
-    ActionMenuItem menuTriggerSDCleanup;
-    ActionMenuItem menuTriggerLowMem;
-    ActionMenuItem menuTriggerAutosave;
-    BooleanMenuItem menuSimhubConnected;
-    BackMenuItem menuBackDebug;
+    BackMenuItem menuBackDebug;                             // Debug items pooled after (see HydroHomeDebugMenu)
     SubMenuItem menuDebug;
 #endif // /ifdef HYDRO_UI_ENABLE_DEBUG_MENU
     ActionMenuItem menuInformation;
-    ActionMenuItem menuCalibrations;
-    ActionMenuItem menuAdditives;
-    ActionMenuItem menuCropsLib;
-    BackMenuItem menuBackLibrary;
+    BackMenuItem menuBackLibrary;                           // Library items pooled after (see HydroHomeLibraryMenu)
     SubMenuItem menuLibrary;
     ActionMenuItem menuSettings;
     ActionMenuItem menuScheduling;
@@ -5,11 +5,35 @@
 
 #include "../HydruinoUI.h"
 #ifdef HYDRO_USE_GUI
+#include "../HydroClockGlyphs.h"
 
 float skyEaseInOut(float x) {
     return x < 0.5f ? 2.0f * x * x : 1.0f - ((-2.0f * x + 2.0f) * (-2.0f * x + 2.0f) * 0.5f);
 }
 
+void overviewSkyColor(const DateTime &currTime, uint8_t *skyBlueOut, uint8_t *skyRedOut) {
+    auto sunrise = (getScheduler() ? getScheduler()->getDailyTwilight() : Twilight()).getSunriseLocalTime();
+    auto sunset = (getScheduler() ? getScheduler()->getDailyTwilight() : Twilight()).getSunsetLocalTime();
+    uint8_t skyBlue, skyRed;
+
+    if (currTime.unixtime() < sunrise.unixtime() - (SECS_PER_HOUR >> 1) ||
+        currTime.unixtime() > sunset.unixtime() + (SECS_PER_HOUR >> 1)) { skyBlue = 0; skyRed = 0; }
+    else if (currTime.unixtime() >= sunrise.unixtime() + (SECS_PER_HOUR >> 1) &&
+         currTime.unixtime() <= sunset.unixtime() - (SECS_PER_HOUR >> 1)) { skyBlue = 255; skyRed = 0; }
+    else {
+        float x = (currTime.unixtime() - ((currTime.hour() < 12 ? sunrise.unixtime() : sunset.unixtime()) - (SECS_PER_HOUR >> 1))) / (float)SECS_PER_HOUR; //(float)SECS_PER_HOUR;
+        x = constrain(x, 0.0f, 1.0f);
+        skyBlue = roundf(skyEaseInOut(currTime.hour() < 12 ? x : 1.0f - x) * 255.0f);
+        skyBlue = constrain(skyBlue, 0, 255);
+        if (currTime.hour() > 12) { x = constrain(x * 1.5f, 0.0f, 1.0f); }
+        else { x = constrain(((x - 0.25f) * 1.5f), 0.0f, 1.0f); }
+        skyRed = (-286.0f * (x * x)) + (286.0f * x);
+        skyRed = constrain(skyRed, 0, 255);
+    }
+
+    *skyBlueOut = skyBlue; *skyRedOut = skyRed;
+}
+
 void randomStarColor(uint8_t* r, uint8_t* g, uint8_t* b) {
     switch(random(20)) {
         case 0:
@@ -40,4 +64,28 @@ void randomStarColor(uint8_t* r, uint8_t* g, uint8_t* b) {
     *b = constrain((int)(*b) + (-10 + randVals[2]), 0, 255);
 }
 
+void overviewTimeString(const DateTime &time, HydroFixedString<12> &timeStr) {
+    timeStr.clear();
+    timeStr.appendUInt(time.hour(), 2).append(':').appendUInt(time.minute(), 2).append(':').appendUInt(time.second(), 2);
+}
+
+void overviewDateString(const DateTime &time, HydroFixedString<12> &dateStr) {
+    dateStr.clear();
+    dateStr.appendUInt(time.year(), 4).append('-').appendUInt(time.month(), 2).append('-').appendUInt(time.day(), 2);
+}
+
+bool overviewClockGlyph(char glyph, HydroPackedGlyph *glyphOut) {
+    for (int index = 0; index < HYDRO_CLOCKGLYPHS_COUNT; ++index) {
+        if ((char)pgm_read_byte(&hydroClockGlyphs[index].glyph) == glyph) {
+            memcpy_P(glyphOut, &hydroClockGlyphs[index], sizeof(HydroPackedGlyph));
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t overviewClockGlyphByte(uint32_t offset) {
+    return pgm_read_byte(&hydroClockGlyphsData[offset]);
+}
+
 #endif
@@ -25,16 +25,36 @@ public:
 protected:
     T &_gfx;                                                // Graphics (strong)
     AdafruitDrawable<T> &_drawable;                         // Drawable (strong)
-    const void *_clockFont;                                 // Overview clock font (strong)
+    const void *_clockFont;                                 // Overview clock font (strong), else nullptr for packed clock glyphs
     const void *_detailFont;                                // Overview detail font (strong)
 
+    // Cached glyph extents for a line of fixed-width digit text.
+    struct GlyphExtents {
+        uint16_t glyphWidths[11];                           // Digit 0-9 and separator glyph widths, in pixels
+        uint16_t cellWidth;                                 // Fixed-width digit cell width (widest digit), in pixels
+        uint16_t height;                                    // Glyph height, in pixels
+
+        inline uint16_t glyphWidthOf(char c) const { return glyphWidths[c >= '0' && c <= '9' ? c - '0' : 10]; }
+        inline uint16_t cellWidthOf(char c) const { return c >= '0' && c <= '9' ? cellWidth : glyphWidths[10]; }
+    };
+
     uint8_t _skyBlue, _skyRed;                              // Sky color
+    uint16_t *_skyColors;                                   // Per-row sky gradient line buffer (owned), rebuilt on sky change
+    uint16_t _skyRows;                                      // Number of rows in sky gradient line buffer
     Map<uint16_t,Pair<uint16_t,uint16_t>,HYDRO_UI_STARFIELD_MAXSIZE> _stars; // Starfield
     int _timeMag, _dateMag;                                 // Time/date mag level
+    uint16_t _detailHeight;                                 // Detail row text height, in pixels
     DateTime _lastTime;                                     // Last time (local)
-    uint16_t _timeHeight, _dateHeight;                      // Pixel height
+    GlyphExtents _timeGlyphs, _dateGlyphs;                  // Time/date cached glyph extents
+    HydroDirtyRegion<HYDRO_UI_DIRTYRECTS_MAXSIZE> _dirtyRegion; // Dirty screen regions pending redraw
 
+    Coord clockTextExtents(int mag, const char *text);
+    void measureGlyphs(GlyphExtents &glyphs, int mag, char separator);
+    void rebuildSkyColors(uint16_t screenHeight);
     void drawBackground(Coord pt, Coord sz, Pair<uint16_t, uint16_t> &screenSize);
+    HydroDirtyRect textCellRect(const char *text, int index, uint16_t yOffset, const GlyphExtents &glyphs, uint16_t screenWidth);
+    void drawTextCell(const char *text, int index, uint16_t yOffset, int mag, const GlyphExtents &glyphs, uint16_t screenWidth);
+    void drawDetailRow(int row, uint16_t yOffset);
 };
 
 #endif // /ifndef HydroOverviewGFX_H
@@ -8,18 +8,23 @@
 
 extern float skyEaseInOut(float x);
 extern void randomStarColor(uint8_t* r, uint8_t* g, uint8_t* b);
+extern void overviewSkyColor(const DateTime &currTime, uint8_t *skyBlueOut, uint8_t *skyRedOut);
+extern void overviewTimeString(const DateTime &time, HydroFixedString<12> &timeStr);
+extern void overviewDateString(const DateTime &time, HydroFixedString<12> &dateStr);
+extern bool overviewClockGlyph(char glyph, HydroPackedGlyph *glyphOut);
+extern uint8_t overviewClockGlyphByte(uint32_t offset);
 
 template <class T>
 HydroOverviewGFX<T>::HydroOverviewGFX(HydroDisplayAdafruitGFX<T> *display, const void *clockFont, const void *detailFont)
     : HydroOverview(display), _gfx(display->getGfx()), _drawable(display->getDrawable()), _clockFont(clockFont), _detailFont(detailFont),
-      _skyBlue(255), _skyRed(0), _timeMag(1), _dateMag(1), _lastTime((uint32_t)0), _timeHeight(0), _dateHeight(0)
+      _skyBlue(255), _skyRed(0), _skyColors(nullptr), _skyRows(0), _timeMag(1), _dateMag(1), _detailHeight(0), _lastTime((uint32_t)0)
 {
     const auto screenSize = display->getScreenSize();
     DateTime scaleTest(2099, 12, 31, 23, 59, 59);
 
     String timestamp = scaleTest.timestamp(DateTime::TIMESTAMP_TIME);
     for (int i = 2; i < 10; ++i) {
-        auto extents = _drawable.textExtents(_clockFont, i, timestamp.c_str());
+        auto extents = clockTextExtents(i, timestamp.c_str());
         if (screenSize.first - extents.x > screenSize.first / 4) {
             _timeMag = i;
         } else { break; }
@@ -27,12 +32,17 @@ HydroOverviewGFX<T>::HydroOverviewGFX(HydroDisplayAdafruitGFX<T> *display, const
 
     timestamp = scaleTest.timestamp(DateTime::TIMESTAMP_DATE);
     for (int i = 2; i < 10; ++i) {
-        auto extents = _drawable.textExtents(_clockFont, i, timestamp.c_str());
+        auto extents = clockTextExtents(i, timestamp.c_str());
         if (screenSize.first - extents.x > screenSize.first / 2) {
             _dateMag = i;
         } else { break; }
     }
 
+    measureGlyphs(_timeGlyphs, _timeMag, ':');
+    measureGlyphs(_dateGlyphs, _dateMag, '-');
+    _detailHeight = _drawable.textExtents(_detailFont, 1, "Ag").y;
+    rebuildSkyColors(screenSize.second);
+
     randomSeed(unixNow());
 
     for (int i = 0; i < HYDRO_UI_STARFIELD_MAXSIZE; ++i) {
@@ -47,146 +57,216 @@ HydroOverviewGFX<T>::HydroOverviewGFX(HydroDisplayAdafruitGFX<T> *display, const
 
 template <class T>
 HydroOverviewGFX<T>::~HydroOverviewGFX()
-{ ; }
+{
+    if (_skyColors) { delete [] _skyColors; _skyColors = nullptr; }
+}
+
+template <class T>
+Coord HydroOverviewGFX<T>::clockTextExtents(int mag, const char *text)
+{
+    if (_clockFont) { return _drawable.textExtents(_clockFont, mag, text); }
+
+    int width = 0;
+    HydroPackedGlyph glyph;
+    while (*text) {
+        if (overviewClockGlyph(*text++, &glyph)) { width += glyph.xAdvance * mag; }
+    }
+    return Coord(width, HYDRO_CLOCKGLYPHS_HEIGHT * mag);
+}
+
+template <class T>
+void HydroOverviewGFX<T>::measureGlyphs(GlyphExtents &glyphs, int mag, char separator)
+{
+    char glyph[2] = {'0', '\0'};
+    glyphs.cellWidth = glyphs.height = 0;
+
+    for (int i = 0; i < 11; ++i) {
+        glyph[0] = i < 10 ? '0' + i : separator;
+        auto extents = clockTextExtents(mag, glyph);
+        glyphs.glyphWidths[i] = extents.x;
+        if (i < 10 && extents.x > glyphs.cellWidth) { glyphs.cellWidth = extents.x; }
+        if (extents.y > glyphs.height) { glyphs.height = extents.y; }
+    }
+}
+
+template <class T>
+void HydroOverviewGFX<T>::rebuildSkyColors(uint16_t screenHeight)
+{
+    if (_skyRows != screenHeight) {
+        if (_skyColors) { delete [] _skyColors; _skyColors = nullptr; }
+        _skyColors = screenHeight ? new uint16_t[screenHeight] : nullptr;
+        HYDRO_SOFT_ASSERT(!screenHeight || _skyColors, SFP(HStr_Err_AllocationFailure));
+        _skyRows = _skyColors ? screenHeight : 0;
+    }
+
+    for (int y = 0; y < _skyRows; ++y) {
+        int skyBlue = hydroSkyBlueForRow(y, _skyRows, _skyBlue);
+        _skyColors[y] = _gfx.color565(_skyRed, (skyBlue * 7)/8, skyBlue);
+    }
+}
 
 template <class T>
 void HydroOverviewGFX<T>::drawBackground(Coord pt, Coord sz, Pair<uint16_t, uint16_t> &screenSize)
 {
     pt.x = constrain(pt.x, 0, screenSize.first);
     sz.x = constrain(sz.x, 0, screenSize.first - pt.x);
-    pt.y = constrain(pt.y, 0, screenSize.second);
-    sz.y = constrain(sz.y, 0, screenSize.second - pt.y);
+    pt.y = constrain(pt.y, 0, min(screenSize.second, _skyRows));
+    sz.y = constrain(sz.y, 0, min(screenSize.second, _skyRows) - pt.y);
+    if (!sz.x || !sz.y) { return; }
 
     _gfx.startWrite();
+    int maxX = pt.x + sz.x;
     int maxY = pt.y + sz.y;
-    for (int y = pt.y; y < maxY; ++y) {
-        int skyBlue = constrain(y - (screenSize.second - _skyBlue - 10), max(10,_skyBlue >> 2), max(10,_skyBlue));
-        uint16_t skyColor = _gfx.color565(_skyRed, (skyBlue * 7)/8, skyBlue);
-        _gfx.setAddrWindow(pt.x, y, sz.x, 1);
-        _gfx.writeColor(skyColor, (uint32_t)sz.x);
-
-        if (skyBlue + skyBlue + (int)_skyRed < 255) {
-            auto starIter = _stars.find(y);
-            if (starIter != _stars.end() && (*starIter).second.first >= pt.x && (*starIter).second.first <= pt.x + sz.x) {
-                int skyT = skyBlue + skyBlue + (int)_skyRed;
-                int starT = 255 - skyT;
-                uint16_t star565 = (*starIter).second.second;
-                uint8_t starR = (star565 >> 11) & 0x1F; starR = (starR << 3) | (starR >> 2);
-                uint8_t starG = (star565 >> 5) & 0x3F; starG = (starG << 2) | (starG >> 4);
-                uint8_t starB = star565 & 0x1F; starB = (starB << 3) | (starB >> 2);
-
-                _gfx.writePixel((*starIter).second.first, y,
-                    _gfx.color565((((int)_skyRed * skyT) / 255) + (((int)starR * starT) / 255),
-                                  ((((skyBlue * 7)/8) * skyT) / 255) + (((int)starG * starT) / 255),
-                                  ((skyBlue * skyT) / 255) + (((int)starB * starT) / 255)));
-            }
+
+    // Rows of equal gradient color share one address window, cutting per-row SPI overhead
+    for (int y = pt.y; y < maxY;) {
+        uint16_t skyColor = _skyColors[y];
+        int runY = y + 1;
+        while (runY < maxY && _skyColors[runY] == skyColor) { ++runY; }
+        _gfx.setAddrWindow(pt.x, y, sz.x, runY - y);
+        _gfx.writeColor(skyColor, (uint32_t)sz.x * (runY - y));
+        y = runY;
+    }
+
+    for (auto starIter = _stars.begin(); starIter != _stars.end(); ++starIter) {
+        int y = (*starIter).first;
+        int x = (*starIter).second.first;
+        if (y < pt.y || y >= maxY || x < pt.x || x >= maxX) { continue; }
+
+        int skyBlue = hydroSkyBlueForRow(y, _skyRows, _skyBlue);
+        int skyT = skyBlue + skyBlue + (int)_skyRed;
+        if (skyT < 255) {
+            int starT = 255 - skyT;
+            uint16_t star565 = (*starIter).second.second;
+            uint8_t starR = (star565 >> 11) & 0x1F; starR = (starR << 3) | (starR >> 2);
+            uint8_t starG = (star565 >> 5) & 0x3F; starG = (starG << 2) | (starG >> 4);
+            uint8_t starB = star565 & 0x1F; starB = (starB << 3) | (starB >> 2);
+
+            _gfx.writePixel(x, y,
+                _gfx.color565((((int)_skyRed * skyT) / 255) + (((int)starR * starT) / 255),
+                              ((((skyBlue * 7)/8) * skyT) / 255) + (((int)starG * starT) / 255),
+                              ((skyBlue * skyT) / 255) + (((int)starB * starT) / 255)));
         }
     }
     _gfx.endWrite();
 }
 
 template <class T>
-void HydroOverviewGFX<T>::renderOverview(bool isLandscape, Pair<uint16_t, uint16_t> screenSize)
+HydroDirtyRect HydroOverviewGFX<T>::textCellRect(const char *text, int index, uint16_t yOffset, const GlyphExtents &glyphs, uint16_t screenWidth)
 {
-    auto currTime = localNow();
-
-    {   auto sunrise = (getScheduler() ? getScheduler()->getDailyTwilight() : Twilight()).getSunriseLocalTime();
-        auto sunset = (getScheduler() ? getScheduler()->getDailyTwilight() : Twilight()).getSunsetLocalTime();
-        uint8_t skyBlue, skyRed;
-
-        if (currTime.unixtime() < sunrise.unixtime() - (SECS_PER_HOUR >> 1) ||
-            currTime.unixtime() > sunset.unixtime() + (SECS_PER_HOUR >> 1)) { skyBlue = 0; skyRed = 0; }
-        else if (currTime.unixtime() >= sunrise.unixtime() + (SECS_PER_HOUR >> 1) &&
-             currTime.unixtime() <= sunset.unixtime() - (SECS_PER_HOUR >> 1)) { skyBlue = 255; skyRed = 0; }
-        else {
-            float x = (currTime.unixtime() - ((currTime.hour() < 12 ? sunrise.unixtime() : sunset.unixtime()) - (SECS_PER_HOUR >> 1))) / (float)SECS_PER_HOUR; //(float)SECS_PER_HOUR;
-            x = constrain(x, 0.0f, 1.0f);
-            skyBlue = roundf(skyEaseInOut(currTime.hour() < 12 ? x : 1.0f - x) * 255.0f);
-            skyBlue = constrain(skyBlue, 0, 255);
-            if (currTime.hour() > 12) { x = constrain(x * 1.5f, 0.0f, 1.0f); }
-            else { x = constrain(((x - 0.25f) * 1.5f), 0.0f, 1.0f); }
-            skyRed = (-286.0f * (x * x)) + (286.0f * x);
-            skyRed = constrain(skyRed, 0, 255);
-        }
-
-        _needsFullRedraw = _needsFullRedraw || _skyBlue != skyBlue || _skyRed != skyRed;
-        _skyBlue = skyBlue; _skyRed = skyRed;
+    int lineWidth = 0, cellX = 0;
+    for (int i = 0; text[i]; ++i) {
+        if (i == index) { cellX = lineWidth; }
+        lineWidth += glyphs.cellWidthOf(text[i]);
     }
+    return HydroDirtyRect{(int16_t)(((int)screenWidth - lineWidth) / 2 + cellX), (int16_t)yOffset,
+                          (int16_t)glyphs.cellWidthOf(text[index]), (int16_t)glyphs.height};
+}
 
-    if (_needsFullRedraw) {
-        uint16_t yOffset = 10;
-
-        String timestamp = currTime.timestamp(DateTime::TIMESTAMP_TIME);
-        auto extents = _drawable.textExtents(_clockFont, _timeMag, timestamp.c_str());
-        _timeHeight = extents.y;
+template <class T>
+void HydroOverviewGFX<T>::drawTextCell(const char *text, int index, uint16_t yOffset, int mag, const GlyphExtents &glyphs, uint16_t screenWidth)
+{
+    auto cell = textCellRect(text, index, yOffset, glyphs, screenWidth);
+    int glyphX = cell.x + (cell.w - (int)glyphs.glyphWidthOf(text[index])) / 2;
 
-        drawBackground(Coord(0,0), Coord(screenSize.first,yOffset + _timeHeight + 5), screenSize);
-        _drawable.setDrawColor(TFT_WHITE);
-        _drawable.drawText(Coord((screenSize.first - extents.x) / 2, yOffset), _clockFont, _timeMag, timestamp.c_str());
+    if (_clockFont) {
+        char glyph[2] = {text[index], '\0'};
+        _drawable.drawText(Coord(glyphX, cell.y), _clockFont, mag, glyph);
+    } else {
+        HydroPackedGlyph glyph;
+        if (overviewClockGlyph(text[index], &glyph)) {
+            _gfx.startWrite();
+            hydroBlitPackedGlyph(glyph, overviewClockGlyphByte, glyphX, cell.y + HYDRO_CLOCKGLYPHS_ASCENT * mag, mag,
+                                 [&](int x, int y, int w, int h) { _gfx.writeFillRect(x, y, w, h, TFT_WHITE); });
+            _gfx.endWrite();
+        }
+    }
+}
 
-        yOffset += _timeHeight + 5;
+template <class T>
+void HydroOverviewGFX<T>::drawDetailRow(int row, uint16_t yOffset)
+{
+    _drawable.setDrawColor(TFT_WHITE);
+    _drawable.drawText(Coord(10, yOffset), _detailFont, 1, _detailTexts[row].c_str());
+}
 
-        timestamp = currTime.timestamp(DateTime::TIMESTAMP_DATE);
-        extents = _drawable.textExtents(_clockFont, _dateMag, timestamp.c_str());
-        _dateHeight = extents.y;
+template <class T>
+void HydroOverviewGFX<T>::renderOverview(bool isLandscape, Pair<uint16_t, uint16_t> screenSize)
+{
+    auto currTime = localNow();
 
-        drawBackground(Coord(0,yOffset), Coord(screenSize.first,yOffset + _dateHeight + 5), screenSize);
-        _drawable.setDrawColor(TFT_WHITE);
-        _drawable.drawText(Coord((screenSize.first - extents.x) / 2, yOffset), _clockFont, _dateMag, timestamp.c_str());
+    {   uint8_t skyBlue, skyRed;
+        overviewSkyColor(currTime, &skyBlue, &skyRed);
 
-        yOffset += _dateHeight + 5;
+        if (_skyBlue != skyBlue || _skyRed != skyRed || _skyRows != screenSize.second) {
+            _skyBlue = skyBlue; _skyRed = skyRed;
+            rebuildSkyColors(screenSize.second);
+            _needsFullRedraw = true;
+        }
+    }
 
-        drawBackground(Coord(0,yOffset), Coord(screenSize.first,screenSize.second - yOffset), screenSize);
+    HydroFixedString<12> currTimeStr, currDateStr;
+    overviewTimeString(currTime, currTimeStr);
+    overviewDateString(currTime, currDateStr);
+    uint16_t timeOffset = 10;
+    uint16_t dateOffset = timeOffset + _timeGlyphs.height + 5;
+    uint16_t detailOffset = dateOffset + _dateGlyphs.height + 10;
+    uint32_t detailRows = updateDetailRows(_needsFullRedraw); // bound rows, invalidated by their object's signals
 
+    _dirtyRegion.clear();
+    if (_needsFullRedraw) {
+        drawBackground(Coord(0,0), Coord(screenSize.first,screenSize.second), screenSize);
         _needsFullRedraw = false;
-    } else {
-        bool needsTimeRedraw = _lastTime.unixtime() != currTime.unixtime();
-        bool needsDateRedraw = _lastTime.day() != currTime.day() || _lastTime.month() != currTime.month() || _lastTime.year() != currTime.year();
-        uint16_t yOffset = 10;
-
-        if (needsTimeRedraw) {
-            String lastTimestamp = _lastTime.timestamp(DateTime::TIMESTAMP_TIME);
-            String currTimestamp = currTime.timestamp(DateTime::TIMESTAMP_TIME);
-            auto fullExtents = _drawable.textExtents(_clockFont, _timeMag, currTimestamp.c_str());
-
-            for (int i = 0; i < lastTimestamp.length() && i < currTimestamp.length(); ++i) {
-                if (i == lastTimestamp.length() || i == currTimestamp.length() || lastTimestamp[i] != currTimestamp[i]) {
-                    auto partExtents = _drawable.textExtents(_clockFont, _timeMag, currTimestamp.c_str() + i);
-                    Coord partStart = Coord(((screenSize.first - fullExtents.x) / 2) + fullExtents.x - partExtents.x, yOffset);
-
-                    drawBackground(partStart, partExtents, screenSize);
-
-                    _drawable.setDrawColor(TFT_WHITE);
-                    _drawable.drawText(partStart, _clockFont, _timeMag, currTimestamp.c_str() + i);
-
-                    break;
-                }
+        _drawable.setDrawColor(TFT_WHITE);
+        for (int i = 0; i < (int)currTimeStr.length(); ++i) { drawTextCell(currTimeStr.c_str(), i, timeOffset, _timeMag, _timeGlyphs, screenSize.first); }
+        for (int i = 0; i < (int)currDateStr.length(); ++i) { drawTextCell(currDateStr.c_str(), i, dateOffset, _dateMag, _dateGlyphs, screenSize.first); }
+        for (int row = 0; row < _detailCount; ++row) { drawDetailRow(row, detailOffset + row * (_detailHeight + 2)); }
+        detailRows = 0;
+    } else if (_lastTime.unixtime() != currTime.unixtime()) {
+        HydroFixedString<12> lastTimeStr, lastDateStr;
+        overviewTimeString(_lastTime, lastTimeStr);
+        overviewDateString(_lastTime, lastDateStr);
+
+        // Only changed character cells are cleared and redrawn, e.g. just the seconds digits on most ticks
+        for (int i = 0; i < (int)currTimeStr.length(); ++i) {
+            if (i >= (int)lastTimeStr.length() || lastTimeStr.c_str()[i] != currTimeStr.c_str()[i]) {
+                _dirtyRegion.add(textCellRect(currTimeStr.c_str(), i, timeOffset, _timeGlyphs, screenSize.first));
+            }
+        }
+        for (int i = 0; i < (int)currDateStr.length(); ++i) {
+            if (i >= (int)lastDateStr.length() || lastDateStr.c_str()[i] != currDateStr.c_str()[i]) {
+                _dirtyRegion.add(textCellRect(currDateStr.c_str(), i, dateOffset, _dateGlyphs, screenSize.first));
             }
         }
 
-        yOffset += _timeHeight + 5;
-
-        if (needsDateRedraw) {
-            String lastTimestamp = _lastTime.timestamp(DateTime::TIMESTAMP_DATE);
-            String currTimestamp = currTime.timestamp(DateTime::TIMESTAMP_DATE);
-            auto fullExtents = _drawable.textExtents(_clockFont, _dateMag, currTimestamp.c_str());
-
-            for (int i = 0; i < lastTimestamp.length() && i < currTimestamp.length(); ++i) {
-                if (i == lastTimestamp.length() || i == currTimestamp.length() || lastTimestamp[i] != currTimestamp[i]) {
-                    auto partExtents = _drawable.textExtents(_clockFont, _dateMag, currTimestamp.c_str() + i);
-                    Coord partStart = Coord(((screenSize.first - fullExtents.x) / 2) + fullExtents.x - partExtents.x, yOffset);
-
-                    drawBackground(partStart, partExtents, screenSize);
-
-                    _drawable.setDrawColor(TFT_WHITE);
-                    _drawable.drawText(partStart, _clockFont, _dateMag, currTimestamp.c_str() + i);
+        if (!_dirtyRegion.isEmpty()) {
+            for (int i = 0; i < (int)_dirtyRegion.size(); ++i) {
+                drawBackground(Coord(_dirtyRegion[i].x,_dirtyRegion[i].y), Coord(_dirtyRegion[i].w,_dirtyRegion[i].h), screenSize);
+            }
 
-                    break;
+            // Merged regions may cover unchanged cells, which then also need redrawn
+            _drawable.setDrawColor(TFT_WHITE);
+            for (int i = 0; i < (int)currTimeStr.length(); ++i) {
+                if (_dirtyRegion.overlaps(textCellRect(currTimeStr.c_str(), i, timeOffset, _timeGlyphs, screenSize.first))) {
+                    drawTextCell(currTimeStr.c_str(), i, timeOffset, _timeMag, _timeGlyphs, screenSize.first);
+                }
+            }
+            for (int i = 0; i < (int)currDateStr.length(); ++i) {
+                if (_dirtyRegion.overlaps(textCellRect(currDateStr.c_str(), i, dateOffset, _dateGlyphs, screenSize.first))) {
+                    drawTextCell(currDateStr.c_str(), i, dateOffset, _dateMag, _dateGlyphs, screenSize.first);
                 }
             }
         }
+    }
 
-        yOffset += _dateHeight + 5;
+    // Only rows whose object signaled a change since last tick are cleared and redrawn
+    for (int row = 0; detailRows && row < _detailCount; ++row) {
+        if (detailRows & ((uint32_t)1 << row)) {
+            uint16_t rowOffset = detailOffset + row * (_detailHeight + 2);
+            drawBackground(Coord(0,rowOffset), Coord(screenSize.first,_detailHeight), screenSize);
+            drawDetailRow(row, rowOffset);
+            detailRows &= ~((uint32_t)1 << row);
+        }
     }
 
     _lastTime = currTime;
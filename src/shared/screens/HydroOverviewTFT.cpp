@@ -8,17 +8,208 @@
 
 extern float skyEaseInOut(float x);
 extern void randomStarColor(uint8_t* r, uint8_t* g, uint8_t* b);
+extern void overviewSkyColor(const DateTime &currTime, uint8_t *skyBlueOut, uint8_t *skyRedOut);
+extern void overviewTimeString(const DateTime &time, HydroFixedString<12> &timeStr);
+extern void overviewDateString(const DateTime &time, HydroFixedString<12> &dateStr);
 
 HydroOverviewTFT::HydroOverviewTFT(HydroDisplayTFTeSPI *display, const void *clockFont, const void *detailFont)
-    : HydroOverview(display), _gfx(display->getGfx()), _drawable(display->getDrawable()), _clockFont(clockFont), _detailFont(detailFont)
-{ ; }
+    : HydroOverview(display), _gfx(display->getGfx()), _drawable(display->getDrawable()), _clockFont(clockFont), _detailFont(detailFont),
+      _strips{nullptr,nullptr}, _stripBuffers{nullptr,nullptr}, _stripIndex(0), _stripWidth(0), _stripRows(0), _dmaEnabled(false),
+      _skyBlue(255), _skyRed(0), _timeMag(1), _dateMag(1), _lastTime((uint32_t)0), _timeHeight(0), _dateHeight(0), _detailHeight(0)
+{
+    const auto screenSize = display->getScreenSize();
+
+    for (int i = 2; i < 10; ++i) {
+        applyClockFont(_gfx, i);
+        if (screenSize.first - _gfx.textWidth("23:59:59") > screenSize.first / 4) {
+            _timeMag = i;
+        } else { break; }
+    }
+    for (int i = 2; i < 10; ++i) {
+        applyClockFont(_gfx, i);
+        if (screenSize.first - _gfx.textWidth("2099-12-31") > screenSize.first / 2) {
+            _dateMag = i;
+        } else { break; }
+    }
+
+    applyClockFont(_gfx, _timeMag);
+    _timeHeight = _gfx.fontHeight();
+    applyClockFont(_gfx, _dateMag);
+    _dateHeight = _gfx.fontHeight();
+    applyDetailFont(_gfx);
+    _detailHeight = _gfx.fontHeight();
+}
 
 HydroOverviewTFT::~HydroOverviewTFT()
-{ ; }
+{
+    freeStrips();
+}
+
+void HydroOverviewTFT::allocateStrips(uint16_t screenWidth)
+{
+    freeStrips();
+    _stripRows = getBaseUI() ? getBaseUI()->getVRAMBufferRows() : 0;
+    if (!_stripRows || !screenWidth) { return; }
+    _stripWidth = screenWidth;
+
+    for (int i = 0; i < 2; ++i) {
+        _strips[i] = new TFT_eSprite(&_gfx);
+        HYDRO_SOFT_ASSERT(_strips[i], SFP(HStr_Err_AllocationFailure));
+        if (_strips[i]) {
+            _strips[i]->setColorDepth(16);
+            _stripBuffers[i] = (uint16_t *)_strips[i]->createSprite(_stripWidth, _stripRows);
+            if (!_stripBuffers[i]) { delete _strips[i]; _strips[i] = nullptr; }
+        }
+        if (!_strips[i]) { break; }
+    }
+
+    #if HAS_TFT_DMA
+        // DMA requires both strips, so that one can render while the other transfers
+        _dmaEnabled = _strips[0] && _strips[1] && _gfx.initDMA();
+    #endif
+}
+
+void HydroOverviewTFT::freeStrips()
+{
+    #if HAS_TFT_DMA
+        if (_dmaEnabled) { _gfx.dmaWait(); _dmaEnabled = false; }
+    #endif
+    for (int i = 0; i < 2; ++i) {
+        if (_strips[i]) { _strips[i]->deleteSprite(); delete _strips[i]; _strips[i] = nullptr; }
+        _stripBuffers[i] = nullptr;
+    }
+    _stripIndex = 0;
+    _stripWidth = _stripRows = 0;
+}
+
+void HydroOverviewTFT::applyClockFont(TFT_eSPI &gfx, int mag)
+{
+    if (_clockFont) { gfx.setFreeFont((const GFXfont *)_clockFont); }
+    else { gfx.setTextFont(1); }
+    gfx.setTextSize(mag);
+}
+
+void HydroOverviewTFT::applyDetailFont(TFT_eSPI &gfx)
+{
+    if (_detailFont) { gfx.setFreeFont((const GFXfont *)_detailFont); }
+    else { gfx.setTextFont(1); }
+    gfx.setTextSize(1);
+}
+
+uint16_t HydroOverviewTFT::skyColorForRow(int y, uint16_t screenHeight)
+{
+    int skyBlue = hydroSkyBlueForRow(y, screenHeight, _skyBlue);
+    return _gfx.color565(_skyRed, (skyBlue * 7)/8, skyBlue);
+}
+
+void HydroOverviewTFT::drawLayer(TFT_eSPI &gfx, int originY, int startY, int endY, Pair<uint16_t, uint16_t> &screenSize, const char *timeStr, const char *dateStr)
+{
+    for (int y = startY; y < endY;) {
+        uint16_t skyColor = skyColorForRow(y, screenSize.second);
+        int runY = y + 1;
+        while (runY < endY && skyColorForRow(runY, screenSize.second) == skyColor) { ++runY; }
+        gfx.fillRect(0, y - originY, screenSize.first, runY - y, skyColor);
+        y = runY;
+    }
+
+    uint16_t timeOffset = 10;
+    uint16_t dateOffset = timeOffset + _timeHeight + 5;
+    gfx.setTextDatum(TC_DATUM);
+    gfx.setTextColor(TFT_WHITE);
+    if (startY < timeOffset + _timeHeight && endY > timeOffset) {
+        applyClockFont(gfx, _timeMag);
+        gfx.drawString(timeStr, screenSize.first / 2, timeOffset - originY);
+    }
+    if (startY < dateOffset + _dateHeight && endY > dateOffset) {
+        applyClockFont(gfx, _dateMag);
+        gfx.drawString(dateStr, screenSize.first / 2, dateOffset - originY);
+    }
+    gfx.setTextDatum(TL_DATUM);
+    applyDetailFont(gfx);
+    for (int row = 0; row < _detailCount; ++row) {
+        uint16_t rowOffset = detailRowOffset(row);
+        if (startY < rowOffset + _detailHeight && endY > rowOffset) {
+            gfx.drawString(_detailTexts[row].c_str(), 10, rowOffset - originY);
+        }
+    }
+}
+
+void HydroOverviewTFT::compositeRows(int startY, int endY, Pair<uint16_t, uint16_t> &screenSize, const char *timeStr, const char *dateStr)
+{
+    startY = constrain(startY, 0, screenSize.second);
+    endY = constrain(endY, startY, screenSize.second);
+    if (startY >= endY) { return; }
+
+    if (!_strips[0]) {
+        _gfx.startWrite();
+        drawLayer(_gfx, 0, startY, endY, screenSize, timeStr, dateStr);
+        _gfx.endWrite();
+        return;
+    }
+
+    _gfx.startWrite();
+    for (int y = startY; y < endY; y += _stripRows) {
+        int rows = min((int)_stripRows, endY - y);
+        drawLayer(*_strips[_stripIndex], y, y, y + rows, screenSize, timeStr, dateStr);
+
+        #if HAS_TFT_DMA
+            if (_dmaEnabled) {
+                _gfx.dmaWait(); // prior strip must finish transferring before next push
+                _gfx.pushImageDMA(0, y, _stripWidth, rows, _stripBuffers[_stripIndex]);
+                _stripIndex ^= 1; // next strip renders while this one transfers
+                continue;
+            }
+        #endif
+        _strips[_stripIndex]->pushSprite(0, y, 0, 0, _stripWidth, rows);
+    }
+    #if HAS_TFT_DMA
+        if (_dmaEnabled) { _gfx.dmaWait(); }
+    #endif
+    _gfx.endWrite();
+}
 
 void HydroOverviewTFT::renderOverview(bool isLandscape, Pair<uint16_t, uint16_t> screenSize)
 {
-    // todo
+    auto currTime = localNow();
+
+    {   uint8_t skyBlue, skyRed;
+        overviewSkyColor(currTime, &skyBlue, &skyRed);
+
+        _needsFullRedraw = _needsFullRedraw || _skyBlue != skyBlue || _skyRed != skyRed;
+        _skyBlue = skyBlue; _skyRed = skyRed;
+    }
+
+    if (_stripWidth != screenSize.first && getBaseUI() && getBaseUI()->getVRAMBufferRows()) {
+        allocateStrips(screenSize.first);
+    }
+
+    HydroFixedString<12> timeStr, dateStr;
+    overviewTimeString(currTime, timeStr);
+    overviewDateString(currTime, dateStr);
+    uint32_t detailRows = updateDetailRows(_needsFullRedraw); // bound rows, invalidated by their object's signals
+
+    if (_needsFullRedraw) {
+        compositeRows(0, screenSize.second, screenSize, timeStr.c_str(), dateStr.c_str());
+        _needsFullRedraw = false;
+        detailRows = 0;
+    } else if (_lastTime.unixtime() != currTime.unixtime()) {
+        bool needsDateRedraw = _lastTime.day() != currTime.day() || _lastTime.month() != currTime.month() || _lastTime.year() != currTime.year();
+        uint16_t timeOffset = 10;
+        uint16_t dateOffset = timeOffset + _timeHeight + 5;
+
+        compositeRows(timeOffset, needsDateRedraw ? dateOffset + _dateHeight : timeOffset + _timeHeight,
+                      screenSize, timeStr.c_str(), dateStr.c_str());
+    }
+
+    // Only rows whose object signaled a change since last tick are recomposited
+    for (int row = 0; detailRows && row < _detailCount; ++row) {
+        if (detailRows & ((uint32_t)1 << row)) {
+            compositeRows(detailRowOffset(row), detailRowOffset(row) + _detailHeight, screenSize, timeStr.c_str(), dateStr.c_str());
+            detailRows &= ~((uint32_t)1 << row);
+        }
+    }
+
+    _lastTime = currTime;
 }
 
 #endif
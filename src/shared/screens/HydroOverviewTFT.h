@@ -13,7 +13,9 @@ class HydroOverviewTFT;
 #include "../HydruinoUI.h"
 
 // TFT_eSPI Overview Screen
-// Overview screen built for TFT_eSPI displays.
+// Overview screen built for TFT_eSPI displays. When buffered VRAM is enabled, the overview is
+// composited into double-buffered off-screen sprite strips that are pushed to the panel (with
+// DMA when available) while the next strip renders, avoiding flicker from drawing in-place.
 class HydroOverviewTFT : public HydroOverview {
 public:
     HydroOverviewTFT(HydroDisplayTFTeSPI *display, const void *clockFont, const void *detailFont);
@@ -26,6 +28,27 @@ protected:
     TfteSpiDrawable &_drawable;                             // Drawable (strong)
     const void *_clockFont;                                 // Overview clock font (strong)
     const void *_detailFont;                                // Overview detail font (strong)
+
+    TFT_eSprite *_strips[2];                                // Double-buffered strip sprites (owned), else nullptr for direct drawing
+    uint16_t *_stripBuffers[2];                             // Strip sprite pixel buffers (strong)
+    uint8_t _stripIndex;                                    // Index of strip being rendered into
+    uint16_t _stripWidth, _stripRows;                       // Strip size, in pixels
+    bool _dmaEnabled;                                       // If strip pushes are using DMA
+
+    uint8_t _skyBlue, _skyRed;                              // Sky color
+    int _timeMag, _dateMag;                                 // Time/date mag level
+    DateTime _lastTime;                                     // Last time (local)
+    uint16_t _timeHeight, _dateHeight, _detailHeight;       // Pixel height
+
+    void allocateStrips(uint16_t screenWidth);
+    void freeStrips();
+    void applyClockFont(TFT_eSPI &gfx, int mag);
+    void applyDetailFont(TFT_eSPI &gfx);
+    inline uint16_t detailRowOffset(int row) const { return 10 + _timeHeight + 5 + _dateHeight + 10 + row * (_detailHeight + 2); }
+    uint16_t skyColorForRow(int y, uint16_t screenHeight);
+    // Composites rows [startY,endY) of the overview and pushes them to the panel.
+    void compositeRows(int startY, int endY, Pair<uint16_t, uint16_t> &screenSize, const char *timeStr, const char *dateStr);
+    void drawLayer(TFT_eSPI &gfx, int originY, int startY, int endY, Pair<uint16_t, uint16_t> &screenSize, const char *timeStr, const char *dateStr);
 };
 
 #endif // /ifndef HydroOverviewTFT_H
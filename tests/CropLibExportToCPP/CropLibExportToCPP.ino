@@ -40,48 +40,42 @@ void setup() {
 
     getLogger()->logMessage(F("Writing crops library..."));
 
-    String spacing(F("            "));
-    String indent = spacing + F("    ");
-    for (int cropType = 0; cropType < Hydro_CropType_Count; ++cropType) {
+    for (int cropType = 0; cropType < Hydro_CropType_CustomCrop1; ++cropType) {
         auto cropData = hydroCropsLib.checkoutCropsData((Hydro_CropType)cropType);
 
         if (cropData) {
-            // case Hydro_CropType_AloeVera: {
-            //     static const char flashStr_AloeVera[] PROGMEM = {"{\"type\":\"HCLD\"}"};
-            //     progmemStream = HydroPROGMEMStream((uintptr_t)flashStr_AloeVera);
-            // } break;
-
-            Serial.print(spacing);
-            Serial.print(F("case Hydro_CropType_"));
-            Serial.print(cropTypeToString((Hydro_CropType)cropType));
-            Serial.println(F(": {"));
-
-            Serial.print(indent);
-            Serial.print(F("static const char flashStr_"));
-            Serial.print(cropTypeToString((Hydro_CropType)cropType));
-            Serial.print(F("[] PROGMEM = {\""));
-
-            {   StaticJsonDocument<HYDRO_JSON_DOC_DEFSIZE> doc;
-                JsonObject jsonObject = doc.to<JsonObject>();
-                cropData->toJSONObject(jsonObject);
-
-                String giantStr;
-                serializeJson(jsonObject, giantStr);
-                giantStr.replace("\"", "\\\"");
-                Serial.print(giantStr);
-            }
-
-            Serial.println(F("\"};"));
-
-            Serial.print(indent);
-            Serial.print(F("progmemStream = HydroPROGMEMStream((uintptr_t)flashStr_"));
-            Serial.print(cropTypeToString((Hydro_CropType)cropType));
-            Serial.println(F(");"));
-
-            Serial.print(spacing);
-            Serial.println(F("} break;"));
+            //     { "Aloe Vera", 52, { 4,24,24}, {16,14,14}, 0x19, {700,850}, {180,250}, 100, {20,24}, {20,28}, { 600, 700} }, // AloeVera
+
+            Serial.print(F("    { \""));
+            Serial.print(charsToString(cropData->cropName, HYDRO_NAME_MAXSIZE));
+            Serial.print(F("\", "));
+            Serial.print(cropData->totalGrowWeeks);
+            Serial.print(F(", {"));
+            Serial.print(commaStringFromArray(cropData->phaseDurationWeeks, 3));
+            Serial.print(F("}, {"));
+            Serial.print(commaStringFromArray(cropData->dailyLightHours, 3));
+            Serial.print(F("}, 0x"));
+            if (cropData->flags < 0x10) { Serial.print('0'); }
+            Serial.print((int)cropData->flags, HEX);
+            Serial.print(F(", {"));
+            Serial.print(lroundf(cropData->phRange[0] * 100.0f)); Serial.print(','); Serial.print(lroundf(cropData->phRange[1] * 100.0f));
+            Serial.print(F("}, {"));
+            Serial.print(lroundf(cropData->tdsRange[0] * 100.0f)); Serial.print(','); Serial.print(lroundf(cropData->tdsRange[1] * 100.0f));
+            Serial.print(F("}, "));
+            Serial.print(lroundf(cropData->nightlyFeedRate * 100.0f));
+            Serial.print(F(", {"));
+            Serial.print(lroundf(cropData->waterTempRange[0])); Serial.print(','); Serial.print(lroundf(cropData->waterTempRange[1]));
+            Serial.print(F("}, {"));
+            Serial.print(lroundf(cropData->airTempRange[0])); Serial.print(','); Serial.print(lroundf(cropData->airTempRange[1]));
+            Serial.print(F("}, {"));
+            Serial.print(lroundf(cropData->co2Levels[0])); Serial.print(','); Serial.print(lroundf(cropData->co2Levels[1]));
+            Serial.print(F("} }, // "));
+            Serial.println(cropTypeToString((Hydro_CropType)cropType));
 
             hydroCropsLib.returnCropsData(cropData);
+        } else {
+            Serial.print(F("    { \"\" }, // "));
+            Serial.println(cropTypeToString((Hydro_CropType)cropType));
         }
 
         yield();
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Reads rows from a Hydruino published data store (or rollup tier, or MQTT outbox) as CSV.
+
+The store is the numbered ##.dat segment files under a data file prefix (see HydroDataStore in
+src/HydroDataStore.h, and HydroSegmentLayout in src/HydroCoreLogic.h for the segment format).
+Segments are binary searched by first timestamp, then sealed segments are seeked into through
+their sparse index footer, so a time range only reads the records it needs. Usage:
+
+    tests/data_decode.py <data file prefix, e.g. /media/sd/data/hy> [start time] [end time]
+"""
+import re
+import struct
+import sys
+from pathlib import Path
+
+SEGMENT_MAGIC, HEADER_SIZE = 0x5348, 8
+
+
+def segment_path(prefix, segment):
+    return Path(f"{prefix}{segment:02d}.dat")
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def read_ring(prefix):
+    """Returns (first, count) of the newest valid ring record, alternately kept in 00.dat and 00.bak."""
+    newest = None
+    for path in (Path(f"{prefix}00.dat"), Path(f"{prefix}00.bak")):
+        data = path.read_bytes() if path.exists() else b""
+        if len(data) < 14:
+            continue
+        first, count, sequence, crc = struct.unpack_from("<IIIH", data)
+        if crc == crc16(data[:12]) and first and (newest is None or ((sequence - newest[2]) & 0xFFFFFFFF) < 0x80000000):
+            newest = (first, count, sequence)
+    return newest[:2] if newest else None
+
+
+def segment_layout(data, segment_size):
+    if len(data) < HEADER_SIZE:
+        return None
+    magic, columns, entries = struct.unpack_from("<HHH", data)
+    if magic != SEGMENT_MAGIC or not columns:
+        return None
+    record_size = 4 * (1 + columns)
+    overhead = HEADER_SIZE + 4 * entries
+    capacity = (segment_size - overhead) // record_size if segment_size > overhead else 0
+    stride = (capacity + entries - 1) // entries if entries and capacity > entries else 1
+    return dict(columns=columns, entries=entries, record_size=record_size, capacity=capacity, stride=stride)
+
+
+def first_record(data, layout, start_time):
+    index_offset = HEADER_SIZE + layout["capacity"] * layout["record_size"]
+    if start_time is None or len(data) < index_offset + 4 * layout["entries"]:
+        return 0  # unsealed, scanned from start
+    index = struct.unpack_from(f"<{layout['entries']}I", data, index_offset)
+    written = [entry for entry in index if entry and entry <= start_time]
+    return (len(written) - 1) * layout["stride"] if written else 0
+
+
+def read_segment(data, segment_size, start_time=None, end_time=None):
+    layout = segment_layout(data, segment_size)
+    if not layout:
+        return [], False
+    count = min((len(data) - HEADER_SIZE) // layout["record_size"], layout["capacity"])
+    rows = []
+    for record in range(first_record(data, layout, start_time), count):
+        row = struct.unpack_from(f"<I{layout['columns']}f", data, HEADER_SIZE + record * layout["record_size"])
+        if start_time is not None and row[0] < start_time:
+            continue
+        if end_time is not None and row[0] > end_time:
+            return rows, True
+        rows.append(row)
+    return rows, False
+
+
+def read_store(prefix, segment_size, start_time=None, end_time=None):
+    ring = read_ring(prefix)
+    if not ring:
+        return []
+    first, count = ring
+    segments = list(range(first, first + count))
+
+    def first_time(segment):
+        data = segment_path(prefix, segment).read_bytes() if segment_path(prefix, segment).exists() else b""
+        return struct.unpack_from("<I", data, HEADER_SIZE)[0] if len(data) >= HEADER_SIZE + 4 else 0
+
+    low, high, begin = 0, len(segments) - 1, 0
+    while start_time is not None and low <= high:
+        mid = (low + high) // 2
+        mid_time = first_time(segments[mid])
+        if mid_time and mid_time <= start_time:
+            begin, low = mid, mid + 1
+        else:
+            high = mid - 1
+
+    rows = []
+    for segment in segments[begin:]:
+        path = segment_path(prefix, segment)
+        segment_rows, past_end = read_segment(path.read_bytes() if path.exists() else b"", segment_size, start_time, end_time)
+        rows += segment_rows
+        if past_end:
+            break
+    return rows
+
+
+def defined_segment_size(src):
+    defines = (src / "HydroDefines.h").read_text()
+    return int(re.search(r"#define HYDRO_SYS_DATASTORE_SEGMENTSIZE\s+(\d+)", defines).group(1))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    times = [int(arg) for arg in sys.argv[2:4]] + [None, None]
+    size = defined_segment_size(Path(__file__).resolve().parent.parent / "src")
+    for row in read_store(sys.argv[1], size, times[0], times[1]):
+        print(",".join([str(row[0])] + ["" if value != value else f"{value:g}" for value in row[1:]]))
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Packs a glyph subset of an AdafruitGFX font header into a HydroPackedGlyph header.
+
+Each glyph is stored as raw 1-bpp rows or nibble run lengths, whichever is smaller (see
+HydroPackedGlyph in src/HydroCoreLogic.h for the format). Usage:
+
+    tests/font_pack.py <GFXfont header> <glyphs> <name> [source label] > <output header>
+"""
+import re
+import sys
+from pathlib import Path
+
+
+def parse_gfx_font(text):
+    bitmaps = text[text.index("Bitmaps[] PROGMEM = {"):]
+    bitmaps = [int(value, 16) for value in re.findall(r"0x([0-9a-fA-F]{2})", bitmaps[:bitmaps.index("};")])]
+    glyph_rows = re.findall(r"\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}\s*/\*\s*\[.*?\]\s*(\d+)\s*\*/", text)
+    glyphs = {}
+    for offset, width, height, x_advance, x_offset, y_offset, code in glyph_rows:
+        glyphs[chr(int(code))] = dict(offset=int(offset), width=int(width), height=int(height), xAdvance=int(x_advance),
+                                      xOffset=int(x_offset), yOffset=int(y_offset))
+    return bitmaps, glyphs
+
+
+def glyph_pixels(bitmaps, glyph):
+    pixels = []
+    for bit in range(glyph["width"] * glyph["height"]):
+        byte = bitmaps[glyph["offset"] + (bit >> 3)]
+        pixels.append((byte >> (7 - (bit & 7))) & 1)
+    return [pixels[row * glyph["width"]:(row + 1) * glyph["width"]] for row in range(glyph["height"])]
+
+
+def pack_bits(rows):
+    bits = [pixel for row in rows for pixel in row]
+    return bytes(sum(bit << (7 - index) for index, bit in enumerate(bits[pos:pos + 8])) for pos in range(0, len(bits), 8))
+
+
+def encode_runs(rows):
+    nibbles = []
+    for row in rows:
+        x, on, width = 0, 0, len(row)
+        while x < width:
+            run = 0
+            while x + run < width and row[x + run] == on:
+                run += 1
+            consumed = 0
+            while True:
+                nibble = min(15, run - consumed)
+                nibbles.append(nibble)
+                consumed += nibble
+                if nibble == 15 and x + consumed < width:
+                    continue
+                break
+            x += run
+            on ^= 1
+    if len(nibbles) & 1:
+        nibbles.append(0)
+    return bytes((nibbles[pos] << 4) | nibbles[pos + 1] for pos in range(0, len(nibbles), 2))
+
+
+def decode_runs(data, width, height):
+    nibbles = [nibble for byte in data for nibble in (byte >> 4, byte & 0x0F)]
+    rows, position = [], 0
+    for _ in range(height):
+        row, on = [], 0
+        while len(row) < width:
+            run = 0
+            while True:
+                nibble = nibbles[position]
+                position += 1
+                run += nibble
+                if nibble != 15 or len(row) + run >= width:
+                    break
+            row.extend([on] * run)
+            on ^= 1
+        rows.append(row)
+    return rows
+
+
+def pack_font(font_text, glyph_chars, name, source):
+    bitmaps, glyphs = parse_gfx_font(font_text)
+    data, entries = bytearray(), []
+    for char in glyph_chars:
+        glyph = glyphs[char]
+        rows = glyph_pixels(bitmaps, glyph)
+        raw, runs = pack_bits(rows), encode_runs(rows)
+        assert decode_runs(runs, glyph["width"], glyph["height"]) == rows, f"RLE roundtrip failed for {char!r}"
+        use_runs = len(runs) < len(raw)
+        entries.append((char, glyph, len(data), use_runs))
+        data.extend(runs if use_runs else raw)
+
+    ascent = max(-glyph["yOffset"] for _, glyph, _, _ in entries)
+    descent = max(glyph["yOffset"] + glyph["height"] for _, glyph, _, _ in entries)
+    array = name[0].lower() + name[1:]
+    upper = "HYDRO_" + name[5:].upper() if name.startswith("Hydro") else name.upper()
+    lines = [
+        "/*  Hydruino: Simple automation controller for hydroponic grow systems.",
+        "    Copyright (C) 2022-2023 NachtRaveVL     <nachtravevl@gmail.com>",
+        "    Hydruino Packed Glyphs",
+        "*/",
+        "",
+        f"// Generated by tests/font_pack.py from {source}, glyphs \"{glyph_chars}\" - do not edit.",
+        "",
+        f"#ifndef {name}_H",
+        f"#define {name}_H",
+        "",
+        "#include \"HydroCoreLogic.h\"",
+        "#ifndef PROGMEM",
+        "#define PROGMEM",
+        "#endif",
+        "",
+        f"#define {upper}_COUNT".ljust(40) + f"{len(entries)}".ljust(20) + "// Number of packed glyphs",
+        f"#define {upper}_ASCENT".ljust(40) + f"{ascent}".ljust(20) + "// Pixels above baseline",
+        f"#define {upper}_HEIGHT".ljust(40) + f"{ascent + max(descent, 0)}".ljust(20) + "// Pixel height, ascent and descent",
+        "",
+        f"const uint8_t {array}Data[] PROGMEM = {{",
+    ]
+    for pos in range(0, len(data), 20):
+        lines.append(",".join(f"0x{byte:02x}" for byte in data[pos:pos + 20]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"const HydroPackedGlyph {array}[] PROGMEM = {{")
+    for char, glyph, offset, use_runs in entries:
+        flags = "HydroPackedGlyph_RLE" if use_runs else "0"
+        lines.append(f"    {{ '{char}', {glyph['width']}, {glyph['height']}, {glyph['xAdvance']}, {glyph['xOffset']}, {glyph['yOffset']}, {flags}, {offset} }},")
+    lines.append("};")
+    lines.append("")
+    lines.append(f"#endif // /ifndef {name}_H")
+    return "\n".join(lines) + "\n"
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 4:
+        sys.exit(__doc__)
+    font_path = Path(sys.argv[1])
+    sys.stdout.write(pack_font(font_path.read_text(), sys.argv[2], sys.argv[3], sys.argv[4] if len(sys.argv) > 4 else font_path.name))
@@ -2,8 +2,38 @@
 #include <cstdint>
 #include <cmath>
 #include <cfloat>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include "HydroCoreLogic.h"
+#include "shared/HydroClockGlyphs.h"
+
+// Counts heap allocations, to check allocation-free paths stay so.
+static size_t allocationCount = 0;
+
+void *operator new(size_t size)
+{
+    ++allocationCount;
+    void *ptr = std::malloc(size ? size : 1);
+    if (!ptr) { throw std::bad_alloc(); }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
 
 static bool nearlyEqual(float lhs, float rhs, float eps = 0.001f)
 {
@@ -175,6 +205,914 @@ static void testBinaryDataReadPlan()
     assert(invalidCurrent.copyBytes == 0 && invalidCurrent.skipBytes == 0);
 }
 
+static void testTimerWheel()
+{
+    const uint32_t start = UINT32_MAX - 5000; // exercises 32-bit rollover mid-run
+    HydroTimerWheel<4> wheel(start);
+    const uint32_t delays[] = {1, 15, 16, 17, 255, 256, 300, 4095, 4096, 70000, 200000};
+    const int count = sizeof(delays) / sizeof(delays[0]);
+    HydroTimerWheelNode nodes[count];
+    bool fired[count] = {};
+
+    for (int index = 0; index < count; ++index) {
+        nodes[index].owner = &fired[index];
+        wheel.insert(&nodes[index], start + delays[index]);
+    }
+
+    // A removed node never fires, and re-inserting an already filed node re-files it.
+    HydroTimerWheelNode removed;
+    wheel.insert(&removed, start + 50);
+    wheel.remove(&removed);
+    assert(!removed.isFiled());
+    wheel.insert(&nodes[0], start + 2);
+    wheel.insert(&nodes[0], start + 1);
+
+    // Jumping between next events lands exactly on each expiry, never before or after it.
+    int firedCount = 0;
+    uint32_t eventTime = 0;
+    while (wheel.nextEventTime(eventTime)) {
+        assert((int32_t)(eventTime - wheel.getTime()) >= 0);
+        HydroTimerWheelNode *node;
+        while ((node = wheel.popExpired(eventTime))) {
+            assert(node->expiry == eventTime);
+            assert(!node->isFiled());
+            *((bool *)node->owner) = true;
+            ++firedCount;
+        }
+    }
+    assert(firedCount == count && wheel.isEmpty());
+    for (int index = 0; index < count; ++index) { assert(fired[index]); }
+
+    // A single large advance collects everything expired along the way, and nothing early.
+    for (int index = 0; index < count; ++index) { wheel.insert(&nodes[index], wheel.getTime() + delays[index]); }
+    const uint32_t base = wheel.getTime();
+    firedCount = 0;
+    while (wheel.popExpired(base + 4096)) { ++firedCount; }
+    assert(firedCount == 9);
+    assert(!wheel.popExpired(base + 69999));
+    assert(wheel.popExpired(base + 70000) == &nodes[9]);
+    assert(!wheel.popExpired(base + 199999));
+    assert(wheel.popExpired(base + 200000) == &nodes[10]);
+    assert(wheel.isEmpty());
+
+    // Expiries at or before the wheel's time are immediately due.
+    wheel.insert(&nodes[0], wheel.getTime());
+    assert(wheel.nextEventTime(eventTime) && eventTime == wheel.getTime());
+    assert(wheel.popExpired(wheel.getTime()) == &nodes[0]);
+
+    // An idle wheel left behind by over 2^31 ticks can't advance there, but can be reset there.
+    const uint32_t later = wheel.getTime() + 0x90000000UL;
+    wheel.advanceTo(later);
+    assert(wheel.getTime() != later);
+    wheel.resetTo(later);
+    assert(wheel.getTime() == later);
+    wheel.insert(&nodes[0], later + 10);
+    assert(!wheel.popExpired(later + 9) && wheel.popExpired(later + 10) == &nodes[0]);
+}
+
+static void testActivationJournal()
+{
+    const uint32_t monday = 1696204800UL; // 2023-10-02 00:00:00, a Monday
+    HydroActivationJournal journal;
+    assert(journal.lastTime == 0 && journal.totalActivations == 0);
+
+    // A 100W load running for 30 minutes uses 50Wh.
+    journal.countActivation(monday + 600);
+    journal.accrue(monday + 2400, 1800000UL, 100.0f);
+    assert(journal.totalActivations == 1 && journal.totalOnTimeSecs == 1800);
+    assert(nearlyEqual(journal.totalEnergyWh, 50.0f));
+    assert(journal.hourly.current.onTimeMillis == 1800000UL && journal.hourly.current.activations == 1);
+    assert(nearlyEqual(journal.daily.current.energyWh, 50.0f));
+
+    // Sub-second accruals carry their remainders into whole seconds.
+    journal.accrue(monday + 2401, 600, 0.0f);
+    journal.accrue(monday + 2402, 600, 0.0f);
+    assert(journal.totalOnTimeSecs == 1801 && journal.totalOnTimeMillis == 200);
+
+    // Moving into the next hour rolls the hourly tally over, but leaves day and week running.
+    journal.countActivation(monday + 3600 + 10);
+    assert(journal.hourly.previous.onTimeMillis == 1801200UL && journal.hourly.current.activations == 1);
+    assert(nearlyEqual(journal.getLastHourDutyCycle(), 1801200.0f / 3600000.0f));
+    assert(journal.daily.current.activations == 2 && journal.weekly.current.activations == 2);
+
+    // Skipping over an hour leaves an empty previous tally.
+    journal.rollTo(monday + (3 * 3600));
+    assert(journal.hourly.previous.onTimeMillis == 0 && journal.hourly.current.activations == 0);
+
+    // Sunday night is still the same week, Monday starts the next.
+    journal.rollTo(monday + (6 * 86400) + 86399);
+    assert(journal.weekly.current.activations == 2 && journal.daily.previous.activations == 0);
+    journal.rollTo(monday + (7 * 86400));
+    assert(journal.weekly.current.activations == 0 && journal.weekly.previous.activations == 2);
+    assert(nearlyEqual(journal.getLastWeekDutyCycle(), 1801200.0f / (604800.0f * 1000.0f)));
+
+    journal.reset();
+    assert(journal.lastTime == 0 && journal.totalOnTimeSecs == 0 && journal.weekly.previous.activations == 0);
+}
+
+static void testNextTwilightTime()
+{
+    const uint32_t dayStart = 1696204800UL;
+    const uint32_t sunrise = dayStart + (6 * 3600) + 1800 + 1; // 6.5h, plus a second past crossing
+    const uint32_t sunset = dayStart + (19 * 3600) + 900 + 1;  // 19.25h, plus a second past crossing
+
+    assert(hydroNextTwilightTime(dayStart, dayStart, 6.5, 19.25) == sunrise);
+    assert(hydroNextTwilightTime(sunrise - 1, dayStart, 6.5, 19.25) == sunrise);
+    assert(hydroNextTwilightTime(sunrise, dayStart, 6.5, 19.25) == sunset);
+    assert(hydroNextTwilightTime(sunset, dayStart, 6.5, 19.25) == sunrise + 86400UL);
+
+    // UTC-stored hours can fall outside of [0,24), wrapping into neighboring days.
+    assert(hydroNextTwilightTime(dayStart, dayStart, -2.0, 10.0) == dayStart + (10 * 3600) + 1);
+    assert(hydroNextTwilightTime(dayStart + (11 * 3600), dayStart, -2.0, 10.0) == dayStart + (22 * 3600) + 1);
+    assert(hydroNextTwilightTime(dayStart, dayStart, 14.0, 26.0) == dayStart + (2 * 3600) + 1);
+}
+
+static void testResourceBookings()
+{
+    HydroResourceBookings<uint32_t, 6> bookings;
+    const uint32_t bayA = 100, bayB = 200, bayC = 300;
+    const uint32_t freshWater = 1, drain = 2, pumpA = 10, pumpB = 20, pumpC = 30;
+
+    const uint32_t resourcesA[] = {pumpA, freshWater, drain};
+    const uint32_t resourcesB[] = {pumpB, freshWater, freshWater};
+    const uint32_t resourcesC[] = {pumpC};
+
+    assert(bookings.book(bayA, resourcesA, 3) && bookings.size() == 3);
+    assert(bookings.isBookedBy(freshWater, bayA) && bookings.hasBookings(bayA));
+
+    // Shared fresh water inlet keeps the second bay waiting, and nothing of it is booked.
+    assert(!bookings.isFree(bayB, resourcesB, 3));
+    assert(!bookings.book(bayB, resourcesB, 3) && !bookings.hasBookings(bayB) && bookings.size() == 3);
+
+    // Unshared resources book fine, and re-booking already held resources is a no-op.
+    assert(bookings.book(bayC, resourcesC, 1) && bookings.size() == 4);
+    assert(bookings.book(bayA, resourcesA, 3) && bookings.size() == 4);
+
+    // Once released, the waiting bay books (repeated resources are only booked once).
+    bookings.release(bayA);
+    assert(!bookings.hasBookings(bayA) && bookings.getOwner(freshWater, 0) == 0);
+    assert(bookings.book(bayB, resourcesB, 3) && bookings.size() == 3);
+
+    // Lack of space fails without partially booking.
+    const uint32_t many[] = {40, 41, 42, 43};
+    assert(!bookings.book(bayA, many, 4) && bookings.size() == 3);
+}
+
+static void testDailyTimeline()
+{
+    const uint32_t dayStart = 1672531200UL; // 2023-01-01 00:00:00
+
+    // 12h of light with 1h of pre-dawn spraying is centered around midday.
+    HydroLightingTimes times = hydroLightingTimes(dayStart, 12 * 3600UL, 3600UL);
+    assert(times.lightStart == dayStart + 6 * 3600UL && times.sprayStart == dayStart + 5 * 3600UL);
+    assert(times.lightEnd == dayStart + 18 * 3600UL);
+
+    // Spraying that would start before midnight is clamped, pushing lighting later.
+    times = hydroLightingTimes(dayStart, 23 * 3600UL, 3600UL);
+    assert(times.sprayStart == dayStart && times.lightStart == dayStart + 3600UL);
+    assert(times.lightEnd == dayStart + 24 * 3600UL);
+
+    // Feeding slots leave room for one more, so 3 feedings go at 0h, 6h, and 12h.
+    assert(hydroFeedingSlotTime(dayStart, 3, 0) == dayStart);
+    assert(hydroFeedingSlotTime(dayStart, 3, 1) == dayStart + 6 * 3600UL);
+    assert(hydroFeedingSlotTime(dayStart, 3, 2) == dayStart + 12 * 3600UL);
+
+    HydroPlanTimeline<4> timeline;
+    HydroPlanEntry entry = {dayStart + 300, 1, HydroPlanProcess_Lighting, 2};
+    assert(timeline.nextIndex(dayStart) == -1);
+    assert(timeline.insert(entry));
+    entry.time = dayStart + 100; entry.ownerKey = 2; assert(timeline.insert(entry));
+    entry.time = dayStart + 300; entry.ownerKey = 3; assert(timeline.insert(entry));
+    entry.time = dayStart + 200; entry.ownerKey = 4; assert(timeline.insert(entry));
+    assert(timeline.size() == 4 && !timeline.hasDropped());
+    assert(timeline[0].ownerKey == 2 && timeline[1].ownerKey == 4);
+    assert(timeline[2].ownerKey == 1 && timeline[3].ownerKey == 3); // equal times keep insertion order
+
+    assert(timeline.nextIndex(dayStart) == 0);
+    assert(timeline.nextIndex(dayStart + 101) == 1);
+    assert(timeline.nextIndex(dayStart + 300) == 2);
+    assert(timeline.nextIndex(dayStart + 301) == -1);
+
+    // Full timelines keep their earliest entries.
+    entry.time = dayStart + 400; entry.ownerKey = 5;
+    assert(!timeline.insert(entry) && timeline.size() == 4 && timeline[3].ownerKey == 3);
+    entry.time = dayStart + 50; entry.ownerKey = 6;
+    assert(!timeline.insert(entry) && timeline.size() == 4);
+    assert(timeline[0].ownerKey == 6 && timeline[3].ownerKey == 1);
+    assert(timeline.hasDropped());
+
+    timeline.clear();
+    assert(timeline.size() == 0 && timeline.nextIndex(dayStart) == -1 && !timeline.hasDropped());
+}
+
+static void testStringCache()
+{
+    HydroStringCache<2, 8> cache;
+    assert(!cache.lookup(1) && cache.getMisses() == 1);
+
+    assert(cache.store(1, "pH", 2));
+    assert(cache.store(2, "TDS", 3));
+    assert(cache.lookup(1) && std::strcmp(cache.lookup(1), "pH") == 0);
+    assert(cache.getHits() == 2);
+
+    // Least recently used entry (2) is evicted first.
+    assert(cache.store(3, "Temp", 4));
+    assert(!cache.lookup(2));
+    assert(cache.lookup(1) && cache.lookup(3) && std::strcmp(cache.lookup(3), "Temp") == 0);
+
+    // Restoring an existing key replaces in place, too-long strings aren't cached.
+    assert(cache.store(3, "Temp2", 5) && std::strcmp(cache.lookup(3), "Temp2") == 0 && cache.lookup(1));
+    assert(!cache.store(4, "TooLongStr", 10) && !cache.lookup(4));
+
+    cache.clear();
+    cache.resetCounters();
+    assert(!cache.lookup(1) && cache.getHits() == 0 && cache.getMisses() == 1);
+}
+
+static void testFixedStringFormatting()
+{
+    size_t allocationsBefore = allocationCount;
+
+    // Log line: timestamp, prefix, message, and measurement suffix.
+    HydroFixedString<64> logLine;
+    logLine.appendTimestamp(2023, 1, 2, 3, 4, 5).append(' ').append("[INFO] ").append("pH: ").appendFloat(6.126f, 2);
+    assert(std::strcmp(logLine.c_str(), "2023-01-02T03:04:05 [INFO] pH: 6.13") == 0);
+
+    // Published row: timestamp and comma separated column values.
+    HydroFixedString<64> row;
+    row.appendUInt(1672628645UL);
+    const float columns[] = {6.126f, -1.5f, 0.0f, 1234.0f};
+    for (float value : columns) { row.append(',').appendFloat(value, 2); }
+    assert(std::strcmp(row.c_str(), "1672628645,6.13,-1.50,0.00,1234.00") == 0);
+
+    // Log field values: time of day, and time span with zero parts left out.
+    HydroFixedString<32> field;
+    field.appendTime(6, 30, 0).append(' ').appendTimeSpan(86400UL + 2 * 3600UL + 5).append(' ').appendTimeSpan(0);
+    assert(std::strcmp(field.c_str(), "06:30:00 1d 2h 5s ") == 0);
+
+    // Topic and payload.
+    HydroFixedString<32> topic;
+    topic.append("Hydruino").append('/').append("PH#1");
+    topic.append(nullptr);
+    assert(std::strcmp(topic.c_str(), "Hydruino/PH#1") == 0);
+
+    assert(allocationCount == allocationsBefore);
+
+    HydroFixedString<8> small;
+    small.appendInt(-42).appendUInt(7, 3);
+    assert(std::strcmp(small.c_str(), "-42007") == 0 && !small.isTruncated());
+    small.append("abcdef");
+    assert(small.length() == 7 && small.isTruncated() && std::strcmp(small.c_str(), "-42007a") == 0);
+    small.clear();
+    small.appendFloat(NAN).append(' ').appendFloat(9e9f, 0);
+    assert(std::strcmp(small.c_str(), "nan ovf") == 0);
+    small.clear();
+    small.appendFloat(0.5f, 0).appendFloat(2.26f, 1);
+    assert(std::strcmp(small.c_str(), "12.3") == 0);
+
+    HydroFixedString<16> extremes;
+    extremes.appendInt(INT32_MIN);
+    assert(std::strcmp(extremes.c_str(), "-2147483648") == 0);
+}
+
+static void testDirtyRegions()
+{
+    HydroDirtyRegion<2> region;
+    region.add(HydroDirtyRect{0, 0, 0, 10});
+    assert(region.isEmpty());
+
+    // Adjacent digit cells merge into one rect.
+    region.add(HydroDirtyRect{10, 0, 10, 20});
+    region.add(HydroDirtyRect{20, 0, 10, 20});
+    assert(region.size() == 1 && region[0].x == 10 && region[0].w == 20 && region[0].h == 20);
+
+    // Disjoint rects stay apart until full, then merge with least growth.
+    region.add(HydroDirtyRect{100, 0, 10, 20});
+    assert(region.size() == 2);
+    region.add(HydroDirtyRect{115, 0, 10, 20});
+    assert(region.size() == 2 && region[1].x == 100 && region[1].w == 25);
+
+    assert(region.overlaps(HydroDirtyRect{105, 5, 2, 2}));
+    assert(!region.overlaps(HydroDirtyRect{30, 0, 10, 20})); // shared edge only
+
+    // Sky gradient is clamped at top and bottom of screen, and tracks sky brightness.
+    assert(hydroSkyBlueForRow(0, 240, 128) == 32);
+    assert(hydroSkyBlueForRow(239, 240, 128) == 128);
+    assert(hydroSkyBlueForRow(200, 240, 128) == 98);
+    assert(hydroSkyBlueForRow(0, 240, 0) == 10 && hydroSkyBlueForRow(239, 240, 0) == 10);
+}
+
+static void testFieldInvalidations()
+{
+    HydroFieldInvalidations invalidations;
+    assert(!invalidations.hasInvalidations() && !invalidations.take());
+
+    // Several sensor updates within one UI tick coalesce into one redraw per field.
+    invalidations.invalidate(3);
+    invalidations.invalidate(3);
+    invalidations.invalidate(31);
+    assert(invalidations.isInvalidated(3) && !invalidations.isInvalidated(4));
+    assert(invalidations.getCoalescedCount() == 1);
+    assert(invalidations.take() == ((1UL << 3) | (1UL << 31)));
+    assert(!invalidations.hasInvalidations());
+
+    invalidations.invalidateMask(0x5);
+    assert(invalidations.isInvalidated(0) && invalidations.isInvalidated(2) && invalidations.take() == 0x5);
+}
+
+static void testArena()
+{
+    HydroArena<32> arena;
+    void *first = arena.allocate(3, 1);
+    void *second = arena.allocate(8, 8);
+    assert(first && second && arena.owns(first) && arena.owns(second));
+    assert(((uintptr_t)second & 7) == 0 && arena.getUsed() == 16);
+
+    // Oversized requests fail without disturbing the arena.
+    assert(!arena.allocate(17, 1) && arena.getUsed() == 16);
+    assert(arena.allocate(16, 4) && arena.getAvailable() == 0);
+
+    // Recycled all at once, keeping the high water mark.
+    arena.reset();
+    assert(arena.getUsed() == 0 && arena.getHighWater() == 32);
+    assert(arena.allocate(4) == first);
+}
+
+static void testDeltaBatch()
+{
+    HydroDeltaBatch<3> batch;
+    assert(!batch.isDue(0, 500));
+
+    // Repeat changes coalesce, first batch goes out immediately.
+    assert(batch.add(10) && batch.add(20) && batch.add(10) && batch.add(30));
+    assert(!batch.add(40) && batch.size() == 3 && batch.getCoalescedCount() == 1);
+    assert(batch.isDue(100, 500));
+
+    // Unsent remainder waits out the interval, rollover safe.
+    batch.consume(2, 0xFFFFFF00UL);
+    assert(batch.size() == 1 && batch[0] == 30);
+    assert(!batch.isDue(0xF3, 500) && batch.isDue(0xF4, 500));
+    batch.consume(5, 0);
+    assert(batch.isEmpty() && !batch.isDue(1000, 500));
+}
+
+static void testInputEvents()
+{
+    HydroInputEventRing<4> ring;
+    HydroInputEvent event;
+    assert(ring.isEmpty() && !ring.pop(event));
+
+    // One slot stays open, so a full ring drops (and counts) newer events.
+    for (int8_t index = 0; index < 4; ++index) {
+        assert(ring.push(HydroInputEvent{(uint8_t)index, 1, (uint32_t)index}) == (index < 3));
+    }
+    assert(ring.getDroppedCount() == 1);
+    assert(ring.pop(event) && event.source == 0);
+    assert(ring.push(HydroInputEvent{7, 0, 10}));
+    assert(ring.pop(event) && event.source == 1 && ring.pop(event) && event.source == 2);
+    assert(ring.pop(event) && event.source == 7 && event.value == 0 && ring.isEmpty());
+
+    // Contact bounce collapses into one edge, settled trailing edge is recovered.
+    HydroEdgeDebouncer<4> debouncer;
+    assert(debouncer.accept(2, true, 100, 20) && debouncer.getState(2));
+    assert(!debouncer.accept(2, false, 103, 20) && !debouncer.accept(2, true, 105, 20));
+    assert(!debouncer.accept(2, false, 110, 20));
+    assert(debouncer.accept(2, false, 120, 20) && !debouncer.getState(2));
+    assert(!debouncer.getState(1));
+
+    // Full cycle encoder steps into detents, either direction, ignoring invalid transitions.
+    HydroQuadratureDecoder decoder(4);
+    decoder.reset(0);
+    const uint8_t forward[] = { 1, 3, 2, 0 };
+    int detents = 0;
+    for (uint8_t ab : forward) { detents += decoder.update(ab); }
+    assert(detents == 1);
+    assert(decoder.update(3) == 0); // skipped state, no step
+    decoder.reset(0);
+    const uint8_t reverse[] = { 2, 3, 1, 0, 2, 3, 1, 0 };
+    for (uint8_t ab : reverse) { detents += decoder.update(ab); }
+    assert(detents == -1);
+}
+
+// Simulated I2C EEPROM device, counting bus transactions.
+struct SimEEPROM {
+    uint8_t data[600];
+    int reads = 0, writes = 0;
+
+    SimEEPROM() { for (size_t index = 0; index < sizeof(data); ++index) { data[index] = (uint8_t)(index * 7); } }
+
+    uint16_t readBlock(uint32_t address, uint8_t *buffer, uint16_t length) {
+        ++reads;
+        std::memcpy(buffer, &data[address], length);
+        return length;
+    }
+    bool updateBlockVerify(uint32_t address, const uint8_t *buffer, uint16_t length) {
+        ++writes;
+        assert(address / 16 == (address + length - 1) / 16); // never spans a device page
+        std::memcpy(&data[address], buffer, length);
+        return true;
+    }
+};
+
+static void testEEPROMPageBuffer()
+{
+    SimEEPROM eeprom;
+    HydroEEPROMPageBuffer<SimEEPROM, 32> buffer(&eeprom, sizeof(eeprom.data), 16);
+    assert(buffer.getPageSize() == 16);
+
+    // Byte-by-byte reads (as JSON deserialization does) cost one transaction per 32 bytes,
+    // rather than one per byte, and stop at the device end.
+    for (uint32_t address = 5; address < sizeof(eeprom.data); ++address) {
+        assert(buffer.read(address) == (uint8_t)(address * 7));
+    }
+    assert(eeprom.reads == 19 && buffer.read(sizeof(eeprom.data)) == -1);
+
+    // Sequential byte writes combine into one verified update per device page.
+    for (uint32_t address = 40; address < 100; ++address) {
+        assert(buffer.write(address, (uint8_t)(255 - address)));
+    }
+    assert(eeprom.writes == 4 && buffer.hasPendingWrites());
+    assert(buffer.read(96) == (uint8_t)(255 - 96)); // overlapping read sees pending writes
+    assert(buffer.flush() && eeprom.writes == 5 && !buffer.hasPendingWrites());
+    for (uint32_t address = 40; address < 100; ++address) { assert(eeprom.data[address] == (uint8_t)(255 - address)); }
+
+    // Non-sequential write flushes pending range, overlapping read flushes before filling.
+    uint8_t block[4] = {1, 2, 3, 4};
+    assert(buffer.writeBlock(200, block, 4) == 4 && buffer.write(300, 9) && eeprom.writes == 6);
+    buffer.invalidate();
+    uint8_t readBack[4] = {0};
+    assert(buffer.readBlock(300, readBack, 1) == 1 && readBack[0] == 9 && eeprom.writes == 7);
+    assert(buffer.readBlock(200, readBack, 4) == 4 && std::memcmp(readBack, block, 4) == 0);
+}
+
+static void testEEPROMGenerations()
+{
+    // CRC-16/CCITT-FALSE check value.
+    uint16_t crc = 0xFFFF;
+    for (const char *ch = "123456789"; *ch; ++ch) { crc = hydroCRC16(crc, (uint8_t)*ch); }
+    assert(crc == 0x29B1);
+    assert(hydroIsNewerSequence(1, 0xFFFFFFFFUL) && !hydroIsNewerSequence(5, 5));
+
+    SimEEPROM eeprom;
+    HydroEEPROMGenerations<SimEEPROM> generations(&eeprom, 96, 448, 4);
+    assert(generations.getSlotAddress(2) == 320 && generations.getPayloadCapacity() == 102);
+    uint32_t sequence = 0;
+    // First generation goes into the last slot, clear of legacy data at the region start.
+    assert(generations.findNewest() == -1 && generations.nextSlot(&sequence) == 3 && sequence == 1);
+
+    // Saves rotate through every slot, wrapping around, with boot picking the newest.
+    for (uint8_t save = 0; save < 6; ++save) {
+        int slot = generations.nextSlot(&sequence);
+        assert(slot == (save + 3) % 4 && sequence == (uint32_t)save + 1);
+        for (uint8_t index = 0; index < 20; ++index) { eeprom.data[generations.getPayloadAddress(slot) + index] = (uint8_t)(save + index); }
+        assert(generations.commit(slot, sequence, 20));
+        HydroGenerationHeader header;
+        assert(generations.findNewest(&header) == slot && header.sequence == sequence && header.length == 20);
+    }
+
+    // Torn payload write (header not yet rewritten) falls back to previous generation.
+    int slot = generations.nextSlot(&sequence);
+    assert(slot == 1 && sequence == 7);
+    eeprom.data[generations.getPayloadAddress(0) + 3] ^= 0xFF;
+    HydroGenerationHeader header;
+    assert(generations.findNewest(&header) == 3 && header.sequence == 5);
+    assert(!generations.commit(0, 8, 103));
+
+    // Payload overflowing a slot falls back to fewer, larger slots, clear of newest generation,
+    // and later saves that fit go back to rotating through every slot.
+    SimEEPROM fresh;
+    HydroEEPROMGenerations<SimEEPROM> first(&fresh, 96, 448, 4);
+    assert(first.nextSlot(&sequence) == 3 && first.commit(3, sequence, 20));
+    HydroEEPROMGenerations<SimEEPROM> larger(&fresh, 96, 448, 4);
+    assert(larger.fallBack() && larger.getSlotCount() == 2 && larger.getPayloadCapacity() == 214);
+    assert(larger.nextSlot(&sequence) == 0 && sequence == 2 && larger.commit(0, sequence, 150));
+    assert(larger.findNewest(&header) == 0 && header.length == 150 && larger.getNewestPayloadAddress(0) == 106);
+    HydroEEPROMGenerations<SimEEPROM> after(&fresh, 96, 448, 4);
+    assert(after.nextSlot(&sequence) == 1 && after.getSlotCount() == 2 && sequence == 3);
+    assert(after.getSlotAddress(1) == 320 && after.commit(1, sequence, 20));
+    HydroEEPROMGenerations<SimEEPROM> smaller(&fresh, 96, 448, 4);
+    assert(smaller.findNewest(&header) == 2 && header.sequence == 3);
+    assert(smaller.nextSlot(&sequence) == 3 && smaller.getSlotCount() == 4 && sequence == 4);
+    assert(smaller.fallBack() && smaller.fallBack() && !smaller.fallBack() && smaller.getSlotCount() == 1);
+}
+
+static void testSaveSequence()
+{
+    enum Target : signed char { SDCard, EEPROM, Disabled = -1 };
+
+    // Disabled targets are skipped, with nothing to do when both are.
+    HydroSaveSequence<Target, Disabled> sequence;
+    assert(sequence.isFinished() && sequence.getTarget() == Disabled);
+    sequence.begin(Disabled, Disabled, 3);
+    assert(sequence.isFinished() && !sequence.isSaved());
+    sequence.begin(Disabled, EEPROM, 3);
+    assert(!sequence.isFinished() && sequence.getTarget() == EEPROM);
+
+    // Target is written in full, then fallback, each from the first record.
+    sequence.begin(SDCard, EEPROM, 2);
+    assert(sequence.getTarget() == SDCard && sequence.getRecordIndex() == 0 && !sequence.isTargetWritten());
+    sequence.recordWritten(); sequence.recordWritten(); sequence.recordWritten();
+    assert(sequence.getRecordIndex() == 2 && sequence.isTargetWritten());
+    sequence.targetFinished(true);
+    assert(sequence.getTarget() == EEPROM && sequence.getRecordIndex() == 0 && sequence.isSaved());
+    sequence.recordWritten();
+    sequence.targetFinished(false);
+    assert(sequence.isFinished() && sequence.isSaved());
+
+    // Target failing part way through falls back, and only a fully written one counts as saved.
+    sequence.begin(SDCard, EEPROM, 2);
+    sequence.recordWritten();
+    sequence.targetFinished(false);
+    assert(sequence.getTarget() == EEPROM && sequence.getRecordIndex() == 0 && !sequence.isSaved());
+    sequence.targetFinished(false);
+    assert(sequence.isFinished() && !sequence.isSaved());
+}
+
+static void testHandlePool()
+{
+    HydroHandlePool<int, 2, 16> pool;
+    bool evict = true;
+
+    // Opened handles are shared by name and mode, released ones stay open for reuse.
+    assert(pool.acquire("logs/a.txt", true, 0) == -1);
+    int logSlot = pool.claim("logs/a.txt", true, 0, &evict);
+    assert(logSlot == 0 && !evict && pool.getRefCount(logSlot) == 1);
+    pool[logSlot] = 100;
+    assert(pool.acquire("logs/a.txt", false, 5) == -1 && pool.acquire("logs/a.txt", true, 5) == logSlot);
+    assert(pool.getRefCount(logSlot) == 2 && pool.indexOf(&pool[logSlot]) == logSlot);
+    pool.release(logSlot, 10); pool.release(logSlot, 10);
+
+    int strSlot = pool.claim("strings.dat", false, 20, &evict);
+    assert(strSlot == 1 && !evict && pool.getOpenCount() == 2);
+
+    // Full pool evicts least recently used idle handle, never a referenced one.
+    assert(pool.claim("data/b.csv", true, 30, &evict) == logSlot && evict && pool[logSlot] == 100);
+    assert(pool.claim("crop01.dat", false, 40, &evict) == -1 && !evict);
+    assert(pool.claim("much/too/long/name.dat", false, 40, &evict) == -1);
+    assert(pool.find("logs/a.txt") == -1 && pool.find("data/b.csv") == logSlot);
+
+    // Idle handles expire after timeout (rollover safe), referenced ones never do.
+    pool.release(strSlot, 0xFFFFFFF0UL);
+    assert(pool.nextExpired(0xFFFFFFF8UL, 100) == -1 && pool.nextExpired(0x60, 100) == strSlot);
+    pool.drop(strSlot);
+    assert(pool.nextExpired(0x60, 100) == -1 && !pool.isOpen(strSlot) && pool.getOpenCount() == 1);
+}
+
+static void testSegmentStore()
+{
+    HydroSegmentLayout layout = {1024, 3, 8};
+    assert(layout.getRecordSize() == 16 && layout.getRecordCapacity() == 61 && layout.getIndexStride() == 8);
+    assert(layout.getRecordOffset(2) == 40 && layout.getIndexOffset() == 984);
+    assert(layout.getIndexOffset() + layout.indexEntries * 4 <= layout.segmentSize);
+    assert(layout.getRecordCount(8 + 16 * 5 + 7) == 5 && layout.getRecordCount(4096) == 61);
+
+    uint8_t header[HydroSegmentLayout::HeaderSize];
+    layout.packHeader(header);
+    HydroSegmentLayout unpacked = {1024, 0, 0};
+    assert(unpacked.unpackHeader(header) && unpacked.columnCount == 3 && unpacked.indexEntries == 8);
+    header[0] = 0;
+    assert(!unpacked.unpackHeader(header));
+
+    // Skipped values survive a store round trip as NaNs distinct from missing (NaN) values.
+    float skipped = hydroSkippedValue(), stored;
+    memcpy(&stored, &skipped, sizeof(stored));
+    assert(isnan(stored) && hydroIsSkippedValue(stored) && !hydroIsSkippedValue(NAN) && !hydroIsSkippedValue(1.0f));
+
+    // Sparse index narrows a range query to one stride, partially written indexes included.
+    uint32_t entries[8] = {1000, 1080, 1160, 1240, 0, 0, 0, 0};
+    assert(hydroSparseIndexSeek(entries, 8, 8, 999) == 0 && hydroSparseIndexSeek(entries, 8, 8, 1000) == 0);
+    assert(hydroSparseIndexSeek(entries, 8, 8, 1100) == 8 && hydroSparseIndexSeek(entries, 8, 8, 5000) == 24);
+
+    // Byte budget bounds live segments, expiring the oldest.
+    HydroSegmentRing ring = {1, 0};
+    for (int segment = 0; segment < 3; ++segment) { assert(ring.push(4) == 0); }
+    assert(ring.getNewest() == 3 && ring.push(4) == 0 && ring.push(4) == 1);
+    assert(ring.first == 2 && ring.count == 4 && ring.getNewest() == 5);
+
+    // Ring records round trip with their sequence number, with torn (or blank) records refused.
+    uint8_t ringBytes[HydroSegmentRing::PackedSize];
+    ring.pack(7, ringBytes);
+    HydroSegmentRing loaded = {1, 0};
+    uint32_t ringSequence = 0;
+    assert(loaded.unpack(ringBytes, &ringSequence) && loaded.first == 2 && loaded.count == 4 && ringSequence == 7);
+    ringBytes[5] ^= 0x01;
+    assert(!loaded.unpack(ringBytes, &ringSequence));
+    memset(ringBytes, 0xFF, sizeof(ringBytes));
+    assert(!loaded.unpack(ringBytes, &ringSequence));
+
+    // Daily CSV files sharing the data store budget are found by name, 8.3 uppercased names included.
+    assert(hydroDayFilenameDate("hy230415.csv", "hy", "csv") == 230415 && hydroDayFilenameDate("HY230415.CSV", "hy", "csv") == 230415);
+    assert(hydroDayFilenameDate("hy01.dat", "hy", "csv") == -1 && hydroDayFilenameDate("hy230415.txt", "hy", "csv") == -1);
+    assert(hydroDayFilenameDate("hyo23041.csv", "hy", "csv") == -1 && hydroDayFilenameDate("hy230415.csvx", "hy", "csv") == -1);
+}
+
+static void testRollupStats()
+{
+    HydroRollupStats stats;
+    stats.clear();
+    assert(stats.count == 0 && nearlyEqual(stats.getMean(), 0.0f));
+
+    const float values[] = {6.2f, 5.8f, NAN, 6.6f, 6.0f};
+    for (float value : values) { stats.add(value); }
+    assert(stats.count == 4 && nearlyEqual(stats.minValue, 5.8f) && nearlyEqual(stats.maxValue, 6.6f));
+    assert(nearlyEqual(stats.getMean(), 6.15f) && nearlyEqual(stats.lastValue, 6.0f));
+
+    // 15-minute buckets align to wall time, independent of first sample time.
+    assert(hydroRollupBucket(1700000999UL, 900) == 1700000100UL && hydroRollupBucket(1700000100UL, 900) == 1700000100UL);
+    assert(hydroRollupBucket(1700000999UL, 60) == 1700000940UL && hydroRollupBucket(12345, 0) == 12345);
+
+    // Tier reads address a column's min/max/mean/last within its stored bucket row.
+    assert(hydroRollupColumn(0, 0) == 0 && hydroRollupColumn(2, 2) == 10 && hydroRollupColumn(3, 3) == 15);
+}
+
+static void testFramePayload()
+{
+    // Unchanged columns (1) are left out, keeping them apart from NaN values (2).
+    HydroFramePayload<48> payload;
+    payload.begin(1700000000UL);
+    payload.add(0, 6.25f, 2);
+    payload.add(2, NAN);
+    payload.add(3, -1.5f, 1);
+    assert(payload.end() && std::strcmp(payload.c_str(), "{\"t\":1700000000,\"0\":6.25,\"2\":null,\"3\":-1.5}") == 0);
+
+    // Frames too large for one message report so, to be sent per column instead.
+    HydroFramePayload<16> small;
+    small.begin(1700000000UL);
+    small.add(0, 123.456f, 3);
+    assert(!small.end());
+}
+
+static void testShouldPublishValue()
+{
+    // Negative deadband (default) publishes every frame, as does first publish.
+    assert(hydroShouldPublishValue(1.0f, 1.0f, 1000, 990, -1.0f, 0));
+    assert(hydroShouldPublishValue(1.0f, 1.0f, 1000, 0, 0.5f, 0));
+
+    // Only moves beyond deadband publish, measured from last published value.
+    assert(!hydroShouldPublishValue(20.4f, 20.0f, 1000, 990, 0.5f, 0));
+    assert(!hydroShouldPublishValue(19.6f, 20.0f, 1000, 990, 0.5f, 0));
+    assert(hydroShouldPublishValue(20.6f, 20.0f, 1000, 990, 0.5f, 0));
+
+    // Zero deadband publishes any change (binary sensors), heartbeat republishes unchanged.
+    assert(!hydroShouldPublishValue(1.0f, 1.0f, 1000, 990, 0.0f, 0));
+    assert(hydroShouldPublishValue(0.0f, 1.0f, 1000, 990, 0.0f, 0));
+    assert(!hydroShouldPublishValue(1.0f, 1.0f, 1000, 990, 0.0f, 60));
+    assert(hydroShouldPublishValue(1.0f, 1.0f, 1050, 990, 0.0f, 60));
+
+    // Readings going missing, or coming back, always publish.
+    assert(hydroShouldPublishValue(NAN, 20.0f, 1000, 990, 0.5f, 0));
+    assert(hydroShouldPublishValue(20.0f, NAN, 1000, 990, 0.5f, 0));
+    assert(!hydroShouldPublishValue(NAN, NAN, 1000, 990, 0.5f, 0));
+}
+
+// UDP transport sending to a local listener, with injectable send failures.
+struct LoopbackUDP
+{
+    int sock;
+    sockaddr_in address;
+    bool failing;
+
+    size_t send(const char *data, size_t length) {
+        return !failing && sendto(sock, data, length, 0, (const sockaddr *)&address, sizeof(address)) == (ssize_t)length ? length : 0;
+    }
+};
+
+// Stream transport accepting at most a few bytes per send, as a congested TCP client would.
+struct ShortWriteStream
+{
+    std::string received;
+    size_t maxWrite;
+
+    size_t send(const char *data, size_t length) {
+        size_t written = length < maxWrite ? length : maxWrite;
+        received.append(data, written);
+        return written;
+    }
+};
+
+static void testLineProtocolBatcher()
+{
+    int listener = socket(AF_INET, SOCK_DGRAM, 0);
+    assert(listener >= 0);
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addressLength = sizeof(address);
+    assert(bind(listener, (const sockaddr *)&address, sizeof(address)) == 0);
+    assert(getsockname(listener, (sockaddr *)&address, &addressLength) == 0);
+    timeval timeout = {2, 0};
+    setsockopt(listener, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    LoopbackUDP udp = {socket(AF_INET, SOCK_DGRAM, 0), address, false};
+    HydroLineProtocolBatcher<LoopbackUDP, 128> batcher(udp);
+    const char *tags[] = {"system", "My Farm", "sensor", "WaterTemp1", "units", ""};
+    char packet[256];
+
+    // Tags, fields, and measurement are escaped, empty tags skipped, and NaN values not sent.
+    assert(batcher.addLine("hydruino", tags, 3, "Water=Temp", 20.5f, 1700000000UL));
+    assert(!batcher.addLine("hydruino", tags, 3, "Water=Temp", NAN, 1700000000UL));
+    assert(batcher.flush() && batcher.getPendingLength() == 0);
+    ssize_t received = recv(listener, packet, sizeof(packet) - 1, 0);
+    assert(received > 0);
+    packet[received] = '\0';
+    assert(std::strcmp(packet, "hydruino,system=My\\ Farm,sensor=WaterTemp1 Water\\=Temp=20.500000 1700000000\n") == 0);
+
+    // While sends fail, the pending packet is kept and lines that don't fit are dropped.
+    udp.failing = true;
+    assert(batcher.addLine("hydruino", tags, 3, "Water=Temp", 21.0f, 1700000005UL));
+    assert(!batcher.addLine("hydruino", tags, 3, "Water=Temp", 22.0f, 1700000010UL));
+    assert(batcher.getDropCount() == 1 && batcher.getPendingLength() > 0 && !batcher.flush());
+
+    udp.failing = false;
+    assert(batcher.flush());
+    received = recv(listener, packet, sizeof(packet) - 1, 0);
+    assert(received > 0);
+    packet[received] = '\0';
+    assert(std::strstr(packet, "=21.000000 1700000005\n") && !std::strstr(packet, "22.0"));
+
+    close(udp.sock);
+    close(listener);
+
+    // Partial writes resume past what was already written, so each line arrives once.
+    ShortWriteStream stream = {std::string(), 16};
+    HydroLineProtocolBatcher<ShortWriteStream, 128> streamBatcher(stream);
+    assert(streamBatcher.addLine("hydruino", tags, 3, "Water=Temp", 20.5f, 1700000000UL));
+    size_t packetLength = streamBatcher.getPendingLength();
+    size_t flushes = 1;
+    while (!streamBatcher.flush()) { assert(streamBatcher.getSentLength() == flushes * 16); ++flushes; }
+    assert(flushes == (packetLength + 15) / 16 && streamBatcher.getPendingLength() == 0);
+    assert(stream.received == "hydruino,system=My\\ Farm,sensor=WaterTemp1 Water\\=Temp=20.500000 1700000000\n");
+
+    // A restarted packet (lost with its connection) is resent whole.
+    stream.received.clear();
+    assert(streamBatcher.addLine("hydruino", tags, 3, "Water=Temp", 21.0f, 1700000005UL));
+    assert(!streamBatcher.flush() && streamBatcher.getSentLength() == 16);
+    streamBatcher.restartPacket();
+    stream.received.clear();
+    stream.maxWrite = 128;
+    assert(streamBatcher.flush() && std::strstr(stream.received.c_str(), "hydruino,system=") == stream.received.c_str());
+}
+
+static void testLogRecords()
+{
+    HydroLogRecordWriter<32> writer;
+    writer.begin(1, 1700000000UL);
+    writer.add(HydroLogArg::object(0, 3, 1));
+    writer.add(HydroLogArg::string(44));
+    writer.add(HydroLogArg());
+    writer.add(HydroLogArg::number(6.25f, 1));
+    assert(writer.end() && writer.size() == 6 + 4 + 3 + 6);
+
+    HydroLogRecordReader reader(writer.data(), writer.size());
+    HydroLogArg arg;
+    assert(reader.isValid() && reader.getLevel() == 1 && reader.getTimestamp() == 1700000000UL);
+    assert(reader.next(arg) && arg.type == HydroLogArg::ObjectId && arg.as.object.type == 0 && arg.as.object.objType == 3 && arg.as.object.posIndex == 1);
+    assert(reader.next(arg) && arg.type == HydroLogArg::StringId && arg.as.stringId == 44);
+    assert(reader.next(arg) && arg.type == HydroLogArg::Number && std::fabs(arg.as.number.value - 6.25f) < 0.0001f && arg.as.number.decimals == 1);
+    assert(!reader.next(arg));
+
+    // Text that doesn't fit is truncated to the record, and flagged so.
+    writer.begin(2, 1700000001UL);
+    writer.add(HydroLogArg::string(7));
+    writer.add(HydroLogArg::chars("some long text that cannot fit"));
+    assert(!writer.end() && writer.size() == 32);
+    HydroLogRecordReader textReader(writer.data(), writer.size());
+    assert(textReader.next(arg) && textReader.next(arg) && arg.type == HydroLogArg::Text);
+    assert(arg.as.text.length == 32 - 6 - 3 - 2 && std::strncmp(arg.as.text.chars, "some long text", 14) == 0);
+    assert(!textReader.next(arg));
+
+    // Soft assertion records (string id, file, line number, message) fit whole at the default record size.
+    HydroLogRecordWriter<96> assertWriter;
+    assertWriter.begin(1, 1700000002UL);
+    assertWriter.add(HydroLogArg::string(7));
+    assertWriter.add(HydroLogArg::chars(": HydroMenuHomeItems.cpp:"));
+    assertWriter.add(HydroLogArg::number(1234.0f, 0));
+    assertWriter.add(HydroLogArg::chars(": Not configured properly"));
+    assert(assertWriter.end());
+    HydroLogRecordReader assertReader(assertWriter.data(), assertWriter.size());
+    assert(assertReader.next(arg) && assertReader.next(arg) && assertReader.next(arg) && arg.type == HydroLogArg::Number && std::fabs(arg.as.number.value - 1234.0f) < 0.0001f);
+    assert(assertReader.next(arg) && arg.as.text.length == 25 && !assertReader.next(arg));
+
+    // Mismatched record sizes are rejected.
+    assert(!HydroLogRecordReader(writer.data(), writer.size() - 1).isValid());
+
+    // File header round trips, with string table CRC matching tests/log_decode.py's crc16().
+    HydroLogFileHeader header;
+    header.stringCount = 2;
+    header.stringsCRC = HydroLogFileHeader::crcString(HydroLogFileHeader::crcString(0xFFFF, "ab"), "");
+    assert(header.stringsCRC == 0x5EAD);
+    uint8_t headerBytes[HydroLogFileHeader::PackedSize];
+    header.pack(headerBytes);
+    assert(headerBytes[0] == 'H' && headerBytes[1] == 'L');
+    HydroLogFileHeader readHeader;
+    assert(readHeader.unpack(headerBytes) && readHeader.stringCount == 2 && readHeader.stringsCRC == 0x5EAD);
+    headerBytes[0] = writer.data()[0];
+    assert(!readHeader.unpack(headerBytes));
+}
+
+// String table lookups from small test tables, standing in for the logger's Flash lookups.
+struct TestLogStrings {
+    template<size_t N>
+    void appendString(HydroFixedString<N> &out, uint16_t stringId) const {
+        static const char *strings[] = {"[INFO] ", " has ", "enabled", "GrowLights"};
+        if (stringId < 4) { out.append(strings[stringId]); }
+    }
+    int objectTypeStringId(int8_t type, int8_t objType) const { return type == 0 && objType == 1 ? 3 : -1; }
+};
+
+static void testLogMessageAllocations()
+{
+    size_t allocationsBefore = allocationCount;
+    HydroLogArgResolver<TestLogStrings> resolver(TestLogStrings(), 1, 32);
+
+    // Whole log message: binary record written, then event texts expanded from the same args.
+    const HydroLogArg args[3] = { HydroLogArg::object(0, 1, 0), HydroLogArg::string(1), HydroLogArg::string(2) };
+    const HydroLogArg otherArgs[2] = { HydroLogArg::object(1, 5, 40), HydroLogArg::object(7, 0, 0) };
+    HydroLogRecordWriter<64> record;
+    record.begin(0, 1700000000UL);
+    for (const HydroLogArg &arg : args) { record.add(arg); }
+    assert(record.end());
+
+    HydroFixedString<20> timestamp;
+    HydroFixedString<8> prefix;
+    HydroFixedString<48> texts[3];
+    timestamp.appendTimestamp(2023, 11, 14, 22, 13, 20);
+    resolver.appendString(prefix, 0);
+    for (int textIndex = 0; textIndex < 3; ++textIndex) { hydroAppendLogArg(texts[textIndex], args[textIndex], resolver); }
+    HydroFixedString<24> others[2];
+    for (int argIndex = 0; argIndex < 2; ++argIndex) { hydroAppendLogArg(others[argIndex], otherArgs[argIndex], resolver); }
+
+    // Overlong text is cut and marked as such.
+    HydroFixedString<12> overlong;
+    overlong.append("overlong message text").markTruncation();
+    HydroFixedString<12> fits;
+    fits.append("fits").markTruncation();
+
+    // Read back, as for UI display of a binary log, with number and text args.
+    record.begin(1, 1700000001UL);
+    record.add(HydroLogArg::number(2.5f, 1));
+    record.add(HydroLogArg::chars("ok"));
+    assert(record.end());
+    HydroLogRecordReader reader(record.data(), record.size());
+    HydroFixedString<48> readBack;
+    HydroLogArg arg;
+    while (reader.next(arg)) { hydroAppendLogArg(readBack, arg, resolver); }
+
+    assert(allocationCount == allocationsBefore);
+    assert(std::strcmp(prefix.c_str(), "[INFO] ") == 0);
+    assert(std::strcmp(texts[0].c_str(), "Actuator GrowLights #1") == 0);
+    assert(std::strcmp(texts[1].c_str(), " has ") == 0 && std::strcmp(texts[2].c_str(), "enabled") == 0);
+    assert(std::strcmp(readBack.c_str(), "2.5ok") == 0);
+    assert(std::strcmp(others[0].c_str(), "Sensor  #") == 0 && std::strcmp(others[1].c_str(), "Unknown") == 0);
+    assert(std::strcmp(overlong.c_str(), "overlong...") == 0 && std::strcmp(fits.c_str(), "fits") == 0);
+}
+
+struct GlyphFill { int x, y, w, h; };
+
+static void testPackedGlyphs()
+{
+    // 4x3 glyph, as raw bits and as nibble runs: .##. / .##. / ####
+    const uint8_t rawData[] = {0x66, 0xF0};
+    const uint8_t runData[] = {0x12, 0x11, 0x21, 0x04};
+    const HydroPackedGlyph rawGlyph = {'A', 4, 3, 5, 0, -3, 0, 0};
+    const HydroPackedGlyph runGlyph = {'A', 4, 3, 5, 0, -3, HydroPackedGlyph_RLE, 0};
+
+    for (int pass = 0; pass < 2; ++pass) {
+        const uint8_t *data = pass ? runData : rawData;
+        GlyphFill fills[4];
+        int fillCount = 0;
+        hydroBlitPackedGlyph(pass ? runGlyph : rawGlyph, [&](uint32_t offset) { return data[offset]; }, 10, 20, 2,
+                             [&](int x, int y, int w, int h) { assert(fillCount < 4); fills[fillCount++] = GlyphFill{x, y, w, h}; });
+
+        // Identical top rows merge into one rect.
+        assert(fillCount == 2);
+        assert(fills[0].x == 12 && fills[0].y == 14 && fills[0].w == 4 && fills[0].h == 4);
+        assert(fills[1].x == 10 && fills[1].y == 18 && fills[1].w == 8 && fills[1].h == 2);
+    }
+
+    // Runs of 15+ continue across nibbles.
+    const uint8_t longData[] = {0x0F, 0x50};
+    const HydroPackedGlyph longGlyph = {'_', 20, 1, 20, 0, 0, HydroPackedGlyph_RLE, 0};
+    uint8_t starts[HYDRO_GLYPH_MAXSPANS], lengths[HYDRO_GLYPH_MAXSPANS];
+    auto readLong = [&](uint32_t offset) { return longData[offset]; };
+    HydroGlyphRowDecoder<decltype(readLong)> decoder(longGlyph, readLong);
+    assert(decoder.decodeRow(starts, lengths, HYDRO_GLYPH_MAXSPANS) == 1 && starts[0] == 0 && lengths[0] == 20);
+
+    // Generated clock glyphs stay inside of their cells.
+    assert(sizeof(hydroClockGlyphs) / sizeof(hydroClockGlyphs[0]) == HYDRO_CLOCKGLYPHS_COUNT);
+    int pixels[HYDRO_CLOCKGLYPHS_COUNT] = {0};
+    for (int index = 0; index < HYDRO_CLOCKGLYPHS_COUNT; ++index) {
+        const HydroPackedGlyph &glyph = hydroClockGlyphs[index];
+        hydroBlitPackedGlyph(glyph, [](uint32_t offset) { return hydroClockGlyphsData[offset]; }, 0, HYDRO_CLOCKGLYPHS_ASCENT, 1,
+                             [&](int x, int y, int w, int h) {
+            assert(x >= 0 && x + w <= glyph.xAdvance && y >= 0 && y + h <= HYDRO_CLOCKGLYPHS_HEIGHT);
+            pixels[index] += w * h;
+        });
+    }
+    assert(hydroClockGlyphs[8].glyph == '8' && pixels[8] > pixels[1] && pixels[11] == 4);
+}
+
 int main()
 {
     testElapsedTime();
@@ -185,5 +1123,29 @@ int main()
     testBinaryDebounce();
     testBalancerStates();
     testTimedDosingEstimate();
+    testTimerWheel();
+    testActivationJournal();
+    testNextTwilightTime();
+    testResourceBookings();
+    testDailyTimeline();
+    testStringCache();
+    testFixedStringFormatting();
+    testDirtyRegions();
+    testFieldInvalidations();
+    testArena();
+    testDeltaBatch();
+    testInputEvents();
+    testEEPROMPageBuffer();
+    testEEPROMGenerations();
+    testSaveSequence();
+    testHandlePool();
+    testSegmentStore();
+    testRollupStats();
+    testFramePayload();
+    testShouldPublishValue();
+    testLineProtocolBatcher();
+    testLogRecords();
+    testLogMessageAllocations();
+    testPackedGlyphs();
     return 0;
 }
@@ -0,0 +1,118 @@
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "HydroCropsLibTable.h"
+
+#ifndef HYDRO_TESTS_DIR
+#define HYDRO_TESTS_DIR "."
+#endif
+
+// Returns the raw value of a key inside of a flat, compact JSON object (quotes stripped), else empty.
+static std::string jsonValue(const std::string &object, const char *key)
+{
+    std::string keyStr = std::string("\"") + key + "\":";
+    size_t pos = object.find(keyStr);
+    if (pos == std::string::npos) { return std::string(); }
+    pos += keyStr.length();
+    if (object[pos] == '"') {
+        size_t end = object.find('"', pos + 1);
+        return object.substr(pos + 1, end - pos - 1);
+    }
+    size_t end = object.find_first_of(",}", pos);
+    return object.substr(pos, end - pos);
+}
+
+// Splits a comma list of numbers, repeating a lone value to fill count.
+static std::vector<float> jsonNumbers(const std::string &value, size_t count)
+{
+    std::vector<float> numbers;
+    size_t pos = 0;
+    while (pos <= value.length()) {
+        size_t end = value.find(',', pos);
+        if (end == std::string::npos) { end = value.length(); }
+        numbers.push_back(std::strtof(value.substr(pos, end - pos).c_str(), nullptr));
+        pos = end + 1;
+    }
+    while (numbers.size() < count) { numbers.push_back(numbers.back()); }
+    return numbers;
+}
+
+static uint8_t jsonFlags(const std::string &value)
+{
+    const char *flagNames[] = {"invasive", "viner", "large", "perennial", "toxic", "pruning", "spraying"};
+    std::string flagsStr = "," + value + ",";
+    uint8_t flags = 0;
+    for (int flagIndex = 0; flagIndex < 7; ++flagIndex) {
+        if (flagsStr.find(std::string(",") + flagNames[flagIndex] + ",") != std::string::npos) { flags |= (uint8_t)(1 << flagIndex); }
+    }
+    return flags;
+}
+
+static bool nearlyEqual(float lhs, float rhs, float eps = 0.001f)
+{
+    return std::fabs(lhs - rhs) <= eps;
+}
+
+static void testCropsTableMatchesJSON()
+{
+    std::ifstream jsonFile(HYDRO_TESTS_DIR "/crops_lib.json");
+    assert(jsonFile.is_open());
+
+    size_t cropIndex = 0;
+    const size_t tableSize = sizeof(hydroCropsLibTable) / sizeof(hydroCropsLibTable[0]);
+    std::string line;
+    while (std::getline(jsonFile, line)) {
+        if (line.empty() || line[0] != '{') { continue; }
+        assert(cropIndex < tableSize);
+        const HydroCropsLibPacked &packed = hydroCropsLibTable[cropIndex++];
+
+        assert(jsonValue(line, "cropName") == packed.cropName);
+        assert(std::atoi(jsonValue(line, "totalGrowWeeks").c_str()) == packed.totalGrowWeeks);
+
+        std::vector<float> phases = jsonNumbers(jsonValue(line, "phaseDurationWeeks"), 3);
+        std::vector<float> lights = jsonNumbers(jsonValue(line, "dailyLightHours"), 3);
+        for (int phaseIndex = 0; phaseIndex < 3; ++phaseIndex) {
+            assert(nearlyEqual(phases[phaseIndex], packed.phaseDurationWeeks[phaseIndex]));
+            assert(nearlyEqual(lights[phaseIndex], packed.dailyLightHours[phaseIndex]));
+        }
+
+        std::vector<float> ph = jsonNumbers(jsonValue(line, "phRange"), 2);
+        std::vector<float> tds = jsonNumbers(jsonValue(line, "tdsRange"), 2);
+        std::vector<float> waterTemp = jsonNumbers(jsonValue(line, "waterTempRange"), 2);
+        std::vector<float> airTemp = jsonNumbers(jsonValue(line, "airTempRange"), 2);
+        std::vector<float> co2 = jsonNumbers(jsonValue(line, "co2Levels"), 2);
+        for (int rangeIndex = 0; rangeIndex < 2; ++rangeIndex) {
+            assert(nearlyEqual(ph[rangeIndex], packed.phRange[rangeIndex] * 0.01f));
+            assert(nearlyEqual(tds[rangeIndex], packed.tdsRange[rangeIndex] * 0.01f));
+            assert(nearlyEqual(waterTemp[rangeIndex], packed.waterTempRange[rangeIndex]));
+            assert(nearlyEqual(airTemp[rangeIndex], packed.airTempRange[rangeIndex]));
+            assert(nearlyEqual(co2[rangeIndex], packed.co2Levels[rangeIndex]));
+        }
+
+        assert(nearlyEqual(jsonNumbers(jsonValue(line, "nightlyFeedRate"), 1)[0], packed.nightlyFeedRate * 0.01f));
+        assert(jsonFlags(jsonValue(line, "flags")) == packed.flags);
+    }
+
+    assert(cropIndex == tableSize);
+}
+
+static void testCropsTableSize()
+{
+    // Packed table should stay far smaller than the JSON it replaces.
+    std::ifstream jsonFile(HYDRO_TESTS_DIR "/crops_lib.json", std::ios::ate);
+    assert(jsonFile.is_open());
+    assert(sizeof(hydroCropsLibTable) * 4 < (size_t)jsonFile.tellg());
+}
+
+int main()
+{
+    testCropsTableMatchesJSON();
+    testCropsTableSize();
+    return 0;
+}
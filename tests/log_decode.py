@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Decodes a binary Hydruino log file (see HydroLogger::setLogBinary) into text log lines.
+
+String ids and object types are resolved from the string and enum tables of the source tree,
+which must match the firmware that wrote the log: the log file header's string count and string
+table CRC are checked against the source tree's, and decoding is refused on mismatch (see
+HydroLogFileHeader and HydroLogRecordWriter in src/HydroCoreLogic.h for the format). Usage:
+
+    tests/log_decode.py <log .dat file> [src dir]
+"""
+import re
+import struct
+import sys
+from datetime import datetime, timezone
+from pathlib import Path
+
+ARG_STRING_ID, ARG_OBJECT_ID, ARG_NUMBER, ARG_TEXT = 1, 2, 3, 4
+FILE_MAGIC, FILE_HEADER_SIZE = 0x4C48, 6
+SPECIAL_STRINGS = ("HStr_Count", "HStr_Undefined")  # object type names left out, as on device
+OBJECT_TYPES = [("Actuator", "Hydro_ActuatorType", "actuatorTypeToStringId"),
+                ("Sensor", "Hydro_SensorType", "sensorTypeToStringId"),
+                ("Crop", "Hydro_CropType", "cropTypeToStringId"),
+                ("Reservoir", "Hydro_ReservoirType", "reservoirTypeToStringId"),
+                ("Rail", "Hydro_RailType", "railTypeToStringId")]
+LEVEL_PREFIXES = ["HStr_Log_Prefix_Info", "HStr_Log_Prefix_Warning", "HStr_Log_Prefix_Error"]
+
+
+def crc16(data, crc=0xFFFF):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def parse_enum(text, name):
+    body = re.search(rf"enum {name}\b[^{{]*\{{(.*?)\}};", text, re.S).group(1)
+    values, next_value = {}, 0
+    for entry, value in re.findall(r"^\s*(\w+)\s*(?:=\s*([-\w]+))?\s*,", body, re.M):
+        if value:
+            next_value = int(value, 0) if re.match(r"-?\d", value) else values[value]
+        values[entry] = next_value
+        next_value += 1
+    return values
+
+
+def parse_strings(strings_h, strings_cpp):
+    ids = parse_enum(strings_h, "Hydro_String")
+    texts = dict(re.findall(r'case (HStr_\w+): \{\s*static const char \w+\[\] PROGMEM = \{"((?:[^"\\]|\\.)*)"\}', strings_cpp))
+    return {ids[name]: text.encode().decode("unicode_escape") for name, text in texts.items() if name in ids}, ids
+
+
+def parse_type_strings(utils_cpp, function, enum, strings, string_ids):
+    body = utils_cpp[utils_cpp.index(f"Hydro_String {function}("):]
+    body = body[:body.index("\n}\n")]
+    names, pending = {}, []
+    for case, string in re.findall(r"case (\w+):|return (HStr_\w+);", body):
+        if case:
+            pending.append(case)
+        elif string:
+            for name in pending if string not in SPECIAL_STRINGS else []:
+                if name in enum:
+                    names[enum[name]] = strings.get(string_ids[string], "")
+            pending = []
+    return names
+
+
+def load_tables(src):
+    defines = (src / "HydroDefines.h").read_text()
+    utils_cpp = (src / "HydroUtils.cpp").read_text()
+    strings, string_ids = parse_strings((src / "HydroStrings.h").read_text(), (src / "HydroStrings.cpp").read_text())
+    objects = [(label, parse_type_strings(utils_cpp, function, parse_enum(defines, enum), strings, string_ids))
+               for label, enum, function in OBJECT_TYPES]
+    pos_begin = int(re.search(r"#define HYDRO_POS_EXPORT_BEGFROM\s+(\d+)", defines).group(1))
+    pos_max = int(re.search(r"#define HYDRO_POS_MAXSIZE\s+(\d+)", defines).group(1))
+    prefixes = [strings[string_ids[name]] for name in LEVEL_PREFIXES]
+    string_count = max(string_ids.values()) + 1  # HStr_Count, as last (comma-less) entry
+    strings_crc = crc16(b"".join(strings.get(index, "").encode("latin-1") + b"\0" for index in range(string_count)))
+    return dict(strings=strings, objects=objects, pos_begin=pos_begin, pos_max=pos_max, prefixes=prefixes,
+                string_count=string_count, strings_crc=strings_crc)
+
+
+def file_header(tables):
+    return struct.pack("<HHH", FILE_MAGIC, tables["string_count"], tables["strings_crc"])
+
+
+def object_text(tables, obj_type, type_index, pos_index):
+    if not 0 <= obj_type < len(tables["objects"]):
+        return "Unknown"
+    label, names = tables["objects"][obj_type]
+    position = str(pos_index + tables["pos_begin"]) if 0 <= pos_index < tables["pos_max"] else ""
+    return f"{label} {names.get(type_index, '')} #{position}"
+
+
+def decode_record(tables, record):
+    level, timestamp = struct.unpack_from("<bI", record, 1)
+    texts, offset = [], 6
+    while offset < len(record):
+        arg_type, offset = record[offset], offset + 1
+        if arg_type == ARG_STRING_ID:
+            texts.append(tables["strings"].get(struct.unpack_from("<H", record, offset)[0], ""))
+            offset += 2
+        elif arg_type == ARG_OBJECT_ID:
+            texts.append(object_text(tables, *struct.unpack_from("<bbb", record, offset)))
+            offset += 3
+        elif arg_type == ARG_NUMBER:
+            value, decimals = struct.unpack_from("<fB", record, offset)
+            texts.append(f"{value:.{decimals}f}")
+            offset += 5
+        elif arg_type == ARG_TEXT:
+            length = record[offset]
+            texts.append(record[offset + 1:offset + 1 + length].decode(errors="replace"))
+            offset += 1 + length
+        else:
+            break
+    prefix = tables["prefixes"][level] if 0 <= level < len(tables["prefixes"]) else ""
+    time_text = datetime.fromtimestamp(timestamp, timezone.utc).strftime("%Y-%m-%dT%H:%M:%S")
+    return f"{time_text} {prefix}{''.join(texts)}"
+
+
+def decode_log(tables, data):
+    """Decodes log file data, raising ValueError if its header doesn't match the string table."""
+    if len(data) < FILE_HEADER_SIZE or struct.unpack_from("<H", data)[0] != FILE_MAGIC:
+        raise ValueError("missing binary log file header")
+    string_count, strings_crc = struct.unpack_from("<HH", data, 2)
+    if (string_count, strings_crc) != (tables["string_count"], tables["strings_crc"]):
+        raise ValueError(f"string table mismatch (log has {string_count} strings, CRC {strings_crc:04X}; source has "
+                         f"{tables['string_count']} strings, CRC {tables['strings_crc']:04X}), decode with the "
+                         f"firmware's source version")
+    lines, offset = [], FILE_HEADER_SIZE
+    while offset + 6 <= len(data):
+        size = data[offset]
+        if size < 6 or offset + size > len(data):
+            break
+        lines.append(decode_record(tables, data[offset:offset + size]))
+        offset += size
+    return lines
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    src_dir = Path(sys.argv[2]) if len(sys.argv) > 2 else Path(__file__).resolve().parent.parent / "src"
+    try:
+        log_lines = decode_log(load_tables(src_dir), Path(sys.argv[1]).read_bytes())
+    except ValueError as error:
+        sys.exit(f"{sys.argv[1]}: {error}")
+    for line in log_lines:
+        print(line)
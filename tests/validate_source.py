@@ -1,10 +1,13 @@
 #!/usr/bin/env python3
 import json
 import re
+import sys
 from pathlib import Path
 
 ROOT = Path(__file__).resolve().parents[1]
 SRC = ROOT / "src"
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+sys.dont_write_bytecode = True
 
 
 def require(condition, message):
@@ -21,18 +24,24 @@ def parse_range(value, count):
 
 
 def validate_crop_database():
-    text = (SRC / "HydroCropsLibrary.cpp").read_text()
-    matches = re.findall(r'static const char flashStr_(\w+)\[\] PROGMEM = \{"((?:\\.|[^"])*)"\};', text)
-    require(len(matches) == 77, f"Expected 77 built-in crops, found {len(matches)}")
+    crops = json.loads((ROOT / "tests" / "crops_lib.json").read_text())
+    require(len(crops) == 77, f"Expected 77 built-in crops, found {len(crops)}")
+
+    defines = (SRC / "HydroDefines.h").read_text()
+    crop_types = re.findall(r"Hydro_CropType_(\w+),", defines[defines.index("enum Hydro_CropType"):defines.index("Hydro_CropType_CustomCrop1,")])
+    require([crop["id"] for crop in crops] == crop_types, "Crop database is not in Hydro_CropType order")
+
+    table = (SRC / "HydroCropsLibTable.h").read_text()
+    rows = re.findall(r'^\s*\{ "[^"]*",.*// (\w+)$', table, re.MULTILINE)
+    require(rows == crop_types, "Packed crop table is not in Hydro_CropType order")
 
     required = {
         "type", "id", "cropName", "totalGrowWeeks", "phaseDurationWeeks", "dailyLightHours",
         "phRange", "tdsRange", "nightlyFeedRate", "waterTempRange", "airTempRange", "co2Levels"
     }
 
-    for symbol, escaped in matches:
-        crop = json.loads(bytes(escaped, "utf8").decode("unicode_escape"))
-        require(crop["id"] == symbol, f"Crop symbol/id mismatch for {symbol}")
+    for crop in crops:
+        symbol = crop["id"]
         require(required.issubset(crop), f"{symbol} is missing fields: {sorted(required - set(crop))}")
 
         total_weeks = int(crop["totalGrowWeeks"])
@@ -121,6 +130,61 @@ def validate_family_consistency():
                 f"HydroBinaryDataReadPlan.{field} is missing its inline member comment")
 
 
+def validate_packed_glyphs():
+    import font_pack
+    header = (SRC / "shared" / "HydroClockGlyphs.h").read_text()
+    source = re.search(r'from (\S+), glyphs "([^"]+)"', header)
+    require(source, "HydroClockGlyphs.h is missing its generation comment")
+    font = (SRC / "shared" / source.group(1)).read_text()
+    require(font_pack.pack_font(font, source.group(2), "HydroClockGlyphs", source.group(1)) == header,
+            "HydroClockGlyphs.h is out of date with tests/font_pack.py")
+
+
+def validate_log_decoder():
+    import struct
+    import log_decode
+    tables = log_decode.load_tables(SRC)
+    string_ids = log_decode.parse_enum((SRC / "HydroStrings.h").read_text(), "Hydro_String")
+    args = (struct.pack("<BBbb", log_decode.ARG_OBJECT_ID, 0, 1, 0) +
+            struct.pack("<BH", log_decode.ARG_STRING_ID, string_ids["HStr_Log_HasEnabled"]) +
+            struct.pack("<BfB", log_decode.ARG_NUMBER, 2.5, 1) + struct.pack("<BB", log_decode.ARG_TEXT, 2) + b"ok")
+    record = struct.pack("<BbI", 6 + len(args), 0, 1700000000) + args
+    lines = log_decode.decode_log(tables, log_decode.file_header(tables) + record + record)
+    require(lines == ["2023-11-14T22:13:20 [INFO] Actuator GrowLights #1 has enabled2.5ok"] * 2,
+            f"tests/log_decode.py decoded unexpected log lines: {lines}")
+    for data in (record, struct.pack("<HHH", log_decode.FILE_MAGIC, tables["string_count"],
+                                     tables["strings_crc"] ^ 1) + record):
+        try:
+            log_decode.decode_log(tables, data)
+            require(False, "tests/log_decode.py decoded a log without a matching string table header")
+        except ValueError:
+            pass
+
+
+def validate_data_decoder():
+    import struct
+    import tempfile
+    import data_decode
+    with tempfile.TemporaryDirectory() as directory:
+        prefix = str(Path(directory) / "hy")
+        stale = struct.pack("<III", 1, 1, 1)
+        Path(prefix + "00.dat").write_bytes(stale + struct.pack("<H", data_decode.crc16(stale)))
+        ring = struct.pack("<III", 1, 2, 2)
+        Path(prefix + "00.bak").write_bytes(ring + struct.pack("<H", data_decode.crc16(ring)))
+        sealed = struct.pack("<HHHxx", data_decode.SEGMENT_MAGIC, 1, 8)
+        sealed += b"".join(struct.pack("<If", 1000 + record * 10, record) for record in range(123))
+        sealed += struct.pack("<8I", *[1000 + entry * 16 * 10 for entry in range(8)])
+        Path(prefix + "01.dat").write_bytes(sealed)
+        Path(prefix + "02.dat").write_bytes(struct.pack("<HHHxx", data_decode.SEGMENT_MAGIC, 1, 8) +
+                                            struct.pack("<IfIf", 3000, 1.5, 3010, float("nan")))
+        rows = data_decode.read_store(prefix, 1024, 1995, 2020) + data_decode.read_store(prefix, 1024, 2225, 3005)
+        require([row[0] for row in rows] == [2000, 2010, 2020, 3000] and rows[0][1] == 100,
+                f"tests/data_decode.py read unexpected data store rows: {rows}")
+        layout = data_decode.segment_layout(sealed, 1024)
+        require(data_decode.first_record(sealed, layout, 1995) == 96,
+                "tests/data_decode.py isn't seeking through the sealed segment's sparse index")
+
+
 def validate_readme():
     readme = (ROOT / "README.md").read_text()
     require("UNDER ACTIVE DEVELOPMENT -- WORK IN PROGRESS" not in readme, "README still has WIP banner")
@@ -132,5 +196,8 @@ if __name__ == "__main__":
     validate_scheduler_fixes()
     validate_binary_persistence()
     validate_family_consistency()
+    validate_packed_glyphs()
+    validate_log_decoder()
+    validate_data_decoder()
     validate_readme()
     print("Hydruino source validation passed")